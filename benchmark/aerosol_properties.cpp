@@ -0,0 +1,135 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the cost of evaluating aerosol property values and partial derivatives on the Jacobian
+// path for a mode with many species. The fused cases call each provider's ComputeValueAndDerivatives
+// alone, as AerosolPropertyCache::UpdateWithPartials does; the two-pass cases add the separate
+// ComputeValue pass that preceded it. The difference is the saving of the fused evaluation.
+
+#include <miam/miam.hpp>
+
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  /// @brief A multi-species mode, its property providers and their inputs and outputs
+  template<typename DenseMatrixPolicy>
+  struct PropertyState
+  {
+    std::vector<miam::AerosolPropertyProvider<DenseMatrixPolicy>> providers;
+    std::vector<DenseMatrixPolicy> values;
+    std::vector<DenseMatrixPolicy> partials;
+    DenseMatrixPolicy parameters;
+    DenseMatrixPolicy variables;
+  };
+
+  /// @brief Builds the r_eff, N and φ providers of a mode with `number_of_species` species in each of two phases
+  template<typename DenseMatrixPolicy, typename Representation>
+  PropertyState<DenseMatrixPolicy> MakePropertyState(std::size_t number_of_cells, std::size_t number_of_species)
+  {
+    std::vector<micm::PhaseSpecies> aqueous_species;
+    std::vector<micm::PhaseSpecies> organic_species;
+    for (std::size_t i = 0; i < number_of_species; ++i)
+    {
+      aqueous_species.push_back(micm::Species{ "AQ" + std::to_string(i),
+                                               { { "molecular weight [kg mol-1]", 0.018 + 0.001 * i },
+                                                 { "density [kg m-3]", 1000.0 + 10.0 * i } } });
+      organic_species.push_back(micm::Species{ "ORG" + std::to_string(i),
+                                               { { "molecular weight [kg mol-1]", 0.150 + 0.002 * i },
+                                                 { "density [kg m-3]", 1200.0 + 10.0 * i } } });
+    }
+    micm::Phase aqueous{ "AQUEOUS", aqueous_species };
+    micm::Phase organic{ "ORGANIC", organic_species };
+    Representation mode{ "MODE", { aqueous, organic } };
+
+    std::unordered_map<std::string, std::size_t> parameter_indices;
+    for (const auto& name : mode.StateParameterNames())
+      parameter_indices[name] = parameter_indices.size();
+    std::unordered_map<std::string, std::size_t> variable_indices;
+    for (const auto& name : mode.StateVariableNames())
+      variable_indices[name] = variable_indices.size();
+
+    PropertyState<DenseMatrixPolicy> state{ {},
+                                            {},
+                                            {},
+                                            DenseMatrixPolicy(number_of_cells, parameter_indices.size(), 0.0),
+                                            DenseMatrixPolicy(number_of_cells, variable_indices.size(), 0.0) };
+    for (auto property : { miam::AerosolProperty::EffectiveRadius,
+                           miam::AerosolProperty::NumberConcentration,
+                           miam::AerosolProperty::PhaseVolumeFraction })
+    {
+      auto provider = mode.template GetPropertyProvider<DenseMatrixPolicy>(
+          property, parameter_indices, variable_indices, "AQUEOUS");
+      state.values.emplace_back(number_of_cells, 1, 0.0);
+      const std::size_t number_of_columns = provider.NumberOfPartialsColumns();
+      state.partials.emplace_back(number_of_cells, std::max(number_of_columns, std::size_t(1)), 0.0);
+      state.providers.push_back(std::move(provider));
+    }
+    for (const auto& [name, value] : mode.DefaultParameters())
+      for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+        state.parameters[cell][parameter_indices.at(name)] = value;
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+      for (std::size_t i = 0; i < variable_indices.size(); ++i)
+        state.variables[cell][i] = 1.0e-3 * (1.0 + 0.01 * static_cast<double>(i) + 0.001 * static_cast<double>(cell));
+    if (auto it = variable_indices.find("MODE.NUMBER_CONCENTRATION"); it != variable_indices.end())
+      for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+        state.variables[cell][it->second] = 1.0e8;
+    return state;
+  }
+
+  template<typename DenseMatrixPolicy, typename Representation, bool TwoPass>
+  void BM_PropertyValueAndPartials(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_species = static_cast<std::size_t>(state.range(1));
+    auto properties = MakePropertyState<DenseMatrixPolicy, Representation>(number_of_cells, number_of_species);
+
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < properties.providers.size(); ++i)
+      {
+        const auto& provider = properties.providers[i];
+        if constexpr (TwoPass)
+          provider.ComputeValue(properties.parameters, properties.variables, properties.values[i]);
+        provider.ComputeValueAndDerivatives(
+            properties.parameters, properties.variables, properties.values[i], properties.partials[i]);
+        benchmark::DoNotOptimize(properties.partials[i].AsVector().data());
+      }
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  void PropertyArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "species" });
+    for (int cells : { 1, 1024 })
+      for (int species : { 2, 8, 32 })
+        b->Args({ cells, species });
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::Matrix<double>, miam::TwoMomentMode, true)
+    ->Apply(PropertyArguments);
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::Matrix<double>, miam::TwoMomentMode, false)
+    ->Apply(PropertyArguments);
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::VectorMatrix<double, 4>, miam::TwoMomentMode, true)
+    ->Apply(PropertyArguments);
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::VectorMatrix<double, 4>, miam::TwoMomentMode, false)
+    ->Apply(PropertyArguments);
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::Matrix<double>, miam::SingleMomentMode, true)
+    ->Apply(PropertyArguments);
+BENCHMARK_TEMPLATE(BM_PropertyValueAndPartials, micm::Matrix<double>, miam::SingleMomentMode, false)
+    ->Apply(PropertyArguments);
@@ -0,0 +1,461 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Shared helpers for the MIAM benchmark suite.
+
+#pragma once
+
+#include <miam/miam.hpp>
+
+#include <micm/system/conditions.hpp>
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/constants.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace miam_benchmark
+{
+  /// @brief State index maps built from a Model in deterministic (sorted-name) order
+  struct IndexMaps
+  {
+    std::unordered_map<std::string, std::size_t> variable_indices;
+    std::unordered_map<std::string, std::size_t> parameter_indices;
+    std::size_t num_variables;
+    std::size_t num_parameters;
+  };
+
+  /// @brief Builds variable and parameter index maps for a model
+  inline IndexMaps BuildIndexMaps(const miam::Model& model)
+  {
+    IndexMaps result;
+    auto var_names = model.StateVariableNames();
+    auto species_used = model.SpeciesUsed();
+    var_names.insert(species_used.begin(), species_used.end());
+    auto param_names = model.StateParameterNames();
+    auto constraint_param_names = model.ConstraintStateParameterNames();
+    param_names.insert(constraint_param_names.begin(), constraint_param_names.end());
+    auto init_param_names = model.InitializeConstraintParameterNames();
+    param_names.insert(init_param_names.begin(), init_param_names.end());
+
+    std::size_t idx = 0;
+    for (const auto& name : var_names)
+      result.variable_indices[name] = idx++;
+    result.num_variables = idx;
+
+    idx = 0;
+    for (const auto& name : param_names)
+      result.parameter_indices[name] = idx++;
+    result.num_parameters = idx;
+
+    return result;
+  }
+
+  /// @brief Fills a state matrix with distinct, positive, cell-dependent values
+  template<typename DenseMatrixPolicy>
+  void FillPositive(DenseMatrixPolicy& matrix, double base)
+  {
+    for (std::size_t i_cell = 0; i_cell < matrix.NumRows(); ++i_cell)
+      for (std::size_t i = 0; i < matrix.NumColumns(); ++i)
+        matrix[i_cell][i] = base * (1.0 + 0.01 * static_cast<double>(i) + 0.001 * static_cast<double>(i_cell));
+  }
+
+  /// @brief Reaction-order pattern of a synthetic mechanism
+  enum class ReactionOrders
+  {
+    Bimolecular,  ///< (i, i+1) -> (i+2); every third reaction is reversible
+    Mixed         ///< (i % 3) + 1 reactants and (i % 2) + 1 products; every fourth reaction is reversible
+  };
+
+  /// @brief Builds a synthetic aqueous mass-action mechanism
+  /// @details Creates `number_of_modes` single-moment modes sharing one aqueous phase with
+  ///          `number_of_species` solutes and water. By default each reaction i couples solutes
+  ///          (i, i+1) -> (i+2) and every third reaction is reversible; ReactionOrders::Mixed
+  ///          cycles through first- to third-order reactions instead.
+  inline miam::Model BuildSyntheticAqueousModel(
+      std::size_t number_of_species,
+      std::size_t number_of_reactions,
+      std::size_t number_of_modes,
+      ReactionOrders orders = ReactionOrders::Bimolecular)
+  {
+    auto h2o = micm::Species{ "H2O",
+                              { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    std::vector<micm::Species> solutes;
+    std::vector<micm::PhaseSpecies> phase_species{ { h2o } };
+    for (std::size_t i = 0; i < number_of_species; ++i)
+    {
+      solutes.push_back(micm::Species{ "X" + std::to_string(i),
+                                       { { "molecular weight [kg mol-1]", 0.05 }, { "density [kg m-3]", 1500.0 } } });
+      phase_species.push_back({ solutes.back() });
+    }
+    micm::Phase aqueous{ "AQUEOUS", phase_species };
+
+    miam::Model model;
+    model.name_ = "BENCHMARK";
+    std::vector<std::string> prefixes;
+    for (std::size_t m = 0; m < number_of_modes; ++m)
+    {
+      prefixes.push_back("MODE" + std::to_string(m));
+      model.representations_.push_back(miam::SingleMomentMode{ prefixes.back(), { aqueous }, 1.0e-6, 1.5 });
+    }
+
+    for (std::size_t r = 0; r < number_of_reactions; ++r)
+    {
+      const double k = 1.0e-3 * static_cast<double>(r + 1);
+      std::map<std::string, miam::RateConstant> forward;
+      std::map<std::string, miam::RateConstant> reverse;
+      for (const auto& prefix : prefixes)
+      {
+        forward.emplace(prefix, k);
+        reverse.emplace(prefix, 0.5 * k);
+      }
+      const bool mixed = orders == ReactionOrders::Mixed;
+      const std::size_t number_of_reactants = mixed ? r % 3 + 1 : 2;
+      const std::size_t number_of_products = mixed ? r % 2 + 1 : 1;
+      const bool reversible = mixed ? r % 4 == 3 : r % 3 == 2;
+      std::vector<micm::Species> reactants;
+      std::vector<micm::Species> products;
+      for (std::size_t i = 0; i < number_of_reactants; ++i)
+        reactants.push_back(solutes[(r + i) % number_of_species]);
+      for (std::size_t i = 0; i < number_of_products; ++i)
+        products.push_back(solutes[(r + number_of_reactants + i) % number_of_species]);
+      if (reversible)
+        model.AddProcesses(miam::DissolvedReversibleReaction{ forward, reverse, reactants, products, h2o, aqueous });
+      else
+        model.AddProcesses(miam::DissolvedReaction{ forward, reactants, products, h2o, aqueous });
+    }
+    return model;
+  }
+
+  /// @brief Builds a synthetic gas-aqueous phase-transfer mechanism on a sectional distribution
+  /// @details Creates one SectionalDistribution with `number_of_bins` log-spaced bins of an aqueous
+  ///          phase holding water and one solute per gas species, and one HenryLawPhaseTransfer per
+  ///          gas species. Every transfer process therefore spans `number_of_bins` phase instances.
+  inline miam::Model BuildSyntheticPhaseTransferModel(std::size_t number_of_gas_species, std::size_t number_of_bins)
+  {
+    auto h2o = micm::Species{ "H2O",
+                              { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    std::vector<micm::Species> gases;
+    std::vector<micm::Species> solutes;
+    std::vector<micm::PhaseSpecies> phase_species{ { h2o } };
+    for (std::size_t i = 0; i < number_of_gas_species; ++i)
+    {
+      gases.push_back(micm::Species{ "G" + std::to_string(i), { { "molecular weight [kg mol-1]", 0.044 } } });
+      solutes.push_back(micm::Species{ "G" + std::to_string(i) + "_aq",
+                                       { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } });
+      phase_species.push_back({ solutes.back() });
+    }
+    micm::Phase aqueous{ "AQUEOUS", phase_species };
+
+    miam::Model model;
+    model.name_ = "BENCHMARK";
+    model.representations_.push_back(miam::SectionalDistribution{ "CLOUD", { aqueous }, number_of_bins, 1.0e-7, 1.0e-4 });
+    for (std::size_t i = 0; i < number_of_gas_species; ++i)
+    {
+      const double hlc = 1.0e-2 * static_cast<double>(i + 1);
+      model.AddProcesses(miam::HenryLawPhaseTransfer{ [hlc](const micm::Conditions&) { return hlc; },
+                                                      gases[i],
+                                                      solutes[i],
+                                                      h2o,
+                                                      aqueous,
+                                                      1.5e-5,
+                                                      0.05,
+                                                      0.044,
+                                                      0.018,
+                                                      1000.0 });
+    }
+    return model;
+  }
+
+  /// @brief A Model and the gas phase a micm solver is built around
+  struct Mechanism
+  {
+    miam::Model model;
+    micm::Phase gas_phase;
+  };
+
+  /// @brief Inputs of the Model functions for a grid of cells, with the member names of micm::State
+  /// @details Lets the representation SetDefaultParameters() and the initial-state helpers below fill
+  ///          the inputs of a function-level benchmark exactly as they fill a solver state.
+  template<typename DenseMatrixPolicy>
+  struct FunctionState
+  {
+    std::unordered_map<std::string, std::size_t> variable_map_;
+    std::unordered_map<std::string, std::size_t> custom_rate_parameter_map_;
+    DenseMatrixPolicy variables_;
+    DenseMatrixPolicy custom_rate_parameters_;
+    std::vector<micm::Conditions> conditions_;
+  };
+
+  /// @brief Creates zeroed function inputs for a model, at 298.15 K and 101325 Pa in every cell
+  template<typename DenseMatrixPolicy>
+  FunctionState<DenseMatrixPolicy> MakeFunctionState(const IndexMaps& maps, std::size_t number_of_cells)
+  {
+    FunctionState<DenseMatrixPolicy> state{ maps.variable_indices,
+                                            maps.parameter_indices,
+                                            DenseMatrixPolicy(number_of_cells, maps.num_variables, 0.0),
+                                            DenseMatrixPolicy(number_of_cells, maps.num_parameters, 0.0),
+                                            std::vector<micm::Conditions>(number_of_cells) };
+    for (auto& conditions : state.conditions_)
+    {
+      conditions.temperature_ = 298.15;
+      conditions.pressure_ = 101325.0;
+      conditions.CalculateIdealAirDensity();
+    }
+    return state;
+  }
+
+  /// @brief Sets the default parameters of every representation of a model for all grid cells
+  template<typename StatePolicy>
+  void SetDefaultParameters(const miam::Model& model, StatePolicy& state)
+  {
+    for (const auto& representation : model.representations_)
+      std::visit([&](const auto& r) { r.SetDefaultParameters(state); }, representation);
+  }
+
+  // Constants of the carbonic acid mechanism (test/integration/test_aqueous_carbonic_acid.cpp)
+  namespace carbonic_acid
+  {
+    constexpr double kWaterMolarity = 55.556;                              // mol L-1
+    constexpr double kHenryLawConstant = 3.4e-2 * 1000.0 / 101325.0;       // mol m-3 Pa-1
+    constexpr double kK1 = 4.3e-7 / kWaterMolarity;                        // CO2_aq <-> H+ + HCO3-
+    constexpr double kK2 = 4.7e-11 / kWaterMolarity;                       // HCO3- <-> H+ + CO3--
+    constexpr double kKw = 1.0e-14 / (kWaterMolarity * kWaterMolarity);    // H2O <-> H+ + OH-
+    constexpr double kK1Forward = 0.1;                                     // s-1
+    constexpr double kK2Forward = 5.0;                                     // s-1
+    constexpr double kKwForward = 1.0e-6;                                  // s-1
+    constexpr double kTemperature = 298.15;                                // K
+    constexpr double kPressure = 101325.0;                                 // Pa
+    constexpr double kWater = 0.017;                                       // mol m-3 air
+  }  // namespace carbonic_acid
+
+  /// @brief Builds the kinetic carbonic acid mechanism of the aqueous carbonic acid integration test
+  /// @details CO2 phase transfer and the reversible CO2(aq), HCO3- and water dissociations on
+  ///          `number_of_modes` single-moment droplet modes (DROPLET0, DROPLET1, ...).
+  inline Mechanism BuildCarbonicAcidMechanism(std::size_t number_of_modes)
+  {
+    using namespace carbonic_acid;
+    micm::Species co2_g{ "CO2_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+    micm::Species co2_aq{ "CO2_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Species hco3m{ "HCO3-", { { "molecular weight [kg mol-1]", 0.061 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Species co3mm{ "CO3--", { { "molecular weight [kg mol-1]", 0.060 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Species hp{ "H+", { { "molecular weight [kg mol-1]", 0.001 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Species ohm{ "OH-", { { "molecular weight [kg mol-1]", 0.017 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Species h2o{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Phase aqueous{ "AQUEOUS", { { co2_aq }, { hco3m }, { co3mm }, { hp }, { ohm }, { h2o } } };
+
+    Mechanism mechanism{ miam::Model{}, micm::Phase{ "GAS", { { co2_g } } } };
+    mechanism.model.name_ = "CARBONIC_ACID";
+    std::map<std::string, miam::RateConstant> k1_f, k1_r, k2_f, k2_r, kw_f, kw_r;
+    for (std::size_t m = 0; m < number_of_modes; ++m)
+    {
+      const std::string prefix = "DROPLET" + std::to_string(m);
+      mechanism.model.representations_.push_back(miam::SingleMomentMode{ prefix, { aqueous }, 5.0e-6, 1.2 });
+      k1_f.emplace(prefix, kK1Forward);
+      k1_r.emplace(prefix, kK1Forward / kK1);
+      k2_f.emplace(prefix, kK2Forward);
+      k2_r.emplace(prefix, kK2Forward / kK2);
+      kw_f.emplace(prefix, kKwForward);
+      kw_r.emplace(prefix, kKwForward / kKw);
+    }
+    mechanism.model.AddProcesses(
+        miam::HenryLawPhaseTransferBuilder()
+            .SetCondensedPhase(aqueous)
+            .SetGasSpecies(co2_g)
+            .SetCondensedSpecies(co2_aq)
+            .SetSolvent(h2o)
+            .SetHenryLawConstant(miam::HenryLawConstant(miam::HenryLawConstantParameters{ .HLC_ref_ = kHenryLawConstant }))
+            .SetDiffusionCoefficient(1.5e-5)
+            .SetAccommodationCoefficient(0.05)
+            .Build(),
+        miam::DissolvedReversibleReaction{ k1_f, k1_r, { co2_aq }, { hp, hco3m }, h2o, aqueous },
+        miam::DissolvedReversibleReaction{ k2_f, k2_r, { hco3m }, { hp, co3mm }, h2o, aqueous },
+        miam::DissolvedReversibleReaction{ kw_f, kw_r, { h2o }, { hp, ohm }, h2o, aqueous });
+    return mechanism;
+  }
+
+  /// @brief Sets the far-from-equilibrium initial state of the carbonic acid integration test in every cell
+  template<typename StatePolicy>
+  void SetCarbonicAcidInitialState(const miam::Model& model, StatePolicy& state)
+  {
+    using namespace carbonic_acid;
+    const double co2_g = 400.0e-6 * kPressure / (micm::constants::GAS_CONSTANT * kTemperature);
+    for (std::size_t cell = 0; cell < state.variables_.NumRows(); ++cell)
+    {
+      state.conditions_[cell].temperature_ = kTemperature;
+      state.conditions_[cell].pressure_ = kPressure;
+      state.variables_[cell][state.variable_map_.at("CO2_g")] = co2_g;
+      for (const auto& [name, index] : state.variable_map_)
+      {
+        if (name.ends_with(".H2O"))
+          state.variables_[cell][index] = kWater;
+        else if (name.ends_with(".H+") || name.ends_with(".OH-"))
+          state.variables_[cell][index] = 1.0e-12;
+        else if (name != "CO2_g")
+          state.variables_[cell][index] = 0.0;
+      }
+    }
+    SetDefaultParameters(model, state);
+  }
+
+  /// @brief Builds the CAM cloud sulfate mechanism of the CAM cloud chemistry integration test
+  /// @details Henry's law and dissociation equilibria, sulfur/H2O2/O3 mass conservation, charge balance
+  ///          and the S(IV) oxidation kinetics. One bin is the test's UniformSection "CLOUD"; more bins use
+  ///          a SectionalDistribution "CLOUD" spanning 1 to 50 um, with every equilibrium, charge balance
+  ///          and reaction repeated per bin.
+  inline Mechanism BuildCamCloudMechanism(std::size_t number_of_bins)
+  {
+    constexpr double kAtmToPa = 1000.0 / 101325.0;  // M atm-1 -> mol m-3 Pa-1
+    constexpr double kWaterMolarity = 55.556;       // mol L-1
+
+    micm::Species so2_g{ "SO2" }, h2o2_g{ "H2O2" }, o3_g{ "O3" };
+    micm::Species so2_aq{ "SO2_aq" }, h2o2_aq{ "H2O2_aq" }, o3_aq{ "O3_aq" }, hp{ "Hp" }, ohm{ "OHm" };
+    micm::Species hso3m{ "HSO3m" }, so3mm{ "SO3mm" }, so4mm{ "SO4mm" }, so2oohm{ "SO2OOHm" };
+    micm::Species h2o{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Phase gas{ "GAS", { so2_g, h2o2_g, o3_g } };
+    micm::Phase aqueous{ "AQUEOUS", { h2o, so2_aq, h2o2_aq, o3_aq, hp, ohm, hso3m, so3mm, so4mm, so2oohm } };
+
+    Mechanism mechanism{ miam::Model{}, gas };
+    mechanism.model.name_ = "CLOUD";
+    std::vector<std::string> prefixes;
+    if (number_of_bins <= 1)
+    {
+      mechanism.model.representations_.push_back(miam::UniformSection{ "CLOUD", { aqueous } });
+      prefixes.push_back("CLOUD");
+    }
+    else
+    {
+      miam::SectionalDistribution cloud{ "CLOUD", { aqueous }, number_of_bins, 1.0e-6, 5.0e-5 };
+      for (std::size_t bin = 0; bin < number_of_bins; ++bin)
+        prefixes.push_back(cloud.BinPrefix(bin));
+      mechanism.model.representations_.push_back(cloud);
+    }
+
+    auto henry = [&](const micm::Species& gas_species, const micm::Species& aqueous_species, double hlc, double c)
+    {
+      return miam::HenryLawEquilibriumConstraintBuilder()
+          .SetGasSpecies(gas_species)
+          .SetCondensedSpecies(aqueous_species)
+          .SetSolvent(h2o)
+          .SetCondensedPhase(aqueous)
+          .SetHenryLawConstant(miam::HenryLawConstant({ .HLC_ref_ = hlc * kAtmToPa, .C_ = c }))
+          .Build();
+    };
+    auto dissociation = [&](const micm::Species& reactant,
+                            const micm::Species& product,
+                            const micm::Species& algebraic,
+                            double k,
+                            double c)
+    {
+      return miam::DissolvedEquilibriumConstraintBuilder()
+          .SetPhase(aqueous)
+          .SetReactants({ reactant })
+          .SetProducts({ product, hp })
+          .SetAlgebraicSpecies(algebraic)
+          .SetSolvent(h2o)
+          .SetEquilibriumConstant(miam::EquilibriumConstant({ .A_ = k, .C_ = c }))
+          .Build();
+    };
+    auto arrhenius = [](double k298, double ea_over_r)
+    {
+      return [=](const micm::Conditions& conditions)
+      { return kWaterMolarity * k298 * std::exp(-ea_over_r * (1.0 / conditions.temperature_ - 1.0 / 298.0)); };
+    };
+
+    auto rxn1a = miam::DissolvedReversibleReactionBuilder()
+                     .SetPhase(aqueous)
+                     .SetReactants({ hso3m, h2o2_aq })
+                     .SetProducts({ so2oohm, h2o })
+                     .SetSolvent(h2o)
+                     .SetEquilibriumConstant(miam::EquilibriumConstant({ .A_ = 1725.0 }));
+    auto rxn1b = miam::DissolvedReactionBuilder().SetPhase(aqueous).SetReactants({ so2oohm, hp }).SetProducts({ so4mm });
+    auto rxn2 = miam::DissolvedReactionBuilder().SetPhase(aqueous).SetReactants({ hso3m, o3_aq }).SetProducts({ so4mm, hp });
+    auto rxn3 = miam::DissolvedReactionBuilder().SetPhase(aqueous).SetReactants({ so3mm, o3_aq }).SetProducts({ so4mm });
+    for (const auto& prefix : prefixes)
+    {
+      rxn1a.AddForwardRateConstant(
+          prefix, miam::EquilibriumConstant({ .A_ = kWaterMolarity * (7.45e7 / 13.0), .C_ = 4430.0 }));
+      rxn1b.AddRateConstant(prefix, arrhenius(2.4e6, 4430.0));
+      rxn2.AddRateConstant(prefix, arrhenius(3.75e5, 5530.0));
+      rxn3.AddRateConstant(prefix, arrhenius(1.59e9, 5280.0));
+    }
+    mechanism.model.AddProcesses(
+        rxn1a.Build(), rxn1b.SetSolvent(h2o).Build(), rxn2.SetSolvent(h2o).Build(), rxn3.SetSolvent(h2o).Build());
+
+    auto mass = [&](const micm::Species& gas_species, const std::vector<micm::Species>& aqueous_species)
+    {
+      auto builder = miam::LinearConstraintBuilder().SetAlgebraicSpecies(gas, gas_species).AddTerm(gas, gas_species, 1.0);
+      for (const auto& species : aqueous_species)
+        builder.AddTerm(aqueous, species, 1.0);
+      return builder.DiagnoseConstantFromState().Build();
+    };
+    mechanism.model.AddConstraints(
+        henry(so2_g, so2_aq, 1.23, 3120.0),
+        henry(h2o2_g, h2o2_aq, 7.4e4, 6621.0),
+        henry(o3_g, o3_aq, 1.15e-2, 2560.0),
+        miam::DissolvedEquilibriumConstraintBuilder()
+            .SetPhase(aqueous)
+            .SetReactants({ h2o })
+            .SetProducts({ hp, ohm })
+            .SetAlgebraicSpecies(ohm)
+            .SetSolvent(h2o)
+            .SetEquilibriumConstant(
+                miam::EquilibriumConstant({ .A_ = 1.0e-14 / (kWaterMolarity * kWaterMolarity), .C_ = 6710.0 }))
+            .Build(),
+        dissociation(so2_aq, hso3m, hso3m, 1.7e-2 / kWaterMolarity, 2090.0),
+        dissociation(hso3m, so3mm, so3mm, 6.0e-8 / kWaterMolarity, 1120.0),
+        mass(so2_g, { so2_aq, hso3m, so3mm, so4mm, so2oohm }),
+        mass(h2o2_g, { h2o2_aq }),
+        mass(o3_g, { o3_aq }),
+        miam::LinearConstraintBuilder()
+            .SetAlgebraicSpecies(aqueous, hp)
+            .AddTerm(aqueous, hp, 1.0)
+            .AddTerm(aqueous, ohm, -1.0)
+            .AddTerm(aqueous, hso3m, -1.0)
+            .AddTerm(aqueous, so3mm, -2.0)
+            .AddTerm(aqueous, so4mm, -2.0)
+            .AddTerm(aqueous, so2oohm, -1.0)
+            .SetConstant(0.0)
+            .Build());
+    return mechanism;
+  }
+
+  /// @brief Sets the naive cloudy initial state of the CAM cloud integration tests in every cell
+  /// @details Gas-phase SO2, H2O2 and O3 at typical mixing ratios, cloud water split evenly across the
+  ///          bins, dissolved species at zero, and H+ balancing the background sulfate.
+  template<typename StatePolicy>
+  void SetCamCloudInitialState(const miam::Model& model, StatePolicy& state)
+  {
+    std::size_t number_of_bins = 0;
+    for (const auto& [name, index] : state.variable_map_)
+      if (name.ends_with(".AQUEOUS.H2O"))
+        ++number_of_bins;
+    for (std::size_t cell = 0; cell < state.variables_.NumRows(); ++cell)
+    {
+      state.conditions_[cell].temperature_ = 280.0;
+      state.conditions_[cell].pressure_ = 70000.0;
+      state.conditions_[cell].CalculateIdealAirDensity();
+      for (const auto& [name, index] : state.variable_map_)
+      {
+        double value = 0.0;
+        if (name == "SO2" || name == "H2O2")
+          value = 3.01e-8;
+        else if (name == "O3")
+          value = 1.50e-6;
+        else if (name.ends_with(".H2O"))
+          value = 0.017 / static_cast<double>(number_of_bins);
+        else if (name.ends_with(".Hp") || name.ends_with(".SO4mm"))
+          value = 1.0 / static_cast<double>(number_of_bins);
+        state.variables_[cell][index] = value;
+      }
+    }
+    SetDefaultParameters(model, state);
+  }
+}  // namespace miam_benchmark
@@ -0,0 +1,138 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Per-cell cost of the Fuchs-Sutugin condensation rate: type-erased
+// CondensationRateProvider versus the FuchsSutuginKernel value type, and the
+// branch-free mean-free-path form over cell groups of width L.
+
+#include <miam/math/condensation_rate.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+  constexpr double D_g = 1.3e-5;
+  constexpr double alpha = 0.1;
+  constexpr double gas_molecular_weight = 0.064;
+
+  struct CellInputs
+  {
+    std::vector<double> r_eff;
+    std::vector<double> N;
+    std::vector<double> T;
+  };
+
+  CellInputs MakeInputs(std::size_t number_of_cells)
+  {
+    CellInputs inputs;
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+    {
+      inputs.r_eff.push_back(1.0e-8 * (1.0 + static_cast<double>(i % 100)));
+      inputs.N.push_back(1.0e8 * (1.0 + 0.01 * static_cast<double>(i % 7)));
+      inputs.T.push_back(250.0 + 0.5 * static_cast<double>(i % 80));
+    }
+    return inputs;
+  }
+
+  template<typename Rate>
+  void RunValue(benchmark::State& state, const Rate& rate)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto inputs = MakeInputs(number_of_cells);
+    std::vector<double> k_cond(number_of_cells, 0.0);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < number_of_cells; ++i)
+        k_cond[i] = rate.ComputeValue(inputs.r_eff[i], inputs.N[i], inputs.T[i]);
+      benchmark::DoNotOptimize(k_cond.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<typename Rate>
+  void RunValueAndDerivatives(benchmark::State& state, const Rate& rate)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto inputs = MakeInputs(number_of_cells);
+    std::vector<double> k_cond(number_of_cells, 0.0);
+    std::vector<double> dk_dr(number_of_cells, 0.0);
+    std::vector<double> dk_dN(number_of_cells, 0.0);
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < number_of_cells; ++i)
+        rate.ComputeValueAndDerivatives(inputs.r_eff[i], inputs.N[i], inputs.T[i], k_cond[i], dk_dr[i], dk_dN[i]);
+      benchmark::DoNotOptimize(k_cond.data());
+      benchmark::DoNotOptimize(dk_dr.data());
+      benchmark::DoNotOptimize(dk_dN.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  void BM_CondensationRateProvider(benchmark::State& state)
+  {
+    RunValue(state, miam::MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight));
+  }
+
+  void BM_FuchsSutuginKernel(benchmark::State& state)
+  {
+    RunValue(state, miam::MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight));
+  }
+
+  void BM_CondensationRateProviderDerivatives(benchmark::State& state)
+  {
+    RunValueAndDerivatives(state, miam::MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight));
+  }
+
+  void BM_FuchsSutuginKernelDerivatives(benchmark::State& state)
+  {
+    RunValueAndDerivatives(state, miam::MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight));
+  }
+
+  /// @brief Evaluates rates and derivatives from the mean free path in groups of L contiguous cells
+  /// @details Mirrors the ForEachRow loop HenryLawPhaseTransfer runs over a micm::VectorMatrix<double, L>
+  ///          cell group, with the mean free path precomputed per cell as a state parameter
+  template<std::size_t L>
+  void BM_FuchsSutuginKernelCellGroups(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto kernel = miam::MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+    auto inputs = MakeInputs(number_of_cells);
+    std::vector<double> mean_free_path(number_of_cells, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      mean_free_path[i] = kernel.MeanFreePath(inputs.T[i]);
+    std::vector<double> k_cond(number_of_cells, 0.0);
+    std::vector<double> dk_dr(number_of_cells, 0.0);
+    std::vector<double> dk_dN(number_of_cells, 0.0);
+    for (auto _ : state)
+    {
+      for (std::size_t offset = 0; offset < number_of_cells; offset += L)
+      {
+        const std::size_t width = std::min(L, number_of_cells - offset);
+        for (std::size_t i = offset; i < offset + width; ++i)
+          kernel.ComputeValueAndDerivativesFromMeanFreePath(
+              inputs.r_eff[i], inputs.N[i], mean_free_path[i], k_cond[i], dk_dr[i], dk_dN[i]);
+      }
+      benchmark::DoNotOptimize(k_cond.data());
+      benchmark::DoNotOptimize(dk_dr.data());
+      benchmark::DoNotOptimize(dk_dN.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+}  // namespace
+
+BENCHMARK(BM_CondensationRateProvider)->ArgName("cells")->Arg(1024)->Arg(65536);
+BENCHMARK(BM_FuchsSutuginKernel)->ArgName("cells")->Arg(1024)->Arg(65536);
+BENCHMARK(BM_CondensationRateProviderDerivatives)->ArgName("cells")->Arg(1024)->Arg(65536);
+BENCHMARK(BM_FuchsSutuginKernelDerivatives)->ArgName("cells")->Arg(1024)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_FuchsSutuginKernelCellGroups, 1)->ArgName("cells")->Arg(65536);
+BENCHMARK_TEMPLATE(BM_FuchsSutuginKernelCellGroups, 4)->ArgName("cells")->Arg(65536);
+BENCHMARK_TEMPLATE(BM_FuchsSutuginKernelCellGroups, 8)->ArgName("cells")->Arg(65536);
+BENCHMARK_TEMPLATE(BM_FuchsSutuginKernelCellGroups, 16)->ArgName("cells")->Arg(65536);
+BENCHMARK_TEMPLATE(BM_FuchsSutuginKernelCellGroups, 64)->ArgName("cells")->Arg(65536);
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares the per-process forcing path against the compiled (fused) forcing path
+// of miam::Model for a synthetic aqueous mass-action mechanism.
+
+#include "benchmark_util.hpp"
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+  template<typename DenseMatrixPolicy>
+  void RunForcing(benchmark::State& state, bool compiled)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_reactions = static_cast<std::size_t>(state.range(1));
+    const auto number_of_modes = static_cast<std::size_t>(state.range(2));
+
+    auto model = miam_benchmark::BuildSyntheticAqueousModel(20, number_of_reactions, number_of_modes);
+    model.options_.compiled_forcing_ = compiled;
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0e-3);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      forcing_fn(parameters, variables, forcing);
+      benchmark::DoNotOptimize(forcing.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * number_of_cells * number_of_reactions * number_of_modes));
+  }
+
+  template<typename DenseMatrixPolicy>
+  void BM_ForcingPerProcess(benchmark::State& state)
+  {
+    RunForcing<DenseMatrixPolicy>(state, false);
+  }
+
+  template<typename DenseMatrixPolicy>
+  void BM_ForcingCompiled(benchmark::State& state)
+  {
+    RunForcing<DenseMatrixPolicy>(state, true);
+  }
+
+  void ForcingArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "reactions", "modes" });
+    for (int cells : { 64, 1024 })
+      for (int reactions : { 10, 100 })
+        for (int modes : { 1, 8 })
+          b->Args({ cells, reactions, modes });
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ForcingPerProcess, micm::Matrix<double>)->Apply(ForcingArguments);
+BENCHMARK_TEMPLATE(BM_ForcingCompiled, micm::Matrix<double>)->Apply(ForcingArguments);
+BENCHMARK_TEMPLATE(BM_ForcingPerProcess, micm::VectorMatrix<double, 4>)->Apply(ForcingArguments);
+BENCHMARK_TEMPLATE(BM_ForcingCompiled, micm::VectorMatrix<double, 4>)->Apply(ForcingArguments);
@@ -0,0 +1,246 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the per-call cost of the functions miam::Model hands to the micm solver: state parameter
+// update, forcing, Jacobian, and the constraint residual and Jacobian. Each is run on three workloads:
+// the synthetic aqueous mechanism (parameterized over species, reactions and modes), the kinetic
+// carbonic acid mechanism of test_aqueous_carbonic_acid.cpp (over droplet modes), and the CAM cloud
+// sulfate mechanism of test_cam_cloud_chemistry.cpp (over sectional bins), for row-major (Standard)
+// and VectorMatrix layouts.
+
+#include "benchmark_util.hpp"
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+#include <micm/util/sparse_matrix_vector_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <set>
+#include <utility>
+
+namespace
+{
+  enum class Workload
+  {
+    Synthetic,     ///< range(1) species, range(2) reactions, range(3) modes
+    CarbonicAcid,  ///< range(1) droplet modes
+    CamCloud       ///< range(1) cloud bins
+  };
+
+  miam::Model BuildWorkload(Workload workload, const benchmark::State& state)
+  {
+    const auto size = static_cast<std::size_t>(state.range(1));
+    switch (workload)
+    {
+      case Workload::Synthetic:
+        return miam_benchmark::BuildSyntheticAqueousModel(
+            size, static_cast<std::size_t>(state.range(2)), static_cast<std::size_t>(state.range(3)));
+      case Workload::CarbonicAcid: return miam_benchmark::BuildCarbonicAcidMechanism(size).model;
+      default: return miam_benchmark::BuildCamCloudMechanism(size).model;
+    }
+  }
+
+  /// @brief Fills the function inputs of a workload and updates its state parameters
+  template<typename DenseMatrixPolicy>
+  miam_benchmark::FunctionState<DenseMatrixPolicy> MakeInputs(
+      Workload workload,
+      const miam::Model& model,
+      const miam_benchmark::IndexMaps& maps,
+      std::size_t number_of_cells)
+  {
+    auto inputs = miam_benchmark::MakeFunctionState<DenseMatrixPolicy>(maps, number_of_cells);
+    switch (workload)
+    {
+      case Workload::Synthetic:
+        miam_benchmark::FillPositive(inputs.variables_, 1.0e-2);
+        miam_benchmark::FillPositive(inputs.custom_rate_parameters_, 1.0e-3);
+        miam_benchmark::SetDefaultParameters(model, inputs);
+        break;
+      case Workload::CarbonicAcid: miam_benchmark::SetCarbonicAcidInitialState(model, inputs); break;
+      case Workload::CamCloud: miam_benchmark::SetCamCloudInitialState(model, inputs); break;
+    }
+    model.UpdateStateParametersFunction<DenseMatrixPolicy>(maps.parameter_indices)(
+        inputs.conditions_, inputs.custom_rate_parameters_);
+    model.ConstraintUpdateStateParametersFunction<DenseMatrixPolicy>(maps.parameter_indices)(
+        inputs.conditions_, inputs.custom_rate_parameters_);
+    return inputs;
+  }
+
+  template<typename SparseMatrixPolicy>
+  SparseMatrixPolicy MakeJacobian(
+      const std::set<std::pair<std::size_t, std::size_t>>& elements,
+      std::size_t number_of_variables,
+      std::size_t number_of_cells)
+  {
+    auto builder =
+        SparseMatrixPolicy::Create(number_of_variables).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+    for (const auto& element : elements)
+      builder = builder.WithElement(element.first, element.second);
+    return SparseMatrixPolicy(builder);
+  }
+
+  template<Workload W, typename DenseMatrixPolicy>
+  void BM_UpdateStateParameters(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto model = BuildWorkload(W, state);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+    auto inputs = MakeInputs<DenseMatrixPolicy>(W, model, maps, number_of_cells);
+
+    auto update_fn = model.UpdateStateParametersFunction<DenseMatrixPolicy>(maps.parameter_indices);
+
+    for (auto _ : state)
+    {
+      update_fn(inputs.conditions_, inputs.custom_rate_parameters_);
+      benchmark::DoNotOptimize(inputs.custom_rate_parameters_.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<Workload W, typename DenseMatrixPolicy>
+  void BM_Forcing(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto model = BuildWorkload(W, state);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+    auto inputs = MakeInputs<DenseMatrixPolicy>(W, model, maps, number_of_cells);
+    DenseMatrixPolicy forcing(number_of_cells, maps.num_variables, 0.0);
+
+    auto forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      forcing_fn(inputs.custom_rate_parameters_, inputs.variables_, forcing);
+      benchmark::DoNotOptimize(forcing.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<Workload W, typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void BM_Jacobian(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto model = BuildWorkload(W, state);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+    auto inputs = MakeInputs<DenseMatrixPolicy>(W, model, maps, number_of_cells);
+    auto jacobian = MakeJacobian<SparseMatrixPolicy>(
+        model.NonZeroJacobianElements(maps.variable_indices), maps.num_variables, number_of_cells);
+
+    auto jacobian_fn = model.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        maps.parameter_indices, maps.variable_indices, jacobian);
+
+    for (auto _ : state)
+    {
+      jacobian_fn(inputs.custom_rate_parameters_, inputs.variables_, jacobian);
+      benchmark::DoNotOptimize(jacobian.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<typename DenseMatrixPolicy>
+  void BM_ConstraintResidual(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto model = BuildWorkload(Workload::CamCloud, state);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+    auto inputs = MakeInputs<DenseMatrixPolicy>(Workload::CamCloud, model, maps, number_of_cells);
+    DenseMatrixPolicy residual(number_of_cells, maps.num_variables, 0.0);
+
+    auto residual_fn = model.ConstraintResidualFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      residual_fn(inputs.variables_, inputs.custom_rate_parameters_, residual);
+      benchmark::DoNotOptimize(residual.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void BM_ConstraintJacobian(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    auto model = BuildWorkload(Workload::CamCloud, state);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+    auto inputs = MakeInputs<DenseMatrixPolicy>(Workload::CamCloud, model, maps, number_of_cells);
+    auto jacobian = MakeJacobian<SparseMatrixPolicy>(
+        model.NonZeroConstraintJacobianElements(maps.variable_indices), maps.num_variables, number_of_cells);
+
+    auto jacobian_fn = model.ConstraintJacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        maps.parameter_indices, maps.variable_indices, jacobian);
+
+    for (auto _ : state)
+    {
+      jacobian_fn(inputs.variables_, inputs.custom_rate_parameters_, jacobian);
+      benchmark::DoNotOptimize(jacobian.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  void SyntheticArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "species", "reactions", "modes" });
+    for (int cells : { 1, 1024 })
+      for (int species : { 10, 50 })
+        for (int reactions : { 10, 100 })
+          for (int modes : { 1, 8 })
+            b->Args({ cells, species, reactions, modes });
+  }
+
+  void CarbonicAcidArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "modes" });
+    for (int cells : { 1, 1024 })
+      for (int modes : { 1, 4, 16 })
+        b->Args({ cells, modes });
+  }
+
+  void CamCloudArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "bins" });
+    for (int cells : { 1, 1024 })
+      for (int bins : { 1, 4, 16 })
+        b->Args({ cells, bins });
+  }
+
+  using StandardMatrix = micm::Matrix<double>;
+  using StandardSparseMatrix = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+  using VectorMatrix = micm::VectorMatrix<double, 4>;
+  using VectorSparseMatrix = micm::SparseMatrix<double, micm::SparseMatrixVectorOrderingCompressedSparseRow<4>>;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::Synthetic, StandardMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::Synthetic, VectorMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::CarbonicAcid, StandardMatrix)->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::CarbonicAcid, VectorMatrix)->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::CamCloud, StandardMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_UpdateStateParameters, Workload::CamCloud, VectorMatrix)->Apply(CamCloudArguments);
+
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::Synthetic, StandardMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::Synthetic, VectorMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::CarbonicAcid, StandardMatrix)->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::CarbonicAcid, VectorMatrix)->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::CamCloud, StandardMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_Forcing, Workload::CamCloud, VectorMatrix)->Apply(CamCloudArguments);
+
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::Synthetic, StandardMatrix, StandardSparseMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::Synthetic, VectorMatrix, VectorSparseMatrix)->Apply(SyntheticArguments);
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::CarbonicAcid, StandardMatrix, StandardSparseMatrix)
+    ->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::CarbonicAcid, VectorMatrix, VectorSparseMatrix)->Apply(CarbonicAcidArguments);
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::CamCloud, StandardMatrix, StandardSparseMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_Jacobian, Workload::CamCloud, VectorMatrix, VectorSparseMatrix)->Apply(CamCloudArguments);
+
+BENCHMARK_TEMPLATE(BM_ConstraintResidual, StandardMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_ConstraintResidual, VectorMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_ConstraintJacobian, StandardMatrix, StandardSparseMatrix)->Apply(CamCloudArguments);
+BENCHMARK_TEMPLATE(BM_ConstraintJacobian, VectorMatrix, VectorSparseMatrix)->Apply(CamCloudArguments);
@@ -0,0 +1,149 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the per-call cost of the HenryLawPhaseTransfer forcing and Jacobian of miam::Model
+// as the number of phase instances (sectional bins) each transfer process spans grows. The
+// single-cell cases expose the fixed per-call overhead of walking the instances. The threaded
+// cases measure the scaling of the forcing evaluated on blocks of grid cells (ModelOptions::thread_pool_)
+// and, for few cells, on concurrent process groups (ModelOptions::process_parallel_forcing_).
+
+#include "benchmark_util.hpp"
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace
+{
+  constexpr std::size_t kNumberOfGasSpecies = 4;
+
+  template<typename DenseMatrixPolicy>
+  void BM_PhaseTransferForcing(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_bins = static_cast<std::size_t>(state.range(1));
+
+    auto model = miam_benchmark::BuildSyntheticPhaseTransferModel(kNumberOfGasSpecies, number_of_bins);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      forcing_fn(parameters, variables, forcing);
+      benchmark::DoNotOptimize(forcing.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells * number_of_bins));
+  }
+
+  template<typename DenseMatrixPolicy, bool ProcessParallel>
+  void BM_PhaseTransferForcingThreads(benchmark::State& state)
+  {
+    constexpr std::size_t kNumberOfBins = 16;
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_threads = static_cast<std::size_t>(state.range(1));
+
+    // Process groups need independent processes, so the process-parallel case uses more gas species
+    auto model = miam_benchmark::BuildSyntheticPhaseTransferModel(
+        ProcessParallel ? 4 * kNumberOfGasSpecies : kNumberOfGasSpecies, kNumberOfBins);
+    model.options_.thread_pool_ = std::make_shared<miam::ThreadPool>(number_of_threads);
+    model.options_.process_parallel_forcing_ = ProcessParallel;
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      forcing_fn(parameters, variables, forcing);
+      benchmark::DoNotOptimize(forcing.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells * kNumberOfBins));
+  }
+
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void BM_PhaseTransferJacobian(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_bins = static_cast<std::size_t>(state.range(1));
+
+    auto model = miam_benchmark::BuildSyntheticPhaseTransferModel(kNumberOfGasSpecies, number_of_bins);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto builder = SparseMatrixPolicy::Create(maps.num_variables).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+    for (const auto& element : model.NonZeroJacobianElements(maps.variable_indices))
+      builder = builder.WithElement(element.first, element.second);
+    SparseMatrixPolicy jacobian(builder);
+
+    auto jacobian_fn = model.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        maps.parameter_indices, maps.variable_indices, jacobian);
+
+    for (auto _ : state)
+    {
+      jacobian_fn(parameters, variables, jacobian);
+      benchmark::DoNotOptimize(jacobian.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells * number_of_bins));
+  }
+
+  void PhaseTransferArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "bins" });
+    for (int cells : { 1, 1024 })
+      for (int bins : { 1, 4, 16, 64 })
+        b->Args({ cells, bins });
+  }
+
+  void PhaseTransferThreadArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "threads" });
+    for (int threads : { 1, 2, 4, 8 })
+      b->Args({ 4096, threads });
+    b->UseRealTime();
+  }
+
+  void PhaseTransferProcessThreadArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "threads" });
+    for (int cells : { 1, 16 })
+      for (int threads : { 1, 2, 4, 8 })
+        b->Args({ cells, threads });
+    b->UseRealTime();
+  }
+
+  using SparseMatrixStandard = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PhaseTransferForcing, micm::Matrix<double>)->Apply(PhaseTransferArguments);
+BENCHMARK_TEMPLATE(BM_PhaseTransferForcing, micm::VectorMatrix<double, 4>)->Apply(PhaseTransferArguments);
+BENCHMARK_TEMPLATE(BM_PhaseTransferForcingThreads, micm::Matrix<double>, false)->Apply(PhaseTransferThreadArguments);
+BENCHMARK_TEMPLATE(BM_PhaseTransferForcingThreads, micm::VectorMatrix<double, 4>, false)
+    ->Apply(PhaseTransferThreadArguments);
+BENCHMARK_TEMPLATE(BM_PhaseTransferForcingThreads, micm::Matrix<double>, true)
+    ->Apply(PhaseTransferProcessThreadArguments);
+BENCHMARK_TEMPLATE(BM_PhaseTransferJacobian, micm::Matrix<double>, SparseMatrixStandard)->Apply(PhaseTransferArguments);
@@ -0,0 +1,146 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures the solvent-normalization power (S+δ)^n of the dissolved-reaction kernels with the
+// reaction order fixed at compile time versus std::pow, and the per-process forcing and Jacobian
+// of miam::Model on a synthetic mechanism that mixes first- to third-order reactions.
+
+#include "benchmark_util.hpp"
+
+#include <miam/math/reaction_order.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+  template<int Order>
+  void BM_SolventNormalization(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto order = static_cast<std::size_t>(state.range(1));
+    constexpr double eps = 1.0e-20;
+    std::vector<double> k(number_of_cells);
+    std::vector<double> solvent(number_of_cells);
+    std::vector<double> rate(number_of_cells, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+    {
+      k[i] = 1.0e-3 * (1.0 + 0.001 * static_cast<double>(i));
+      solvent[i] = 55.0 * (1.0 + 0.001 * static_cast<double>(i));
+    }
+
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < number_of_cells; ++i)
+        rate[i] = k[i] * solvent[i] / miam::ReactionOrderPower<Order>(solvent[i] + eps, order);
+      benchmark::DoNotOptimize(rate.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  void SolventNormalizationArguments(benchmark::internal::Benchmark* b, int order)
+  {
+    b->ArgNames({ "cells", "order" });
+    for (int cells : { 64, 1024, 16384 })
+      b->Args({ cells, order });
+  }
+
+  template<typename DenseMatrixPolicy>
+  void BM_MixedOrderForcing(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_reactions = static_cast<std::size_t>(state.range(1));
+    const auto number_of_modes = static_cast<std::size_t>(state.range(2));
+
+    auto model = miam_benchmark::BuildSyntheticAqueousModel(
+        20, number_of_reactions, number_of_modes, miam_benchmark::ReactionOrders::Mixed);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0e-3);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(maps.parameter_indices, maps.variable_indices);
+
+    for (auto _ : state)
+    {
+      forcing_fn(parameters, variables, forcing);
+      benchmark::DoNotOptimize(forcing.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * number_of_cells * number_of_reactions * number_of_modes));
+  }
+
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void BM_MixedOrderJacobian(benchmark::State& state)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_reactions = static_cast<std::size_t>(state.range(1));
+    const auto number_of_modes = static_cast<std::size_t>(state.range(2));
+
+    auto model = miam_benchmark::BuildSyntheticAqueousModel(
+        20, number_of_reactions, number_of_modes, miam_benchmark::ReactionOrders::Mixed);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    DenseMatrixPolicy parameters(number_of_cells, maps.num_parameters, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, maps.num_variables, 0.0);
+    miam_benchmark::FillPositive(parameters, 1.0e-3);
+    miam_benchmark::FillPositive(variables, 1.0e-2);
+
+    auto builder = SparseMatrixPolicy::Create(maps.num_variables).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+    for (const auto& element : model.NonZeroJacobianElements(maps.variable_indices))
+      builder = builder.WithElement(element.first, element.second);
+    SparseMatrixPolicy jacobian(builder);
+
+    auto jacobian_fn = model.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        maps.parameter_indices, maps.variable_indices, jacobian);
+
+    for (auto _ : state)
+    {
+      jacobian_fn(parameters, variables, jacobian);
+      benchmark::DoNotOptimize(jacobian.AsVector().data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * number_of_cells * number_of_reactions * number_of_modes));
+  }
+
+  void MixedOrderArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "reactions", "modes" });
+    for (int cells : { 64, 1024 })
+      for (int reactions : { 12, 120 })
+        for (int modes : { 1, 8 })
+          b->Args({ cells, reactions, modes });
+  }
+
+  using SparseMatrixStandard = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SolventNormalization, miam::kGenericReactionOrder)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 1); });
+BENCHMARK_TEMPLATE(BM_SolventNormalization, 1)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 1); });
+BENCHMARK_TEMPLATE(BM_SolventNormalization, miam::kGenericReactionOrder)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 2); });
+BENCHMARK_TEMPLATE(BM_SolventNormalization, 2)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 2); });
+BENCHMARK_TEMPLATE(BM_SolventNormalization, miam::kGenericReactionOrder)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 3); });
+BENCHMARK_TEMPLATE(BM_SolventNormalization, 3)
+    ->Apply([](benchmark::internal::Benchmark* b) { SolventNormalizationArguments(b, 3); });
+
+BENCHMARK_TEMPLATE(BM_MixedOrderForcing, micm::Matrix<double>)->Apply(MixedOrderArguments);
+BENCHMARK_TEMPLATE(BM_MixedOrderForcing, micm::VectorMatrix<double, 4>)->Apply(MixedOrderArguments);
+BENCHMARK_TEMPLATE(BM_MixedOrderJacobian, micm::Matrix<double>, SparseMatrixStandard)->Apply(MixedOrderArguments);
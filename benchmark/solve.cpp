@@ -0,0 +1,162 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures end-to-end micm Rosenbrock solves of miam::Model mechanisms: the kinetic carbonic acid
+// ODE system of test_aqueous_carbonic_acid.cpp (over droplet modes) and the CAM cloud sulfate DAE
+// system of test_cam_cloud_chemistry.cpp (over sectional bins), for the Standard and VectorMatrix
+// solver layouts. Every iteration restarts from the integration tests' far-from-equilibrium initial
+// state, so the timings include the stiff initial transient.
+
+#include "benchmark_util.hpp"
+
+#include <micm/CPU.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace
+{
+  /// @brief Builds a micm solver for a mechanism with the Standard layout
+  struct StandardLayout
+  {
+    static auto Build(const miam_benchmark::Mechanism& mechanism, const micm::RosenbrockSolverParameters& parameters)
+    {
+      return micm::CpuSolverBuilder<micm::RosenbrockSolverParameters>(parameters)
+          .SetSystem(micm::System(mechanism.gas_phase))
+          .AddExternalModel(mechanism.model)
+          .SetIgnoreUnusedSpecies(true)
+          .Build();
+    }
+  };
+
+  /// @brief Builds a micm solver for a mechanism with the VectorMatrix layout (4 cells per group)
+  struct VectorLayout
+  {
+    static auto Build(const miam_benchmark::Mechanism& mechanism, const micm::RosenbrockSolverParameters& parameters)
+    {
+      return micm::CpuSolverBuilder<
+                 micm::RosenbrockSolverParameters,
+                 micm::VectorMatrix<double, 4>,
+                 micm::SparseMatrix<double, micm::SparseMatrixVectorOrdering<4>>>(parameters)
+          .SetSystem(micm::System(mechanism.gas_phase))
+          .AddExternalModel(mechanism.model)
+          .SetIgnoreUnusedSpecies(true)
+          .Build();
+    }
+  };
+
+  /// @brief Integrates a solver state with the step schedule of the CAM cloud integration tests
+  /// @return Number of Rosenbrock steps taken, or 0 if a solve failed
+  template<typename SolverPolicy, typename StatePolicy>
+  std::size_t IntegrateDAE(SolverPolicy& solver, StatePolicy& state, double target_time)
+  {
+    std::size_t number_of_steps = 0;
+    double total_time = 0.0;
+    double dt = 0.001;
+    while (total_time < target_time - 1.0e-10)
+    {
+      double step = std::min(dt, target_time - total_time);
+      solver.UpdateStateParameters(state);
+      auto result = solver.Solve(step, state);
+      if (result.state_ != micm::SolverState::Converged)
+        return 0;
+      number_of_steps += result.stats_.number_of_steps_;
+      total_time += step;
+      for (double threshold : { 0.01, 0.1, 1.0, 10.0 })
+        if (total_time > threshold && dt < threshold)
+          dt = threshold;
+    }
+    return number_of_steps;
+  }
+
+  template<typename Layout>
+  void BM_SolveCarbonicAcid(benchmark::State& state)
+  {
+    constexpr double kTimeStep = 100.0;  // s; ten times the slowest (CO2 hydration) time scale
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_modes = static_cast<std::size_t>(state.range(1));
+
+    auto mechanism = miam_benchmark::BuildCarbonicAcidMechanism(number_of_modes);
+    auto parameters = micm::RosenbrockSolverParameters::ThreeStageRosenbrockParameters();
+    parameters.h_start_ = 1.0e-4;
+    parameters.h_max_ = 5.0;
+    parameters.max_number_of_steps_ = 1000000;
+    auto solver = Layout::Build(mechanism, parameters);
+    auto solver_state = solver.GetState(number_of_cells);
+
+    std::size_t number_of_steps = 0;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      miam_benchmark::SetCarbonicAcidInitialState(mechanism.model, solver_state);
+      state.ResumeTiming();
+      solver.UpdateStateParameters(solver_state);
+      auto result = solver.Solve(kTimeStep, solver_state);
+      if (result.state_ != micm::SolverState::Converged)
+      {
+        state.SkipWithError("carbonic acid solve did not converge");
+        break;
+      }
+      number_of_steps += result.stats_.number_of_steps_;
+      benchmark::DoNotOptimize(solver_state.variables_.AsVector().data());
+    }
+    state.counters["steps"] = benchmark::Counter(static_cast<double>(number_of_steps), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  template<typename Layout>
+  void BM_SolveCamCloud(benchmark::State& state)
+  {
+    constexpr double kTargetTime = 60.0;  // s; past the equilibration transient into steady oxidation
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_bins = static_cast<std::size_t>(state.range(1));
+
+    auto mechanism = miam_benchmark::BuildCamCloudMechanism(number_of_bins);
+    auto solver =
+        Layout::Build(mechanism, micm::RosenbrockSolverParameters::FourStageDifferentialAlgebraicRosenbrockParameters());
+    auto solver_state = solver.GetState(number_of_cells);
+
+    std::size_t number_of_steps = 0;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      miam_benchmark::SetCamCloudInitialState(mechanism.model, solver_state);
+      state.ResumeTiming();
+      const std::size_t steps = IntegrateDAE(solver, solver_state, kTargetTime);
+      if (steps == 0)
+      {
+        state.SkipWithError("CAM cloud solve did not converge");
+        break;
+      }
+      number_of_steps += steps;
+      benchmark::DoNotOptimize(solver_state.variables_.AsVector().data());
+    }
+    state.counters["steps"] = benchmark::Counter(static_cast<double>(number_of_steps), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells));
+  }
+
+  void CarbonicAcidSolveArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "modes" });
+    for (int cells : { 1, 64 })
+      for (int modes : { 1, 4 })
+        b->Args({ cells, modes });
+    b->Unit(benchmark::kMillisecond);
+  }
+
+  void CamCloudSolveArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "bins" });
+    for (int cells : { 1, 64 })
+      for (int bins : { 1, 4 })
+        b->Args({ cells, bins });
+    b->Unit(benchmark::kMillisecond);
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SolveCarbonicAcid, StandardLayout)->Apply(CarbonicAcidSolveArguments);
+BENCHMARK_TEMPLATE(BM_SolveCarbonicAcid, VectorLayout)->Apply(CarbonicAcidSolveArguments);
+BENCHMARK_TEMPLATE(BM_SolveCamCloud, StandardLayout)->Apply(CamCloudSolveArguments);
+BENCHMARK_TEMPLATE(BM_SolveCamCloud, VectorLayout)->Apply(CamCloudSolveArguments);
@@ -0,0 +1,67 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Measures solver setup time spent building the Jacobian sparsity pattern of miam::Model
+// as the number of modes (representation instances) and reactions grows.
+
+#include "benchmark_util.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+  constexpr std::size_t kNumberOfSpecies = 80;
+
+  void BM_JacobianSparsityPattern(benchmark::State& state)
+  {
+    const auto number_of_modes = static_cast<std::size_t>(state.range(0));
+    const auto number_of_reactions = static_cast<std::size_t>(state.range(1));
+
+    auto model = miam_benchmark::BuildSyntheticAqueousModel(
+        kNumberOfSpecies, number_of_reactions, number_of_modes, miam_benchmark::ReactionOrders::Mixed);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    std::size_t number_of_elements = 0;
+    for (auto _ : state)
+    {
+      auto pattern = model.JacobianSparsityPattern(maps.variable_indices);
+      number_of_elements = pattern.Size();
+      benchmark::DoNotOptimize(pattern);
+    }
+    state.counters["elements"] = static_cast<double>(number_of_elements);
+    state.SetComplexityN(static_cast<int64_t>(number_of_modes * number_of_reactions));
+  }
+
+  void BM_NonZeroJacobianElements(benchmark::State& state)
+  {
+    const auto number_of_modes = static_cast<std::size_t>(state.range(0));
+    const auto number_of_reactions = static_cast<std::size_t>(state.range(1));
+
+    auto model = miam_benchmark::BuildSyntheticAqueousModel(
+        kNumberOfSpecies, number_of_reactions, number_of_modes, miam_benchmark::ReactionOrders::Mixed);
+    auto maps = miam_benchmark::BuildIndexMaps(model);
+
+    std::size_t number_of_elements = 0;
+    for (auto _ : state)
+    {
+      auto elements = model.NonZeroJacobianElements(maps.variable_indices);
+      number_of_elements = elements.size();
+      benchmark::DoNotOptimize(elements);
+    }
+    state.counters["elements"] = static_cast<double>(number_of_elements);
+    state.SetComplexityN(static_cast<int64_t>(number_of_modes * number_of_reactions));
+  }
+
+  void SetupArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "modes", "reactions" });
+    for (int modes : { 1, 10, 40 })
+      for (int reactions : { 30, 100, 300 })
+        b->Args({ modes, reactions });
+    b->Unit(benchmark::kMicrosecond);
+    b->Complexity();
+  }
+}  // namespace
+
+BENCHMARK(BM_JacobianSparsityPattern)->Apply(SetupArguments);
+BENCHMARK(BM_NonZeroJacobianElements)->Apply(SetupArguments);
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Cost of evaluating van 't Hoff constants per grid cell: exact (exp) versus tabulated.
+// Mechanisms carry hundreds of constants, so each benchmark evaluates a set of distinct
+// constants for every cell; with many constants the tables compete for cache.
+
+#include <miam/processes/constants/equilibrium_constant.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace
+{
+  /// @brief Constants with C spread over 1000-8000 K, the range of typical equilibrium and Henry's law constants
+  std::vector<miam::EquilibriumConstant> MakeConstants(
+      std::size_t number_of_constants,
+      const std::optional<miam::VantHoffTableOptions>& table_options)
+  {
+    std::vector<miam::EquilibriumConstant> constants;
+    constants.reserve(number_of_constants);
+    for (std::size_t i = 0; i < number_of_constants; ++i)
+    {
+      miam::EquilibriumConstantParameters parameters{ .A_ = 1.0e-14,
+                                                      .C_ = 1000.0 + 7000.0 * static_cast<double>(i % 64) / 64.0 };
+      if (table_options)
+        constants.emplace_back(parameters, *table_options);
+      else
+        constants.emplace_back(parameters);
+    }
+    return constants;
+  }
+
+  void RunEquilibriumConstants(benchmark::State& state, const std::optional<miam::VantHoffTableOptions>& table_options)
+  {
+    const auto number_of_cells = static_cast<std::size_t>(state.range(0));
+    const auto number_of_constants = static_cast<std::size_t>(state.range(1));
+    auto constants = MakeConstants(number_of_constants, table_options);
+    std::vector<double> temperature(number_of_cells);
+    std::vector<double> result(number_of_cells * number_of_constants, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+    {
+      // Scattered temperatures in [200, 320) K
+      const auto position = static_cast<double>((i * 7919) % number_of_cells);
+      temperature[i] = 200.0 + 120.0 * position / static_cast<double>(number_of_cells);
+    }
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < number_of_cells; ++i)
+        for (std::size_t k = 0; k < number_of_constants; ++k)
+          result[i * number_of_constants + k] = constants[k].Calculate(temperature[i]);
+      benchmark::DoNotOptimize(result.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * number_of_cells * number_of_constants));
+  }
+
+  void BM_VantHoffExact(benchmark::State& state)
+  {
+    RunEquilibriumConstants(state, std::nullopt);
+  }
+
+  void BM_VantHoffTabulated(benchmark::State& state)
+  {
+    RunEquilibriumConstants(state, miam::VantHoffTableOptions{});
+  }
+
+  void BM_VantHoffTabulatedTight(benchmark::State& state)
+  {
+    RunEquilibriumConstants(state, miam::VantHoffTableOptions{ .relative_tolerance_ = 1.0e-10 });
+  }
+
+  void ConstantsArguments(benchmark::internal::Benchmark* b)
+  {
+    b->ArgNames({ "cells", "constants" });
+    for (int constants : { 1, 64, 512 })
+      b->Args({ 4096, constants });
+  }
+}  // namespace
+
+BENCHMARK(BM_VantHoffExact)->Apply(ConstantsArguments);
+BENCHMARK(BM_VantHoffTabulated)->Apply(ConstantsArguments);
+BENCHMARK(BM_VantHoffTabulatedTight)->Apply(ConstantsArguments);
@@ -28,6 +28,27 @@ if(MIAM_ENABLE_TESTS)
   endforeach()
 endif()
 
+################################################################################
+# Google benchmark
+
+if(MIAM_ENABLE_BENCHMARKS)
+  FetchContent_Declare(googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG v1.9.4
+    FIND_PACKAGE_ARGS NAMES benchmark
+  )
+
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
+################################################################################
+# Threads
+
+find_package(Threads REQUIRED)
+
 ################################################################################
 # MICM
 
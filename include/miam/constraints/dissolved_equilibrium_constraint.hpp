@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <miam/math/reaction_order.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -141,10 +143,20 @@ namespace miam
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> elements;
+      SparsityPattern elements;
+      AppendNonZeroConstraintJacobianElements(phase_prefixes, state_variable_indices, elements);
+      return elements.ToSet();
+    }
+
+    /// @brief Appends non-zero constraint Jacobian element positions to a sparsity pattern
+    void AppendNonZeroConstraintJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        SparsityPattern& elements) const
+    {
       auto phase_it = phase_prefixes.find(phase_.name_);
       if (phase_it == phase_prefixes.end())
-        return elements;
+        return;
 
       for (const auto& prefix : phase_it->second)
       {
@@ -153,17 +165,16 @@ namespace miam
         for (const auto& reactant : reactants_)
         {
           std::size_t col = state_variable_indices.at(prefix + "." + phase_.name_ + "." + reactant.name_);
-          elements.insert({ alg_row, col });
+          elements.Add(alg_row, col);
         }
         for (const auto& product : products_)
         {
           std::size_t col = state_variable_indices.at(prefix + "." + phase_.name_ + "." + product.name_);
-          elements.insert({ alg_row, col });
+          elements.Add(alg_row, col);
         }
         std::size_t solvent_col = state_variable_indices.at(prefix + "." + phase_.name_ + "." + solvent_.name_);
-        elements.insert({ alg_row, solvent_col });
+        elements.Add(alg_row, solvent_col);
       }
-      return elements;
     }
 
     /// @brief Returns the names of state parameters owned by this constraint (one per phase instance).
@@ -237,56 +248,70 @@ namespace miam
       DenseMatrixPolicy dummy_state{ 1, state_variable_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_params{ 1, std::max(state_parameter_indices.size(), std::size_t{ 1 }), 0.0 };
 
-      return DenseMatrixPolicy::Function(
-          [indices, k_eq_indices, n_reactants, n_products, eps](
-              auto&& state_variables, auto&& state_parameters, auto&& residual)
+      using ResidualFunctionType =
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>;
+      return DispatchReactionOrder(
+          n_reactants,
+          [&](auto reactant_order) -> ResidualFunctionType
           {
-            for (std::size_t i_phase = 0; i_phase < indices.number_of_phase_instances_; ++i_phase)
-            {
-              std::size_t alg_idx = indices.algebraic_indices_[i_phase];
-
-              // Forward part: K_eq * prod([R_i]) * [S] / ([S]+eps)^n_r
-              auto forward = residual.GetRowVariable();
-              residual.ForEachRow(
-                  [](const double& keq, double& fwd) { fwd = keq; },
-                  state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
-                  forward);
-              for (std::size_t r = 0; r < n_reactants; ++r)
-                residual.ForEachRow(
-                    [](const double& conc, double& fwd) { fwd *= conc; },
-                    state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][r]),
-                    forward);
-              residual.ForEachRow(
-                  [n_reactants, eps](const double& sol, double& fwd)
-                  { fwd *= sol / std::pow(sol + eps, static_cast<double>(n_reactants)); },
-                  state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                  forward);
-
-              // Reverse part: prod([P_j]) * [S] / ([S]+eps)^n_p
-              auto reverse = residual.GetRowVariable();
-              residual.ForEachRow([](double& rev) { rev = 1.0; }, reverse);
-              for (std::size_t p = 0; p < n_products; ++p)
-                residual.ForEachRow(
-                    [](const double& conc, double& rev) { rev *= conc; },
-                    state_variables.GetConstColumnView(indices.product_indices_[i_phase][p]),
-                    reverse);
-              residual.ForEachRow(
-                  [n_products, eps](const double& sol, double& rev)
-                  { rev *= sol / std::pow(sol + eps, static_cast<double>(n_products)); },
-                  state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                  reverse);
-
-              // G = forward - reverse
-              residual.ForEachRow(
-                  [](const double& fwd, const double& rev, double& res) { res = fwd - rev; },
-                  forward,
-                  reverse,
-                  residual.GetColumnView(alg_idx));
-            }
-          },
-          dummy_state,
-          dummy_params,
-          dummy_state);
+            return DispatchReactionOrder(
+                n_products,
+                [&](auto product_order) -> ResidualFunctionType
+                {
+                  constexpr int ReactantOrder = decltype(reactant_order)::value;
+                  constexpr int ProductOrder = decltype(product_order)::value;
+                  return DenseMatrixPolicy::Function(
+                      [indices, k_eq_indices, n_reactants, n_products, eps](
+                          auto&& state_variables, auto&& state_parameters, auto&& residual)
+                      {
+                        for (std::size_t i_phase = 0; i_phase < indices.number_of_phase_instances_; ++i_phase)
+                        {
+                          std::size_t alg_idx = indices.algebraic_indices_[i_phase];
+
+                          // Forward part: K_eq * prod([R_i]) * [S] / ([S]+eps)^n_r
+                          auto forward = residual.GetRowVariable();
+                          residual.ForEachRow(
+                              [](const double& keq, double& fwd) { fwd = keq; },
+                              state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
+                              forward);
+                          for (std::size_t r = 0; r < n_reactants; ++r)
+                            residual.ForEachRow(
+                                [](const double& conc, double& fwd) { fwd *= conc; },
+                                state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][r]),
+                                forward);
+                          residual.ForEachRow(
+                              [n_reactants, eps](const double& sol, double& fwd)
+                              { fwd *= sol / ReactionOrderPower<ReactantOrder>(sol + eps, n_reactants); },
+                              state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                              forward);
+
+                          // Reverse part: prod([P_j]) * [S] / ([S]+eps)^n_p
+                          auto reverse = residual.GetRowVariable();
+                          residual.ForEachRow([](double& rev) { rev = 1.0; }, reverse);
+                          for (std::size_t p = 0; p < n_products; ++p)
+                            residual.ForEachRow(
+                                [](const double& conc, double& rev) { rev *= conc; },
+                                state_variables.GetConstColumnView(indices.product_indices_[i_phase][p]),
+                                reverse);
+                          residual.ForEachRow(
+                              [n_products, eps](const double& sol, double& rev)
+                              { rev *= sol / ReactionOrderPower<ProductOrder>(sol + eps, n_products); },
+                              state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                              reverse);
+
+                          // G = forward - reverse
+                          residual.ForEachRow(
+                              [](const double& fwd, const double& rev, double& res) { res = fwd - rev; },
+                              forward,
+                              reverse,
+                              residual.GetColumnView(alg_idx));
+                        }
+                      },
+                      dummy_state,
+                      dummy_params,
+                      dummy_state);
+                });
+          });
     }
 
     /// @brief Returns a function that computes constraint Jacobian entries (subtracts dG/dy)
@@ -334,106 +359,120 @@ namespace miam
       DenseMatrixPolicy dummy_state{ 1, state_variable_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_params{ 1, std::max(state_parameter_indices.size(), std::size_t{ 1 }), 0.0 };
 
-      return SparseMatrixPolicy::Function(
-          [indices, k_eq_indices, jac_data, n_reactants, n_products, eps](
-              auto&& state_variables, auto&& state_parameters, auto&& jacobian_values)
+      using JacobianFunctionType =
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>;
+      return DispatchReactionOrder(
+          n_reactants,
+          [&](auto reactant_order) -> JacobianFunctionType
           {
-            for (std::size_t i_phase = 0; i_phase < indices.number_of_phase_instances_; ++i_phase)
-            {
-              const auto& jd = jac_data[i_phase];
-
-              // dG/d[R_i] = K_eq * prod([R_j], j!=i) * [S] / ([S]+eps)^n_r
-              for (std::size_t r = 0; r < n_reactants; ++r)
-              {
-                auto deriv = jacobian_values.GetBlockVariable();
-                jacobian_values.ForEachBlock(
-                    [](const double& keq, double& d) { d = keq; },
-                    state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
-                    deriv);
-                for (std::size_t j = 0; j < n_reactants; ++j)
-                  if (j != r)
-                    jacobian_values.ForEachBlock(
-                        [](const double& conc, double& d) { d *= conc; },
-                        state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][j]),
-                        deriv);
-                jacobian_values.ForEachBlock(
-                    [n_reactants, eps](const double& sol, double& d)
-                    { d *= sol / std::pow(sol + eps, static_cast<double>(n_reactants)); },
-                    state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                    deriv);
-                auto bv = jacobian_values.GetBlockView(jd.reactant_jac_vec[r]);
-                jacobian_values.ForEachBlock([](const double& d, double& j) { j -= d; }, deriv, bv);
-              }
-
-              // dG/d[P_j] = -prod([P_k], k!=j) * [S] / ([S]+eps)^n_p
-              for (std::size_t p = 0; p < n_products; ++p)
-              {
-                auto deriv = jacobian_values.GetBlockVariable();
-                jacobian_values.ForEachBlock([](double& d) { d = 1.0; }, deriv);
-                for (std::size_t k = 0; k < n_products; ++k)
-                  if (k != p)
-                    jacobian_values.ForEachBlock(
-                        [](const double& conc, double& d) { d *= conc; },
-                        state_variables.GetConstColumnView(indices.product_indices_[i_phase][k]),
-                        deriv);
-                jacobian_values.ForEachBlock(
-                    [n_products, eps](const double& sol, double& d)
-                    { d *= sol / std::pow(sol + eps, static_cast<double>(n_products)); },
-                    state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                    deriv);
-                auto bv = jacobian_values.GetBlockView(jd.product_jac_vec[p]);
-                jacobian_values.ForEachBlock([](const double& d, double& j) { j += d; }, deriv, bv);
-              }
-
-              // dG/d[S]: damped solvent derivative
-              {
-                auto forward_deriv = jacobian_values.GetBlockVariable();
-                jacobian_values.ForEachBlock(
-                    [](const double& keq, double& fwd) { fwd = keq; },
-                    state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
-                    forward_deriv);
-                for (std::size_t r = 0; r < n_reactants; ++r)
-                  jacobian_values.ForEachBlock(
-                      [](const double& conc, double& fwd) { fwd *= conc; },
-                      state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][r]),
-                      forward_deriv);
-                jacobian_values.ForEachBlock(
-                    [n_reactants, eps](const double& sol, double& fwd)
-                    {
-                      fwd *= (eps + (1.0 - static_cast<double>(n_reactants)) * sol) /
-                             std::pow(sol + eps, static_cast<double>(n_reactants) + 1.0);
-                    },
-                    state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                    forward_deriv);
-
-                auto reverse_deriv = jacobian_values.GetBlockVariable();
-                jacobian_values.ForEachBlock([](double& rev) { rev = 1.0; }, reverse_deriv);
-                for (std::size_t p = 0; p < n_products; ++p)
-                  jacobian_values.ForEachBlock(
-                      [](const double& conc, double& rev) { rev *= conc; },
-                      state_variables.GetConstColumnView(indices.product_indices_[i_phase][p]),
-                      reverse_deriv);
-                jacobian_values.ForEachBlock(
-                    [n_products, eps](const double& sol, double& rev)
-                    {
-                      rev *= (eps + (1.0 - static_cast<double>(n_products)) * sol) /
-                             std::pow(sol + eps, static_cast<double>(n_products) + 1.0);
-                    },
-                    state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
-                    reverse_deriv);
-
-                auto bv = jacobian_values.GetBlockView(jd.solvent_jac_vec);
-                jacobian_values.ForEachBlock(
-                    [](const double& fwd_d, const double& rev_d, double& j) { j -= (fwd_d - rev_d); },
-                    forward_deriv,
-                    reverse_deriv,
-                    bv);
-              }
-            }
-          },
-          dummy_state,
-          dummy_params,
-          jacobian);
+            return DispatchReactionOrder(
+                n_products,
+                [&](auto product_order) -> JacobianFunctionType
+                {
+                  constexpr int ReactantOrder = decltype(reactant_order)::value;
+                  constexpr int ProductOrder = decltype(product_order)::value;
+                  return SparseMatrixPolicy::Function(
+                      [indices, k_eq_indices, jac_data, n_reactants, n_products, eps](
+                          auto&& state_variables, auto&& state_parameters, auto&& jacobian_values)
+                      {
+                        for (std::size_t i_phase = 0; i_phase < indices.number_of_phase_instances_; ++i_phase)
+                        {
+                          const auto& jd = jac_data[i_phase];
+
+                          // dG/d[R_i] = K_eq * prod([R_j], j!=i) * [S] / ([S]+eps)^n_r
+                          for (std::size_t r = 0; r < n_reactants; ++r)
+                          {
+                            auto deriv = jacobian_values.GetBlockVariable();
+                            jacobian_values.ForEachBlock(
+                                [](const double& keq, double& d) { d = keq; },
+                                state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
+                                deriv);
+                            for (std::size_t j = 0; j < n_reactants; ++j)
+                              if (j != r)
+                                jacobian_values.ForEachBlock(
+                                    [](const double& conc, double& d) { d *= conc; },
+                                    state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][j]),
+                                    deriv);
+                            jacobian_values.ForEachBlock(
+                                [n_reactants, eps](const double& sol, double& d)
+                                { d *= sol / ReactionOrderPower<ReactantOrder>(sol + eps, n_reactants); },
+                                state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                                deriv);
+                            auto bv = jacobian_values.GetBlockView(jd.reactant_jac_vec[r]);
+                            jacobian_values.ForEachBlock([](const double& d, double& j) { j -= d; }, deriv, bv);
+                          }
+
+                          // dG/d[P_j] = -prod([P_k], k!=j) * [S] / ([S]+eps)^n_p
+                          for (std::size_t p = 0; p < n_products; ++p)
+                          {
+                            auto deriv = jacobian_values.GetBlockVariable();
+                            jacobian_values.ForEachBlock([](double& d) { d = 1.0; }, deriv);
+                            for (std::size_t k = 0; k < n_products; ++k)
+                              if (k != p)
+                                jacobian_values.ForEachBlock(
+                                    [](const double& conc, double& d) { d *= conc; },
+                                    state_variables.GetConstColumnView(indices.product_indices_[i_phase][k]),
+                                    deriv);
+                            jacobian_values.ForEachBlock(
+                                [n_products, eps](const double& sol, double& d)
+                                { d *= sol / ReactionOrderPower<ProductOrder>(sol + eps, n_products); },
+                                state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                                deriv);
+                            auto bv = jacobian_values.GetBlockView(jd.product_jac_vec[p]);
+                            jacobian_values.ForEachBlock([](const double& d, double& j) { j += d; }, deriv, bv);
+                          }
+
+                          // dG/d[S]: damped solvent derivative
+                          {
+                            auto forward_deriv = jacobian_values.GetBlockVariable();
+                            jacobian_values.ForEachBlock(
+                                [](const double& keq, double& fwd) { fwd = keq; },
+                                state_parameters.GetConstColumnView(k_eq_indices[i_phase]),
+                                forward_deriv);
+                            for (std::size_t r = 0; r < n_reactants; ++r)
+                              jacobian_values.ForEachBlock(
+                                  [](const double& conc, double& fwd) { fwd *= conc; },
+                                  state_variables.GetConstColumnView(indices.reactant_indices_[i_phase][r]),
+                                  forward_deriv);
+                            jacobian_values.ForEachBlock(
+                                [n_reactants, eps](const double& sol, double& fwd)
+                                {
+                                  fwd *= (eps + (1.0 - static_cast<double>(n_reactants)) * sol) /
+                                         ReactionOrderPower<kNextReactionOrder<ReactantOrder>>(sol + eps, n_reactants + 1);
+                                },
+                                state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                                forward_deriv);
+
+                            auto reverse_deriv = jacobian_values.GetBlockVariable();
+                            jacobian_values.ForEachBlock([](double& rev) { rev = 1.0; }, reverse_deriv);
+                            for (std::size_t p = 0; p < n_products; ++p)
+                              jacobian_values.ForEachBlock(
+                                  [](const double& conc, double& rev) { rev *= conc; },
+                                  state_variables.GetConstColumnView(indices.product_indices_[i_phase][p]),
+                                  reverse_deriv);
+                            jacobian_values.ForEachBlock(
+                                [n_products, eps](const double& sol, double& rev)
+                                {
+                                  rev *= (eps + (1.0 - static_cast<double>(n_products)) * sol) /
+                                         ReactionOrderPower<kNextReactionOrder<ProductOrder>>(sol + eps, n_products + 1);
+                                },
+                                state_variables.GetConstColumnView(indices.solvent_indices_[i_phase]),
+                                reverse_deriv);
+
+                            auto bv = jacobian_values.GetBlockView(jd.solvent_jac_vec);
+                            jacobian_values.ForEachBlock(
+                                [](const double& fwd_d, const double& rev_d, double& j) { j -= (fwd_d - rev_d); },
+                                forward_deriv,
+                                reverse_deriv,
+                                bv);
+                          }
+                        }
+                      },
+                      dummy_state,
+                      dummy_params,
+                      jacobian);
+                });
+          });
     }
 
    private:
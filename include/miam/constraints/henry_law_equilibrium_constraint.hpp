@@ -6,6 +6,7 @@
 #include <miam/math/condensation_rate.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -124,7 +125,17 @@ namespace miam
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> elements;
+      SparsityPattern elements;
+      AppendNonZeroConstraintJacobianElements(phase_prefixes, state_variable_indices, elements);
+      return elements.ToSet();
+    }
+
+    /// @brief Appends non-zero constraint Jacobian element positions to a sparsity pattern
+    void AppendNonZeroConstraintJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        SparsityPattern& elements) const
+    {
       auto gas_it = state_variable_indices.find(gas_species_.name_);
       if (gas_it == state_variable_indices.end())
         throw MiamException(
@@ -135,7 +146,7 @@ namespace miam
 
       auto phase_it = phase_prefixes.find(condensed_phase_.name_);
       if (phase_it == phase_prefixes.end())
-        return elements;
+        return;
 
       for (const auto& prefix : phase_it->second)
       {
@@ -144,11 +155,10 @@ namespace miam
         std::size_t solvent_idx = state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + solvent_.name_);
 
         // dG/d[A_g], dG/d[A_aq], dG/d[S]
-        elements.insert({ aq_idx, gas_idx });
-        elements.insert({ aq_idx, aq_idx });
-        elements.insert({ aq_idx, solvent_idx });
+        elements.Add(aq_idx, gas_idx);
+        elements.Add(aq_idx, aq_idx);
+        elements.Add(aq_idx, solvent_idx);
       }
-      return elements;
     }
 
     /// @brief Returns the names of state parameters owned by this constraint (one per phase instance).
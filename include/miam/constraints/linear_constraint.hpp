@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <miam/constraints/linear_constraint_system.hpp>
+#include <miam/util/constant_jacobian.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -136,7 +139,17 @@ namespace miam
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> elements;
+      SparsityPattern elements;
+      AppendNonZeroConstraintJacobianElements(phase_prefixes, state_variable_indices, elements);
+      return elements.ToSet();
+    }
+
+    /// @brief Appends non-zero constraint Jacobian element positions to a sparsity pattern
+    void AppendNonZeroConstraintJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        SparsityPattern& elements) const
+    {
       bool is_global = (phase_prefixes.find(algebraic_phase_.name_) == phase_prefixes.end());
 
       if (is_global)
@@ -151,13 +164,13 @@ namespace miam
             for (const auto& prefix : phase_it->second)
             {
               std::size_t col = state_variable_indices.at(prefix + "." + term.phase.name_ + "." + term.species.name_);
-              elements.insert({ alg_row, col });
+              elements.Add(alg_row, col);
             }
           }
           else
           {
             std::size_t col = state_variable_indices.at(term.species.name_);
-            elements.insert({ alg_row, col });
+            elements.Add(alg_row, col);
           }
         }
       }
@@ -176,18 +189,17 @@ namespace miam
             {
               // Same instanced phase as algebraic: use only this instance
               std::size_t col = state_variable_indices.at(prefix + "." + term.phase.name_ + "." + term.species.name_);
-              elements.insert({ alg_row, col });
+              elements.Add(alg_row, col);
             }
             else
             {
               // Non-instanced (gas) term: shared across all instances
               std::size_t col = state_variable_indices.at(term.species.name_);
-              elements.insert({ alg_row, col });
+              elements.Add(alg_row, col);
             }
           }
         }
       }
-      return elements;
     }
 
     /// @brief Returns a no-op constraint parameter update function (linear constraints have no parameters)
@@ -217,85 +229,60 @@ namespace miam
       return DiagnoseParamNames(phase_prefixes);
     }
 
-    /// @brief Returns a function that diagnoses constraint constants from the current state
-    /// @details Computes C = sum(c_i * [species_i]) for each grid cell at the start of each Solve()
-    template<typename DenseMatrixPolicy>
-    std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> InitializeConstraintParametersFunction(
+    /// @brief Appends the constraint rows to a system of linear constraints
+    /// @details One row per algebraic variable. Rows of a constraint with diagnose_from_state_ read their
+    ///          constant from the LC_<uuid>[_<prefix>]_constant state parameter; the others use constant_.
+    void AppendLinearConstraintRows(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
-        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        LinearConstraintSystem& system) const
     {
-      if (!diagnose_from_state_)
-        return [](const DenseMatrixPolicy&, DenseMatrixPolicy&) {};
-
       bool is_global = (phase_prefixes.find(algebraic_phase_.name_) == phase_prefixes.end());
-
-      DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
+      auto add_row = [&](std::size_t alg_idx, const auto& terms, const std::string& param_name)
+      {
+        if (diagnose_from_state_)
+          system.AddDiagnosedRow(alg_idx, terms, state_parameter_indices.at(param_name));
+        else
+          system.AddRow(alg_idx, terms, constant_);
+      };
 
       if (is_global)
       {
-        auto resolved = ResolveGlobalTerms(phase_prefixes, state_variable_indices);
-        auto param_name = "LC_" + uuid_ + "_constant";
-        std::size_t param_idx = state_parameter_indices.at(param_name);
-
-        auto inner = DenseMatrixPolicy::Function(
-            [resolved, param_idx](auto&& state_variables, auto&& state_parameters)
-            {
-              auto total = state_parameters.GetRowVariable();
-              state_parameters.ForEachRow([](double& t) { t = 0.0; }, total);
-              for (const auto& [idx, coeff] : resolved)
-                state_parameters.ForEachRow(
-                    [coeff](const double& val, double& t) { t += coeff * val; },
-                    state_variables.GetConstColumnView(idx),
-                    total);
-              state_parameters.ForEachRow(
-                  [](const double& t, double& param) { param = t; }, total, state_parameters.GetColumnView(param_idx));
-            },
-            dummy_state_variables,
-            dummy_state_parameters);
-
-        return
-            [inner = std::move(inner)](const DenseMatrixPolicy& state_variables, DenseMatrixPolicy& state_parameters) mutable
-        { inner(state_variables, state_parameters); };
+        add_row(
+            state_variable_indices.at(algebraic_species_.name_),
+            ResolveGlobalTerms(phase_prefixes, state_variable_indices),
+            "LC_" + uuid_ + "_constant");
       }
       else
       {
         auto per_instance = ResolvePerInstanceTerms(phase_prefixes, state_variable_indices);
-        std::vector<std::size_t> param_indices;
-        std::size_t i = 0;
+        std::size_t i_inst = 0;
         for (const auto& prefix : phase_prefixes.at(algebraic_phase_.name_))
         {
-          auto param_name = "LC_" + uuid_ + "_" + prefix + "_constant";
-          param_indices.push_back(state_parameter_indices.at(param_name));
-          ++i;
+          add_row(
+              state_variable_indices.at(prefix + "." + algebraic_phase_.name_ + "." + algebraic_species_.name_),
+              per_instance[i_inst],
+              "LC_" + uuid_ + "_" + prefix + "_constant");
+          ++i_inst;
         }
+      }
+    }
 
-        auto inner = DenseMatrixPolicy::Function(
-            [per_instance, param_indices](auto&& state_variables, auto&& state_parameters)
-            {
-              for (std::size_t i_inst = 0; i_inst < param_indices.size(); ++i_inst)
-              {
-                auto total = state_parameters.GetRowVariable();
-                state_parameters.ForEachRow([](double& t) { t = 0.0; }, total);
-                for (const auto& [idx, coeff] : per_instance[i_inst])
-                  state_parameters.ForEachRow(
-                      [coeff](const double& val, double& t) { t += coeff * val; },
-                      state_variables.GetConstColumnView(idx),
-                      total);
-                state_parameters.ForEachRow(
-                    [](const double& t, double& param) { param = t; },
-                    total,
-                    state_parameters.GetColumnView(param_indices[i_inst]));
-              }
-            },
-            dummy_state_variables,
-            dummy_state_parameters);
+    /// @brief Returns a function that diagnoses constraint constants from the current state
+    /// @details Computes C = sum(c_i * [species_i]) for each grid cell at the start of each Solve()
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> InitializeConstraintParametersFunction(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      if (!diagnose_from_state_)
+        return [](const DenseMatrixPolicy&, DenseMatrixPolicy&) {};
 
-        return
-            [inner = std::move(inner)](const DenseMatrixPolicy& state_variables, DenseMatrixPolicy& state_parameters) mutable
-        { inner(state_variables, state_parameters); };
-      }
+      LinearConstraintSystem system;
+      AppendLinearConstraintRows(phase_prefixes, state_parameter_indices, state_variable_indices, system);
+      return system.DiagnoseConstantsFunction<DenseMatrixPolicy>();
     }
 
     /// @brief Returns a function that computes constraint residuals G(y) = 0
@@ -308,147 +295,45 @@ namespace miam
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      bool is_global = (phase_prefixes.find(algebraic_phase_.name_) == phase_prefixes.end());
-      bool diagnose = diagnose_from_state_;
-      double constant = constant_;
+      LinearConstraintSystem system;
+      AppendLinearConstraintRows(phase_prefixes, state_parameter_indices, state_variable_indices, system);
+      return system.ResidualFunction<DenseMatrixPolicy>();
+    }
 
-      DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
+    /// @brief Appends the constraint Jacobian entries, which do not depend on the state
+    /// @details dG/d[species_i] = coeff_i in every grid cell. Follows MICM convention: jac -= dG/dy, so
+    ///          the appended values are -coeff_i.
+    void AppendConstantConstraintJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        ConstantJacobian& elements) const
+    {
+      bool is_global = (phase_prefixes.find(algebraic_phase_.name_) == phase_prefixes.end());
 
       if (is_global)
       {
-        auto resolved = ResolveGlobalTerms(phase_prefixes, state_variable_indices);
-        std::size_t alg_idx = state_variable_indices.at(algebraic_species_.name_);
-
-        if (diagnose)
-        {
-          auto param_name = "LC_" + uuid_ + "_constant";
-          std::size_t param_idx = state_parameter_indices.at(param_name);
-          DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
-
-          auto inner = DenseMatrixPolicy::Function(
-              [resolved, alg_idx, param_idx](auto&& state_variables, auto&& state_parameters, auto&& residual)
-              {
-                auto sum = residual.GetRowVariable();
-                residual.ForEachRow(
-                    [](const double& param, double& s) { s = -param; }, state_parameters.GetConstColumnView(param_idx), sum);
-                for (const auto& [idx, coeff] : resolved)
-                  residual.ForEachRow(
-                      [coeff](const double& val, double& s) { s += coeff * val; },
-                      state_variables.GetConstColumnView(idx),
-                      sum);
-                residual.ForEachRow([](const double& s, double& res) { res = s; }, sum, residual.GetColumnView(alg_idx));
-              },
-              dummy_state_variables,
-              dummy_state_parameters,
-              dummy_state_variables);
-
-          return [inner = std::move(inner)](
-                     const DenseMatrixPolicy& state_variables,
-                     const DenseMatrixPolicy& state_parameters,
-                     DenseMatrixPolicy& residual) mutable { inner(state_variables, state_parameters, residual); };
-        }
-        else
-        {
-          auto inner = DenseMatrixPolicy::Function(
-              [resolved, alg_idx, constant](auto&& state_variables, auto&& residual)
-              {
-                auto sum = residual.GetRowVariable();
-                residual.ForEachRow([constant](double& s) { s = -constant; }, sum);
-                for (const auto& [idx, coeff] : resolved)
-                  residual.ForEachRow(
-                      [coeff](const double& val, double& s) { s += coeff * val; },
-                      state_variables.GetConstColumnView(idx),
-                      sum);
-                residual.ForEachRow([](const double& s, double& res) { res = s; }, sum, residual.GetColumnView(alg_idx));
-              },
-              dummy_state_variables,
-              dummy_state_variables);
-
-          return [inner = std::move(inner)](
-                     const DenseMatrixPolicy& state_variables,
-                     const DenseMatrixPolicy& /*state_parameters*/,
-                     DenseMatrixPolicy& residual) mutable { inner(state_variables, residual); };
-        }
+        std::size_t alg_row = state_variable_indices.at(algebraic_species_.name_);
+        for (const auto& [col_idx, coeff] : ResolveGlobalTerms(phase_prefixes, state_variable_indices))
+          elements.Add(alg_row, col_idx, -coeff);
       }
       else
       {
         auto per_instance = ResolvePerInstanceTerms(phase_prefixes, state_variable_indices);
-        std::vector<std::size_t> alg_indices;
+        std::size_t i_inst = 0;
         for (const auto& prefix : phase_prefixes.at(algebraic_phase_.name_))
         {
-          alg_indices.push_back(
-              state_variable_indices.at(prefix + "." + algebraic_phase_.name_ + "." + algebraic_species_.name_));
-        }
-
-        if (diagnose)
-        {
-          std::vector<std::size_t> param_indices;
-          for (const auto& prefix : phase_prefixes.at(algebraic_phase_.name_))
-          {
-            auto param_name = "LC_" + uuid_ + "_" + prefix + "_constant";
-            param_indices.push_back(state_parameter_indices.at(param_name));
-          }
-          DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
-
-          auto inner = DenseMatrixPolicy::Function(
-              [per_instance, alg_indices, param_indices](auto&& state_variables, auto&& state_parameters, auto&& residual)
-              {
-                for (std::size_t i_inst = 0; i_inst < alg_indices.size(); ++i_inst)
-                {
-                  auto sum = residual.GetRowVariable();
-                  residual.ForEachRow(
-                      [](const double& param, double& s) { s = -param; },
-                      state_parameters.GetConstColumnView(param_indices[i_inst]),
-                      sum);
-                  for (const auto& [idx, coeff] : per_instance[i_inst])
-                    residual.ForEachRow(
-                        [coeff](const double& val, double& s) { s += coeff * val; },
-                        state_variables.GetConstColumnView(idx),
-                        sum);
-                  residual.ForEachRow(
-                      [](const double& s, double& res) { res = s; }, sum, residual.GetColumnView(alg_indices[i_inst]));
-                }
-              },
-              dummy_state_variables,
-              dummy_state_parameters,
-              dummy_state_variables);
-
-          return [inner = std::move(inner)](
-                     const DenseMatrixPolicy& state_variables,
-                     const DenseMatrixPolicy& state_parameters,
-                     DenseMatrixPolicy& residual) mutable { inner(state_variables, state_parameters, residual); };
-        }
-        else
-        {
-          auto inner = DenseMatrixPolicy::Function(
-              [per_instance, alg_indices, constant](auto&& state_variables, auto&& residual)
-              {
-                for (std::size_t i_inst = 0; i_inst < alg_indices.size(); ++i_inst)
-                {
-                  auto sum = residual.GetRowVariable();
-                  residual.ForEachRow([constant](double& s) { s = -constant; }, sum);
-                  for (const auto& [idx, coeff] : per_instance[i_inst])
-                    residual.ForEachRow(
-                        [coeff](const double& val, double& s) { s += coeff * val; },
-                        state_variables.GetConstColumnView(idx),
-                        sum);
-                  residual.ForEachRow(
-                      [](const double& s, double& res) { res = s; }, sum, residual.GetColumnView(alg_indices[i_inst]));
-                }
-              },
-              dummy_state_variables,
-              dummy_state_variables);
-
-          return [inner = std::move(inner)](
-                     const DenseMatrixPolicy& state_variables,
-                     const DenseMatrixPolicy& /*state_parameters*/,
-                     DenseMatrixPolicy& residual) mutable { inner(state_variables, residual); };
+          std::size_t alg_row =
+              state_variable_indices.at(prefix + "." + algebraic_phase_.name_ + "." + algebraic_species_.name_);
+          for (const auto& [col_idx, coeff] : per_instance[i_inst])
+            elements.Add(alg_row, col_idx, -coeff);
+          ++i_inst;
         }
       }
     }
 
     /// @brief Returns a function that computes constraint Jacobian entries (subtracts dG/dy)
-    /// @details dG/d[species_i] = coeff_i. Follows MICM convention: jac -= dG/dy
+    /// @details dG/d[species_i] = coeff_i. Follows MICM convention: jac -= dG/dy. The entries are
+    ///          assembled once (see ConstantJacobian) and added on each call without reading the state.
     template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> ConstraintJacobianFunction(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
@@ -456,81 +341,9 @@ namespace miam
         const std::unordered_map<std::string, std::size_t>& state_variable_indices,
         const SparseMatrixPolicy& jacobian) const
     {
-      bool is_global = (phase_prefixes.find(algebraic_phase_.name_) == phase_prefixes.end());
-
-      DenseMatrixPolicy dummy_state{ 1, state_variable_indices.size(), 0.0 };
-
-      if (is_global)
-      {
-        auto resolved = ResolveGlobalTerms(phase_prefixes, state_variable_indices);
-        std::size_t alg_row = state_variable_indices.at(algebraic_species_.name_);
-
-        // Pre-compute Jacobian VectorIndex offsets (block 0)
-        std::vector<std::pair<std::size_t, double>> jac_entries;
-        for (const auto& [col_idx, coeff] : resolved)
-        {
-          jac_entries.push_back({ jacobian.VectorIndex(0, alg_row, col_idx), coeff });
-        }
-
-        auto inner = SparseMatrixPolicy::Function(
-            [jac_entries](auto&& /*state_variables*/, auto&& jacobian_values)
-            {
-              for (const auto& [vec_idx, coeff] : jac_entries)
-              {
-                auto bv = jacobian_values.GetBlockView(vec_idx);
-                jacobian_values.ForEachBlock([coeff](double& j) { j -= coeff; }, bv);
-              }
-            },
-            dummy_state,
-            jacobian);
-
-        return [inner = std::move(inner)](
-                   const DenseMatrixPolicy& state_variables,
-                   const DenseMatrixPolicy& /*state_parameters*/,
-                   SparseMatrixPolicy& jacobian_values) mutable { inner(state_variables, jacobian_values); };
-      }
-      else
-      {
-        auto per_instance = ResolvePerInstanceTerms(phase_prefixes, state_variable_indices);
-        std::vector<std::size_t> alg_rows;
-        for (const auto& prefix : phase_prefixes.at(algebraic_phase_.name_))
-        {
-          alg_rows.push_back(
-              state_variable_indices.at(prefix + "." + algebraic_phase_.name_ + "." + algebraic_species_.name_));
-        }
-
-        // Pre-compute Jacobian VectorIndex offsets per instance (block 0)
-        std::vector<std::vector<std::pair<std::size_t, double>>> jac_entries_per_instance;
-        for (std::size_t i_inst = 0; i_inst < alg_rows.size(); ++i_inst)
-        {
-          std::vector<std::pair<std::size_t, double>> inst_entries;
-          for (const auto& [col_idx, coeff] : per_instance[i_inst])
-          {
-            inst_entries.push_back({ jacobian.VectorIndex(0, alg_rows[i_inst], col_idx), coeff });
-          }
-          jac_entries_per_instance.push_back(std::move(inst_entries));
-        }
-
-        auto inner = SparseMatrixPolicy::Function(
-            [jac_entries_per_instance](auto&& /*state_variables*/, auto&& jacobian_values)
-            {
-              for (const auto& inst_entries : jac_entries_per_instance)
-              {
-                for (const auto& [vec_idx, coeff] : inst_entries)
-                {
-                  auto bv = jacobian_values.GetBlockView(vec_idx);
-                  jacobian_values.ForEachBlock([coeff](double& j) { j -= coeff; }, bv);
-                }
-              }
-            },
-            dummy_state,
-            jacobian);
-
-        return [inner = std::move(inner)](
-                   const DenseMatrixPolicy& state_variables,
-                   const DenseMatrixPolicy& /*state_parameters*/,
-                   SparseMatrixPolicy& jacobian_values) mutable { inner(state_variables, jacobian_values); };
-      }
+      ConstantJacobian elements;
+      AppendConstantConstraintJacobianElements(phase_prefixes, state_variable_indices, elements);
+      return elements.Function<DenseMatrixPolicy, SparseMatrixPolicy>(jacobian);
     }
 
    private:
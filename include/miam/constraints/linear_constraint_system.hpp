@@ -0,0 +1,214 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/cell_blocks.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Linear constraints assembled into one sparse coefficient matrix
+  /// @details Each row is one constraint equation  G_r = sum_k c_k * y[col_k] - C_r = 0,  whose residual is
+  ///          written to the state variable column of its algebraic variable. The coefficients are stored
+  ///          in compressed sparse row (CSR) form. The constant C_r is either fixed or read from a state
+  ///          parameter column; the latter are the constants diagnosed from the state at the start of each
+  ///          Solve(), and DiagnoseConstantsFunction() computes them from the same rows.
+  ///
+  ///          All rows are evaluated by one function, so the residual of every linear constraint in a
+  ///          Model is a single pass over the grid cells instead of one function per constraint.
+  ///
+  ///          The functions walk the flat storage of the matrices directly, one cell group at a time, and
+  ///          therefore require the CellGroupStorage layout (micm::Matrix or micm::VectorMatrix).
+  class LinearConstraintSystem
+  {
+   public:
+    static constexpr std::size_t kFixedConstant = std::numeric_limits<std::size_t>::max();
+
+    /// @brief Appends a constraint with a fixed constant
+    /// @param residual_index State variable column of the algebraic variable (the residual row)
+    /// @param terms (state variable column, coefficient) pairs
+    /// @param constant Constant C of the constraint
+    void AddRow(std::size_t residual_index, const std::vector<std::pair<std::size_t, double>>& terms, double constant)
+    {
+      AppendRow(residual_index, terms, kFixedConstant, constant);
+    }
+
+    /// @brief Appends a constraint whose constant is diagnosed from the state into a state parameter
+    /// @param residual_index State variable column of the algebraic variable (the residual row)
+    /// @param terms (state variable column, coefficient) pairs
+    /// @param constant_index State parameter column of the diagnosed constant
+    void AddDiagnosedRow(
+        std::size_t residual_index,
+        const std::vector<std::pair<std::size_t, double>>& terms,
+        std::size_t constant_index)
+    {
+      AppendRow(residual_index, terms, constant_index, 0.0);
+    }
+
+    /// @brief Returns true if the system has no rows
+    bool Empty() const
+    {
+      return residual_indices_.empty();
+    }
+
+    /// @brief Returns the number of constraint rows
+    std::size_t NumberOfRows() const
+    {
+      return residual_indices_.size();
+    }
+
+    /// @brief Returns the number of stored coefficients
+    std::size_t NumberOfCoefficients() const
+    {
+      return coefficients_.size();
+    }
+
+    /// @brief Returns true if any row reads a diagnosed constant
+    bool HasDiagnosedRows() const
+    {
+      for (std::size_t index : constant_indices_)
+        if (index != kFixedConstant)
+          return true;
+      return false;
+    }
+
+    /// @brief Returns a function that sets the residual of every row
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ResidualFunction() const
+    {
+      return ResidualFunction<DenseMatrixPolicy>(0, NumberOfRows());
+    }
+
+    /// @brief Returns a function that sets the residual of the rows [first_row, end_row)
+    /// @details The cell groups of the matrices are the outer loop and the rows the inner one, so the
+    ///          state of a cell group is read once per call while every row of the range is evaluated.
+    /// @param first_row First row evaluated
+    /// @param end_row One past the last row evaluated
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ResidualFunction(
+        std::size_t first_row,
+        std::size_t end_row) const
+    {
+      static_assert(
+          CellGroupStorage<DenseMatrixPolicy>, "LinearConstraintSystem requires the CellGroupStorage matrix layout");
+      RequireCellGroupLayout<DenseMatrixPolicy>("LinearConstraintSystem");
+      return [system = *this, first_row, end_row](
+                 const DenseMatrixPolicy& state_variables,
+                 const DenseMatrixPolicy& state_parameters,
+                 DenseMatrixPolicy& residual)
+      {
+        constexpr std::size_t L = CellGroupSize<DenseMatrixPolicy>();
+        const double* variables = state_variables.AsVector().data();
+        const double* parameters = state_parameters.AsVector().data();
+        double* residual_values = residual.AsVector().data();
+        const std::size_t variable_stride = L * state_variables.NumColumns();
+        const std::size_t parameter_stride = L * state_parameters.NumColumns();
+        const std::size_t residual_stride = L * residual.NumColumns();
+        const std::size_t number_of_groups = (state_variables.NumRows() + L - 1) / L;
+        std::array<double, L> sum;
+        for (std::size_t group = 0; group < number_of_groups; ++group)
+        {
+          const double* group_variables = variables + group * variable_stride;
+          for (std::size_t row = first_row; row < end_row; ++row)
+          {
+            if (system.constant_indices_[row] == kFixedConstant)
+              sum.fill(-system.constants_[row]);
+            else
+            {
+              const double* constant = parameters + group * parameter_stride + system.constant_indices_[row] * L;
+              for (std::size_t cell = 0; cell < L; ++cell)
+                sum[cell] = -constant[cell];
+            }
+            system.AccumulateRow(row, group_variables, sum);
+            double* row_residual = residual_values + group * residual_stride + system.residual_indices_[row] * L;
+            for (std::size_t cell = 0; cell < L; ++cell)
+              row_residual[cell] = sum[cell];
+          }
+        }
+      };
+    }
+
+    /// @brief Returns a function that diagnoses the constants C = sum_k c_k * y[col_k] of the diagnosed rows
+    /// @details Loops over the cell groups like ResidualFunction()
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> DiagnoseConstantsFunction() const
+    {
+      static_assert(
+          CellGroupStorage<DenseMatrixPolicy>, "LinearConstraintSystem requires the CellGroupStorage matrix layout");
+      RequireCellGroupLayout<DenseMatrixPolicy>("LinearConstraintSystem");
+      if (!HasDiagnosedRows())
+        return [](const DenseMatrixPolicy&, DenseMatrixPolicy&) {};
+
+      return [system = *this](const DenseMatrixPolicy& state_variables, DenseMatrixPolicy& state_parameters)
+      {
+        constexpr std::size_t L = CellGroupSize<DenseMatrixPolicy>();
+        const double* variables = state_variables.AsVector().data();
+        double* parameters = state_parameters.AsVector().data();
+        const std::size_t variable_stride = L * state_variables.NumColumns();
+        const std::size_t parameter_stride = L * state_parameters.NumColumns();
+        const std::size_t number_of_groups = (state_variables.NumRows() + L - 1) / L;
+        std::array<double, L> sum;
+        for (std::size_t group = 0; group < number_of_groups; ++group)
+        {
+          const double* group_variables = variables + group * variable_stride;
+          for (std::size_t row = 0; row < system.residual_indices_.size(); ++row)
+          {
+            if (system.constant_indices_[row] == kFixedConstant)
+              continue;
+            sum.fill(0.0);
+            system.AccumulateRow(row, group_variables, sum);
+            double* constant = parameters + group * parameter_stride + system.constant_indices_[row] * L;
+            for (std::size_t cell = 0; cell < L; ++cell)
+              constant[cell] = sum[cell];
+          }
+        }
+      };
+    }
+
+   private:
+    std::vector<std::size_t> row_starts_{ 0 };   ///< First coefficient of each row, plus the end of the last row
+    std::vector<std::size_t> columns_;           ///< State variable column of each coefficient
+    std::vector<double> coefficients_;           ///< Coefficients, row by row
+    std::vector<std::size_t> residual_indices_;  ///< Residual (algebraic variable) column of each row
+    std::vector<std::size_t> constant_indices_;  ///< State parameter column of each row's constant, or kFixedConstant
+    std::vector<double> constants_;              ///< Fixed constant of each row (unused for diagnosed rows)
+
+    void AppendRow(
+        std::size_t residual_index,
+        const std::vector<std::pair<std::size_t, double>>& terms,
+        std::size_t constant_index,
+        double constant)
+    {
+      for (const auto& [column, coefficient] : terms)
+      {
+        columns_.push_back(column);
+        coefficients_.push_back(coefficient);
+      }
+      row_starts_.push_back(columns_.size());
+      residual_indices_.push_back(residual_index);
+      constant_indices_.push_back(constant_index);
+      constants_.push_back(constant);
+    }
+
+    /// @brief Adds the terms of one row, for the L cells of one group, to `sum`
+    /// @param group_variables First state variable value of the cell group (flat storage)
+    template<std::size_t L>
+    void AccumulateRow(std::size_t row, const double* group_variables, std::array<double, L>& sum) const
+    {
+      for (std::size_t k = row_starts_[row]; k < row_starts_[row + 1]; ++k)
+      {
+        const double coefficient = coefficients_[k];
+        const double* values = group_variables + columns_[k] * L;
+        for (std::size_t cell = 0; cell < L; ++cell)
+          sum[cell] += coefficient * values[cell];
+      }
+    }
+  };
+}  // namespace miam
@@ -10,13 +10,14 @@
 #include <micm/util/constants.hpp>
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <numbers>
 #include <stdexcept>
 
 namespace miam
 {
-  /// @brief Provider for condensation rate and its derivatives
+  /// @brief Fuchs-Sutugin condensation rate kernel
   /// @details Encapsulates the Fuchs-Sutugin transition regime calculation \cite Fuchs1971, Zaveri2008:
   ///
   ///          k_cond = 4π · r_eff · N · D · f(Kn, α)                      [s⁻¹]
@@ -40,6 +41,140 @@ namespace miam
   ///            T       Temperature                                       [K]
   ///            M       Molecular weight of the gas species               [kg mol⁻¹]
   ///            α       Mass accommodation coefficient                    [dimensionless, 0–1]
+  ///
+  ///          A plain value type with the temperature-independent factors precomputed; per-cell
+  ///          kernels capture it by value so the calculation can be inlined.
+  struct FuchsSutuginKernel
+  {
+    double diffusion_coefficient_{ 0.0 };      ///< D [m² s⁻¹]
+    double accommodation_coefficient_{ 0.0 };  ///< α [dimensionless]
+    double molecular_weight_{ 0.0 };           ///< M [kg mol⁻¹]
+    double pi_molecular_weight_{ 0.0 };        ///< π·M [kg mol⁻¹]
+    double f_numerator_{ 0.0 };                ///< 0.75α
+    double kn_coefficient_{ 0.0 };             ///< 1 + 0.283α
+
+    constexpr FuchsSutuginKernel() = default;
+
+    /// @brief Creates a kernel with the temperature-independent factors precomputed
+    /// @param diffusion_coefficient Gas-phase diffusion coefficient [m² s⁻¹]
+    /// @param accommodation_coefficient Mass accommodation coefficient [dimensionless, 0-1]
+    /// @param molecular_weight Molecular weight of the gas species [kg mol⁻¹]
+    constexpr FuchsSutuginKernel(double diffusion_coefficient, double accommodation_coefficient, double molecular_weight)
+        : diffusion_coefficient_(diffusion_coefficient),
+          accommodation_coefficient_(accommodation_coefficient),
+          molecular_weight_(molecular_weight),
+          pi_molecular_weight_(std::numbers::pi * molecular_weight),
+          f_numerator_(0.75 * accommodation_coefficient),
+          kn_coefficient_(1.0 + 0.283 * accommodation_coefficient)
+    {
+    }
+
+    /// @brief Compute the mean free path λ = 3·D / c̄ of the gas molecules [m]
+    /// @details Depends only on temperature, so processes evaluate it once per grid cell when the
+    ///          conditions are updated and pass it to ComputeValueFromMeanFreePath.
+    /// @param T Temperature [K]
+    /// @return λ [m], or 0 for non-positive T
+    double MeanFreePath(double T) const
+    {
+      if (T <= 0)
+        return 0.0;
+      double c_bar = std::sqrt(8.0 * micm::constants::GAS_CONSTANT * T / pi_molecular_weight_);
+      return 3.0 * diffusion_coefficient_ / c_bar;
+    }
+
+    /// @brief Compute condensation rate k_cond [s⁻¹]
+    /// @param r_eff Effective radius [m]
+    /// @param N Number concentration [# m⁻³]
+    /// @param T Temperature [K]
+    /// @return k_cond [s⁻¹]
+    double ComputeValue(double r_eff, double N, double T) const
+    {
+      if (r_eff <= 0 || N <= 0 || T <= 0)
+        return 0.0;
+      return ComputeValueFromMeanFreePath(r_eff, N, MeanFreePath(T));
+    }
+
+    /// @brief Compute condensation rate k_cond [s⁻¹] from a precomputed mean free path
+    /// @details Branch-free: cells with a non-positive input are evaluated with unit inputs and masked
+    ///          to zero, so the per-cell loops that call this from ForEachRow have no data-dependent
+    ///          branches. Whether the compiler vectorizes them depends on the compiler and its flags; the
+    ///          build does not enforce it. Valid cells give the same result as the unmasked formula. A NaN input is not masked, so a diverging state gives a NaN rate
+    ///          the solver rejects rather than a silent zero.
+    /// @param r_eff Effective radius [m]
+    /// @param N Number concentration [# m⁻³]
+    /// @param mean_free_path Mean free path λ from MeanFreePath [m]
+    /// @return k_cond [s⁻¹], or 0 if any input is non-positive
+    double ComputeValueFromMeanFreePath(double r_eff, double N, double mean_free_path) const
+    {
+      // 0.0 for cells with a non-positive input, 1.0 otherwise (NaN inputs fall through and propagate)
+      const double mask = static_cast<double>(!(r_eff <= 0) & !(N <= 0) & !(mean_free_path <= 0));
+      const double r = mask * r_eff + (1.0 - mask);
+      const double n = mask * N + (1.0 - mask);
+      const double lambda = mask * mean_free_path + (1.0 - mask);
+      double Kn = lambda / r;
+      double denom = Kn * Kn + kn_coefficient_ * Kn + f_numerator_;
+      double f = f_numerator_ * (1.0 + Kn) / denom;
+      return mask * (4.0 * std::numbers::pi * r * n * diffusion_coefficient_ * f);
+    }
+
+    /// @brief Compute condensation rate and partial derivatives
+    /// @param r_eff Effective radius [m]
+    /// @param N Number concentration [# m⁻³]
+    /// @param T Temperature [K]
+    /// @param k_cond Output: condensation rate [s⁻¹]
+    /// @param dk_dr Output: ∂k_cond/∂r_eff [s⁻¹ m⁻¹]
+    /// @param dk_dN Output: ∂k_cond/∂N [s⁻¹ m³ #⁻¹]
+    void ComputeValueAndDerivatives(double r_eff, double N, double T, double& k_cond, double& dk_dr, double& dk_dN) const
+    {
+      ComputeValueAndDerivativesFromMeanFreePath(r_eff, N, MeanFreePath(T), k_cond, dk_dr, dk_dN);
+    }
+
+    /// @brief Compute condensation rate and partial derivatives from a precomputed mean free path
+    /// @details Branch-free, see ComputeValueFromMeanFreePath
+    /// @param r_eff Effective radius [m]
+    /// @param N Number concentration [# m⁻³]
+    /// @param mean_free_path Mean free path λ from MeanFreePath [m]
+    /// @param k_cond Output: condensation rate [s⁻¹]
+    /// @param dk_dr Output: ∂k_cond/∂r_eff [s⁻¹ m⁻¹]
+    /// @param dk_dN Output: ∂k_cond/∂N [s⁻¹ m³ #⁻¹]
+    void ComputeValueAndDerivativesFromMeanFreePath(
+        double r_eff,
+        double N,
+        double mean_free_path,
+        double& k_cond,
+        double& dk_dr,
+        double& dk_dN) const
+    {
+      // 0.0 for cells with a non-positive input, which evaluate with unit inputs; 1.0 otherwise
+      const double mask = static_cast<double>(!(r_eff <= 0) & !(N <= 0) & !(mean_free_path <= 0));
+      const double r = mask * r_eff + (1.0 - mask);
+      const double n = mask * N + (1.0 - mask);
+      const double lambda = mask * mean_free_path + (1.0 - mask);
+      double Kn = lambda / r;
+      double denom = Kn * Kn + kn_coefficient_ * Kn + f_numerator_;
+      double f = f_numerator_ * (1.0 + Kn) / denom;
+
+      k_cond = mask * (4.0 * std::numbers::pi * r * n * diffusion_coefficient_ * f);
+
+      // df/dKn = 0.75α · (-Kn² - 2Kn + (0.467α - 1)) / denom²
+      // where 0.467 = 0.75 - 0.283
+      double df_dKn =
+          f_numerator_ * (-Kn * Kn - 2.0 * Kn + (0.75 - 0.283) * accommodation_coefficient_ - 1.0) / (denom * denom);
+
+      // dk_cond/dr_eff = 4π·N·D · (f + r_eff · df/dKn · dKn/dr)
+      // where dKn/dr = -Kn / r_eff
+      // simplifies to: 4π·N·D · (f - Kn · df/dKn)
+      dk_dr = mask * (4.0 * std::numbers::pi * n * diffusion_coefficient_ * (f - Kn * df_dKn));
+
+      // dk_cond/dN = k_cond / N  (linear in N)
+      dk_dN = k_cond / n;
+    }
+  };
+
+  /// @brief Provider for condensation rate and its derivatives
+  /// @details Type-erased wrapper around a condensation rate kernel. Kept for compatibility;
+  ///          performance-critical code should capture a FuchsSutuginKernel by value instead,
+  ///          which lets the compiler inline the per-cell calculation.
   struct CondensationRateProvider
   {
     /// @brief Compute condensation rate k_cond [s⁻¹]
@@ -60,13 +195,13 @@ namespace miam
         ComputeValueAndDerivatives;
   };
 
-  /// @brief Factory function to create a CondensationRateProvider
+  /// @brief Factory function to create a FuchsSutuginKernel
   /// @param diffusion_coefficient Gas-phase diffusion coefficient [m² s⁻¹]
   /// @param accommodation_coefficient Mass accommodation coefficient [dimensionless, 0-1]
   /// @param molecular_weight Molecular weight of the gas species [kg mol⁻¹]
-  /// @return A CondensationRateProvider with the Fuchs-Sutugin regime correction
-  inline CondensationRateProvider
-  MakeCondensationRateProvider(double diffusion_coefficient, double accommodation_coefficient, double molecular_weight)
+  /// @return A validated FuchsSutuginKernel
+  inline FuchsSutuginKernel
+  MakeFuchsSutuginKernel(double diffusion_coefficient, double accommodation_coefficient, double molecular_weight)
   {
     if (diffusion_coefficient <= 0)
     {
@@ -87,54 +222,25 @@ namespace miam
       throw MiamException(
           MIAM_ERROR_CATEGORY_CONFIGURATION, MIAM_CONFIGURATION_INVALID_PARAMETER, "Molecular weight must be positive.");
     }
+    return FuchsSutuginKernel{ diffusion_coefficient, accommodation_coefficient, molecular_weight };
+  }
 
-    CondensationRateProvider provider;
-
-    provider.ComputeValue = [diffusion_coefficient, accommodation_coefficient, molecular_weight](
-                                double r_eff, double N, double T) -> double
-    {
-      if (r_eff <= 0 || N <= 0 || T <= 0)
-        return 0.0;
-      double c_bar = std::sqrt(8.0 * micm::constants::GAS_CONSTANT * T / (std::numbers::pi * molecular_weight));
-      double lambda = 3.0 * diffusion_coefficient / c_bar;
-      double Kn = lambda / r_eff;
-      double denom = Kn * Kn + (1.0 + 0.283 * accommodation_coefficient) * Kn + 0.75 * accommodation_coefficient;
-      double f = 0.75 * accommodation_coefficient * (1.0 + Kn) / denom;
-      return 4.0 * std::numbers::pi * r_eff * N * diffusion_coefficient * f;
-    };
-
-    provider.ComputeValueAndDerivatives = [diffusion_coefficient, accommodation_coefficient, molecular_weight](
-                                              double r_eff, double N, double T, double& k_cond, double& dk_dr, double& dk_dN)
-    {
-      if (r_eff <= 0 || N <= 0 || T <= 0)
-      {
-        k_cond = 0.0;
-        dk_dr = 0.0;
-        dk_dN = 0.0;
-        return;
-      }
-      double c_bar = std::sqrt(8.0 * micm::constants::GAS_CONSTANT * T / (std::numbers::pi * molecular_weight));
-      double lambda = 3.0 * diffusion_coefficient / c_bar;
-      double Kn = lambda / r_eff;
-      double denom = Kn * Kn + (1.0 + 0.283 * accommodation_coefficient) * Kn + 0.75 * accommodation_coefficient;
-      double f = 0.75 * accommodation_coefficient * (1.0 + Kn) / denom;
-
-      k_cond = 4.0 * std::numbers::pi * r_eff * N * diffusion_coefficient * f;
-
-      // df/dKn = 0.75α · (-Kn² - 2Kn + (0.467α - 1)) / denom²
-      // where 0.467 = 0.75 - 0.283
-      double df_dKn = 0.75 * accommodation_coefficient *
-                      (-Kn * Kn - 2.0 * Kn + (0.75 - 0.283) * accommodation_coefficient - 1.0) / (denom * denom);
-
-      // dk_cond/dr_eff = 4π·N·D · (f + r_eff · df/dKn · dKn/dr)
-      // where dKn/dr = -Kn / r_eff
-      // simplifies to: 4π·N·D · (f - Kn · df/dKn)
-      dk_dr = 4.0 * std::numbers::pi * N * diffusion_coefficient * (f - Kn * df_dKn);
-
-      // dk_cond/dN = k_cond / N  (linear in N)
-      dk_dN = k_cond / N;
-    };
+  /// @brief Factory function to create a CondensationRateProvider
+  /// @param diffusion_coefficient Gas-phase diffusion coefficient [m² s⁻¹]
+  /// @param accommodation_coefficient Mass accommodation coefficient [dimensionless, 0-1]
+  /// @param molecular_weight Molecular weight of the gas species [kg mol⁻¹]
+  /// @return A CondensationRateProvider with the Fuchs-Sutugin regime correction
+  inline CondensationRateProvider
+  MakeCondensationRateProvider(double diffusion_coefficient, double accommodation_coefficient, double molecular_weight)
+  {
+    auto kernel = MakeFuchsSutuginKernel(diffusion_coefficient, accommodation_coefficient, molecular_weight);
 
+    CondensationRateProvider provider;
+    provider.ComputeValue = [kernel](double r_eff, double N, double T) -> double
+    { return kernel.ComputeValue(r_eff, N, T); };
+    provider.ComputeValueAndDerivatives =
+        [kernel](double r_eff, double N, double T, double& k_cond, double& dk_dr, double& dk_dN)
+    { kernel.ComputeValueAndDerivatives(r_eff, N, T, k_cond, dk_dr, dk_dN); };
     return provider;
   }
 }  // namespace miam
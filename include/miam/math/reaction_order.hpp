@@ -0,0 +1,57 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace miam
+{
+  /// @brief Reaction order marker for kernels that take the order at run time
+  inline constexpr int kGenericReactionOrder = 0;
+
+  /// @brief Reaction order of the next-higher power, e.g. for the solvent partial (S+δ)^(n+1)
+  template<int Order>
+  inline constexpr int kNextReactionOrder = Order == kGenericReactionOrder ? kGenericReactionOrder : Order + 1;
+
+  /// @brief Raises x to the power of a reaction order
+  /// @tparam Order Exponent fixed at compile time, or kGenericReactionOrder to use `order`
+  /// @param x Base
+  /// @param order Exponent; must equal Order unless Order is kGenericReactionOrder
+  /// @details For a fixed order the power unrolls into Order - 1 multiplies, which keeps the
+  ///          per-cell loops of the solvent-normalized rate kernels free of calls to std::pow
+  template<int Order>
+  inline double ReactionOrderPower(double x, std::size_t order)
+  {
+    if constexpr (Order == kGenericReactionOrder)
+    {
+      return std::pow(x, static_cast<double>(order));
+    }
+    else
+    {
+      double result = x;
+      for (int i = 1; i < Order; ++i)
+        result *= x;
+      return result;
+    }
+  }
+
+  /// @brief Calls a kernel factory with the reaction order as a compile-time constant
+  /// @param order Reaction order known when the kernel is built
+  /// @param factory Callable taking std::integral_constant<int, Order>; orders 1-3 are passed
+  ///        through, higher orders map to kGenericReactionOrder
+  /// @return The factory's result (every instantiation must return the same type)
+  template<typename Factory>
+  inline auto DispatchReactionOrder(std::size_t order, Factory&& factory)
+  {
+    switch (order)
+    {
+      case 1: return factory(std::integral_constant<int, 1>{});
+      case 2: return factory(std::integral_constant<int, 2>{});
+      case 3: return factory(std::integral_constant<int, 3>{});
+      default: return factory(std::integral_constant<int, kGenericReactionOrder>{});
+    }
+  }
+}  // namespace miam
@@ -0,0 +1,176 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/cell_blocks.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Criterion that decides in which grid cells a representation is present
+  /// @details A representation is active in a grid cell when the state variable exceeds the threshold,
+  ///          e.g. the solvent concentration of a cloud droplet mode ("CLOUD.AQUEOUS.H2O") or the number
+  ///          concentration of a two-moment mode.
+  struct ActivityThreshold
+  {
+    std::string variable_;    ///< Full state variable name
+    double threshold_{ 0.0 };  ///< Value the variable must exceed [state variable units]
+  };
+
+  /// @brief Evaluates a forcing or Jacobian function only in the grid cells where it is active
+  /// @details A grid cell is active when any of the (state variable column, threshold) criteria holds. On
+  ///          each call the active cells are found from the state variables; if every cell is active the
+  ///          function is evaluated in place and if none is, not at all. Otherwise the active cells are
+  ///          gathered into compact matrices, the function is evaluated on them and the output is scattered
+  ///          back, so inactive cells keep their output unchanged. Only the values the function uses are
+  ///          moved: the state parameter and variable columns it reads, and the output values it writes
+  ///          (an empty list moves every value).
+  ///
+  ///          The compact matrices grow geometrically and are never shrunk, so they are reallocated only a
+  ///          logarithmic number of times however the active cells change; the sparsity pattern of the
+  ///          output is read once. The function sweeps every row of the compact matrices, so rows past the
+  ///          active cells are filled with the last active cell and their output is discarded.
+  ///
+  ///          The process kernels compute every grid cell independently of the others, so the result in
+  ///          active cells is bitwise identical to evaluating all cells.
+  /// @tparam OutputPolicy Matrix updated in place (forcing or Jacobian)
+  /// @tparam DenseMatrixPolicy Matrix type of the state parameters and variables
+  template<typename OutputPolicy, typename DenseMatrixPolicy>
+  class ActiveCellEvaluator
+  {
+   public:
+    using Function = std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, OutputPolicy&)>;
+
+    /// @brief Columns and values the function reads and writes; empty lists stand for all of them
+    struct UsedValues
+    {
+      std::vector<std::size_t> parameter_columns_;  ///< State parameter columns read
+      std::vector<std::size_t> variable_columns_;   ///< State variable columns read
+      std::vector<std::size_t> output_values_;      ///< Per-cell output values written (see CellValueIndex())
+    };
+
+    /// @brief Creates an evaluator
+    /// @param function Function evaluated on the active cells
+    /// @param criteria State variable column and threshold of each criterion
+    /// @param used_values Values the function reads and writes
+    ActiveCellEvaluator(Function function, std::vector<std::pair<std::size_t, double>> criteria, UsedValues used_values = {})
+        : function_(std::move(function)),
+          criteria_(std::move(criteria)),
+          used_values_(std::move(used_values))
+    {
+    }
+
+    ActiveCellEvaluator(const ActiveCellEvaluator&) = delete;
+    ActiveCellEvaluator& operator=(const ActiveCellEvaluator&) = delete;
+
+    /// @brief Evaluates the function in the active grid cells
+    void
+    operator()(const DenseMatrixPolicy& state_parameters, const DenseMatrixPolicy& state_variables, OutputPolicy& output)
+    {
+      const std::size_t number_of_cells = state_variables.NumRows();
+      FindActiveCells(state_variables);
+      if (active_cells_.size() == number_of_cells)
+      {
+        function_(state_parameters, state_variables, output);
+        return;
+      }
+      if (active_cells_.empty())
+        return;
+      if (!output_ || active_cells_.size() > capacity_ || state_parameters.NumColumns() != parameters_.NumColumns() ||
+          state_variables.NumColumns() != variables_.NumColumns())
+        Resize(number_of_cells, state_parameters, state_variables, output);
+      rows_.assign(active_cells_.begin(), active_cells_.end());
+      rows_.resize(capacity_, active_cells_.back());
+      Gather(state_parameters, used_values_.parameter_columns_, parameters_);
+      Gather(state_variables, used_values_.variable_columns_, variables_);
+      Gather(output, used_values_.output_values_, *output_);
+      function_(parameters_, variables_, *output_);
+      if (used_values_.output_values_.empty())
+        ScatterCells(*output_, active_cells_, output);
+      else
+        ScatterCells(*output_, active_cells_, used_values_.output_values_, output);
+    }
+
+    /// @brief Returns the grid cells found active by the last call
+    const std::vector<std::size_t>& ActiveCells() const
+    {
+      return active_cells_;
+    }
+
+    /// @brief Returns the number of grid cells the compact matrices hold
+    std::size_t Capacity() const
+    {
+      return capacity_;
+    }
+
+   private:
+    Function function_;                                                 ///< Function evaluated on the active cells
+    std::vector<std::pair<std::size_t, double>> criteria_;              ///< (state variable column, threshold) pairs
+    UsedValues used_values_;                                            ///< Values gathered and scattered
+    std::vector<std::size_t> active_cells_;                             ///< Active cells of the current call
+    std::vector<std::size_t> rows_;                                     ///< Cell gathered into each compact row
+    std::size_t capacity_{ 0 };                                         ///< Number of cells the compact matrices hold
+    std::vector<std::pair<std::size_t, std::size_t>> output_elements_;  ///< Sparsity pattern of a sparse output
+    DenseMatrixPolicy parameters_{};                                    ///< Compact state parameters
+    DenseMatrixPolicy variables_{};                                     ///< Compact state variables
+    std::optional<OutputPolicy> output_{};                              ///< Compact output
+
+    void FindActiveCells(const DenseMatrixPolicy& state_variables)
+    {
+      const std::size_t n = ValuesPerCell(state_variables);
+      const auto& values = state_variables.AsVector();
+      active_cells_.clear();
+      for (std::size_t cell = 0; cell < state_variables.NumRows(); ++cell)
+      {
+        for (const auto& [column, threshold] : criteria_)
+        {
+          if (values[CellValueIndex<DenseMatrixPolicy>(cell, column, n)] > threshold)
+          {
+            active_cells_.push_back(cell);
+            break;
+          }
+        }
+      }
+    }
+
+    template<typename MatrixPolicy>
+    void Gather(const MatrixPolicy& matrix, const std::vector<std::size_t>& values, MatrixPolicy& compact_matrix) const
+    {
+      if (values.empty())
+        GatherCells(matrix, rows_, compact_matrix);
+      else
+        GatherCells(matrix, rows_, values, compact_matrix);
+    }
+
+    void Resize(
+        std::size_t number_of_cells,
+        const DenseMatrixPolicy& state_parameters,
+        const DenseMatrixPolicy& state_variables,
+        const OutputPolicy& output)
+    {
+      const bool same_columns = output_ && state_parameters.NumColumns() == parameters_.NumColumns() &&
+                                state_variables.NumColumns() == variables_.NumColumns();
+      capacity_ = std::min(number_of_cells, std::max(active_cells_.size(), same_columns ? 2 * capacity_ : 0));
+      parameters_ = MakeCellBlockMatrix(state_parameters, capacity_);
+      variables_ = MakeCellBlockMatrix(state_variables, capacity_);
+      if constexpr (requires { output.FlatBlockSize(); })
+      {
+        if (output_elements_.empty())
+          output_elements_ = NonZeroElements(output);
+        output_.emplace(MakeCellBlockMatrix(output, capacity_, output_elements_));
+      }
+      else
+      {
+        output_.emplace(MakeCellBlockMatrix(output, capacity_));
+      }
+    }
+  };
+}  // namespace miam
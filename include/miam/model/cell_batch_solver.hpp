@@ -0,0 +1,240 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/active_cells.hpp>
+#include <miam/model/model.hpp>
+#include <miam/util/error.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Grid cells that have the same set of active representations
+  struct CellBatch
+  {
+    std::set<std::string> active_representations_;  ///< Prefixes of the representations present in the cells
+    std::vector<std::size_t> cells_;                 ///< Grid cells of the batch, in ascending order
+    std::uint64_t activity_mask_{ 0 };               ///< Bit i: i-th thresholded representation (prefix order) active
+  };
+
+  /// @brief Groups the grid cells by the set of representations active in them
+  /// @details A representation with an entry in `thresholds` is active in a cell when its state variable
+  ///          exceeds the threshold; representations without an entry are active everywhere. With a
+  ///          cloud and an aerosol threshold this splits the grid into e.g. clear, cloud-only and
+  ///          cloud+aerosol batches. Cells are keyed by a bitmask over the thresholded representations, and
+  ///          each distinct mask is converted to its set of prefixes once.
+  /// @param representation_prefixes Prefixes of all representations (see Model::RepresentationPrefixes())
+  /// @param thresholds Activity thresholds keyed by representation prefix
+  /// @param state_variable_indices Map of state variable names to their column in `state_variables`
+  /// @param state_variables State variables (grid cells x variables)
+  /// @return The non-empty batches, ordered by their set of active representations
+  template<typename DenseMatrixPolicy>
+  std::vector<CellBatch> PartitionCellsByActivity(
+      const std::set<std::string>& representation_prefixes,
+      const std::map<std::string, ActivityThreshold>& thresholds,
+      const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+      const DenseMatrixPolicy& state_variables)
+  {
+    std::vector<std::pair<std::string, std::pair<std::size_t, double>>> criteria;
+    std::set<std::string> always_active;
+    for (const auto& prefix : representation_prefixes)
+    {
+      auto threshold_it = thresholds.find(prefix);
+      if (threshold_it == thresholds.end())
+      {
+        always_active.insert(prefix);
+        continue;
+      }
+      auto variable_it = state_variable_indices.find(threshold_it->second.variable_);
+      if (variable_it == state_variable_indices.end())
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "Active cell threshold of representation '" + prefix + "' uses unknown state variable '" +
+                threshold_it->second.variable_ + "'");
+      criteria.push_back({ prefix, { variable_it->second, threshold_it->second.threshold_ } });
+    }
+    if (criteria.size() > 64)
+      throw MiamException(
+          MIAM_ERROR_CATEGORY_CONFIGURATION,
+          MIAM_CONFIGURATION_INVALID_PARAMETER,
+          "At most 64 representations can have an active cell threshold");
+
+    std::map<std::uint64_t, std::vector<std::size_t>> cells_by_mask;
+    for (std::size_t cell = 0; cell < state_variables.NumRows(); ++cell)
+    {
+      std::uint64_t mask = 0;
+      for (std::size_t bit = 0; bit < criteria.size(); ++bit)
+        if (state_variables[cell][criteria[bit].second.first] > criteria[bit].second.second)
+          mask |= std::uint64_t{ 1 } << bit;
+      cells_by_mask[mask].push_back(cell);
+    }
+
+    std::vector<CellBatch> batches;
+    for (auto& [mask, cells] : cells_by_mask)
+    {
+      std::set<std::string> active = always_active;
+      for (std::size_t bit = 0; bit < criteria.size(); ++bit)
+        if (mask & (std::uint64_t{ 1 } << bit))
+          active.insert(criteria[bit].first);
+      batches.push_back(CellBatch{ std::move(active), std::move(cells), mask });
+    }
+    std::sort(
+        batches.begin(),
+        batches.end(),
+        [](const CellBatch& a, const CellBatch& b) { return a.active_representations_ < b.active_representations_; });
+    return batches;
+  }
+
+  /// @brief Solves a grid in batches of cells, each with a Model specialized to its active representations
+  /// @details On each Solve() the grid cells are grouped with PartitionCellsByActivity(), using the
+  ///          Model's ModelOptions::active_cell_thresholds_. Each batch is solved by a solver for
+  ///          Model::Specialize() of its active representations, so e.g. clear-sky cells integrate only
+  ///          the gas phase and skip the aqueous processes and algebraic constraints entirely. The cells of a
+  ///          batch are gathered into a solver state of the batch size, solved, and their state variables
+  ///          are scattered back; variables of inactive representations keep their values.
+  ///
+  ///          Solvers are built on first use of a set of active representations and kept for later
+  ///          calls, keyed by the activity bitmask of the batch. Each variant's batch state grows
+  ///          geometrically up to the grid size and is never shrunk, so it is reallocated only a logarithmic
+  ///          number of times. The solver advances every row of the state, so rows past the batch cells hold
+  ///          a copy of the last batch cell and are not scattered back. State parameters (e.g. representation
+  ///          size parameters) and grid conditions are copied into the batch state, and the batch solver's
+  ///          UpdateStateParameters() is called before its Solve().
+  /// @tparam MakeSolver Callable building a solver from a Model, e.g. a lambda around micm::CpuSolverBuilder
+  ///         with the system and options of the full-grid solver and AddExternalModel(model)
+  template<typename MakeSolver>
+  class CellBatchSolver
+  {
+   public:
+    using Solver = std::invoke_result_t<MakeSolver&, const Model&>;
+    using BatchState = decltype(std::declval<Solver&>().GetState(std::size_t{ 1 }));
+    using Result = decltype(std::declval<Solver&>().Solve(0.0, std::declval<BatchState&>()));
+
+    /// @brief Solver result of one batch
+    struct BatchResult
+    {
+      CellBatch batch_;  ///< Cells of the batch and their active representations
+      Result result_;    ///< Result of the batch solver
+    };
+
+    /// @brief Creates a batched solver
+    /// @param model Full Model, with the activity thresholds of its representations in options_
+    /// @param make_solver Builds the solver of one Model variant
+    CellBatchSolver(Model model, MakeSolver make_solver)
+        : model_(std::move(model)),
+          make_solver_(std::move(make_solver)),
+          representation_prefixes_(model_.RepresentationPrefixes())
+    {
+    }
+
+    /// @brief Advances the state of every grid cell by one time step
+    /// @param time_step Time step [s]
+    /// @param state Full-grid state, e.g. from the solver of a copy of the full Model without activity
+    ///        thresholds (thresholds reject constraints on the representations they mask)
+    /// @return The result of every batch solve
+    template<typename StatePolicy>
+    std::vector<BatchResult> Solve(double time_step, StatePolicy& state)
+    {
+      std::vector<BatchResult> results;
+      for (auto& batch : PartitionCellsByActivity(
+               representation_prefixes_, model_.options_.active_cell_thresholds_, state.variable_map_, state.variables_))
+      {
+        auto& variant = Variant(batch);
+        auto& batch_state = BatchStateFor(variant, batch.cells_.size(), state);
+        for (std::size_t i = 0; i < batch_state.variables_.NumRows(); ++i)
+        {
+          const std::size_t cell = batch.cells_[std::min(i, batch.cells_.size() - 1)];
+          for (const auto& [batch_index, index] : variant.variables_)
+            batch_state.variables_[i][batch_index] = state.variables_[cell][index];
+          for (const auto& [batch_index, index] : variant.parameters_)
+            batch_state.custom_rate_parameters_[i][batch_index] = state.custom_rate_parameters_[cell][index];
+          batch_state.conditions_[i] = state.conditions_[cell];
+        }
+        variant.solver_.UpdateStateParameters(batch_state);
+        auto result = variant.solver_.Solve(time_step, batch_state);
+        for (std::size_t i = 0; i < batch.cells_.size(); ++i)
+        {
+          const std::size_t cell = batch.cells_[i];
+          for (const auto& [batch_index, index] : variant.variables_)
+            state.variables_[cell][index] = batch_state.variables_[i][batch_index];
+        }
+        results.push_back(BatchResult{ std::move(batch), std::move(result) });
+      }
+      return results;
+    }
+
+    /// @brief Returns the number of Model variants built so far
+    std::size_t NumberOfVariants() const
+    {
+      return variants_.size();
+    }
+
+   private:
+    /// @brief Solver of one Model variant and its batch state
+    struct ModelVariant
+    {
+      std::shared_ptr<Model> model_;                               ///< Specialized Model the solver was built from
+      Solver solver_;                                              ///< Solver of the specialized Model
+      std::optional<BatchState> state_{};                          ///< Batch state, sized to the largest batch
+      std::vector<std::pair<std::size_t, std::size_t>> variables_{};   ///< (batch, full) state variable columns
+      std::vector<std::pair<std::size_t, std::size_t>> parameters_{};  ///< (batch, full) state parameter columns
+    };
+
+    Model model_;                                                      ///< Full Model
+    MakeSolver make_solver_;                                           ///< Builds the solver of a variant
+    std::set<std::string> representation_prefixes_;                   ///< Prefixes of all representations
+    std::map<std::uint64_t, std::unique_ptr<ModelVariant>> variants_;  ///< Variants by activity bitmask
+
+    ModelVariant& Variant(const CellBatch& batch)
+    {
+      auto& variant = variants_[batch.activity_mask_];
+      if (!variant)
+      {
+        auto model = std::make_shared<Model>(model_.Specialize(batch.active_representations_));
+        model->options_.active_cell_thresholds_.clear();  // every representation is active in all batch cells
+        variant.reset(new ModelVariant{ model, make_solver_(*model) });
+      }
+      return *variant;
+    }
+
+    template<typename StatePolicy>
+    BatchState& BatchStateFor(ModelVariant& variant, std::size_t number_of_cells, const StatePolicy& state)
+    {
+      const std::size_t capacity = variant.state_ ? variant.state_->variables_.NumRows() : 0;
+      if (number_of_cells <= capacity)
+        return *variant.state_;
+      variant.state_.emplace(
+          variant.solver_.GetState(std::min(state.variables_.NumRows(), std::max(number_of_cells, 2 * capacity))));
+      auto& batch_state = *variant.state_;
+      variant.variables_.clear();
+      variant.parameters_.clear();
+      for (const auto& [name, batch_index] : batch_state.variable_map_)
+        if (auto it = state.variable_map_.find(name); it != state.variable_map_.end())
+          variant.variables_.emplace_back(batch_index, it->second);
+      for (const auto& [name, batch_index] : batch_state.custom_rate_parameter_map_)
+        if (auto it = state.custom_rate_parameter_map_.find(name); it != state.custom_rate_parameter_map_.end())
+          variant.parameters_.emplace_back(batch_index, it->second);
+      if constexpr (requires { batch_state.absolute_tolerance_; })
+        for (const auto& [batch_index, index] : variant.variables_)
+          batch_state.absolute_tolerance_[batch_index] = state.absolute_tolerance_[index];
+      if constexpr (requires { batch_state.relative_tolerance_; })
+        batch_state.relative_tolerance_ = state.relative_tolerance_;
+      return batch_state;
+    }
+  };
+}  // namespace miam
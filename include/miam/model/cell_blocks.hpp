@@ -0,0 +1,470 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/util/error.hpp>
+#include <miam/util/miam_exception.hpp>
+#include <miam/util/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief A contiguous range of grid cells
+  struct CellBlock
+  {
+    std::size_t first_cell_{ 0 };       ///< Index of the first cell in the block
+    std::size_t number_of_cells_{ 0 };  ///< Number of cells in the block
+  };
+
+  /// @brief Returns the number of grid cells that a matrix type stores interleaved
+  /// @details micm::VectorMatrix and the vector-ordered sparse matrices store L cells per group;
+  ///          row-major matrices store one cell at a time.
+  template<typename MatrixPolicy>
+  constexpr std::size_t CellGroupSize()
+  {
+    if constexpr (requires { MatrixPolicy::GroupVectorSize(); })
+      return MatrixPolicy::GroupVectorSize();
+    else
+      return 1;
+  }
+
+  /// @brief A dense matrix whose flat storage (AsVector()) is laid out in groups of CellGroupSize() cells
+  /// @details Value (cell, column) is stored at (cell / L) * L * NumColumns() + column * L + cell % L, with
+  ///          L = CellGroupSize<MatrixPolicy>(). This is the layout of micm::VectorMatrix<double, L> and,
+  ///          with L = 1, of the row-major micm::Matrix. The last group of a VectorMatrix is padded to L cells.
+  ///          The concept only checks the interface; kernels confirm the layout with RequireCellGroupLayout().
+  template<typename MatrixPolicy>
+  concept CellGroupStorage = !requires(const MatrixPolicy& matrix) { matrix.FlatBlockSize(); } &&
+                             requires(const MatrixPolicy& matrix) {
+                               { matrix.AsVector().data() } -> std::convertible_to<const double*>;
+                               { matrix.NumRows() } -> std::convertible_to<std::size_t>;
+                               { matrix.NumColumns() } -> std::convertible_to<std::size_t>;
+                             };
+
+  /// @brief Returns true if the flat storage of a matrix type really has the CellGroupStorage layout
+  /// @details The order of micm's AsVector() storage is not part of its documented interface, so kernels
+  ///          that index it directly check it here instead of relying on the concept alone. A matrix with a
+  ///          partly filled last cell group is written through operator[] and every value is looked up at its
+  ///          expected flat position. The check runs once per matrix type.
+  template<typename MatrixPolicy>
+  bool HasCellGroupLayout()
+  {
+    static const bool has_layout = []
+    {
+      constexpr std::size_t L = CellGroupSize<MatrixPolicy>();
+      const std::size_t number_of_cells = 2 * L + 1;
+      const std::size_t number_of_columns = 3;
+      MatrixPolicy matrix{ number_of_cells, number_of_columns, 0.0 };
+      for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+        for (std::size_t column = 0; column < number_of_columns; ++column)
+          matrix[cell][column] = 1.0 + static_cast<double>(cell * number_of_columns + column);
+      const auto& flat = matrix.AsVector();
+      if (flat.size() < ((number_of_cells + L - 1) / L) * L * number_of_columns)
+        return false;
+      for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+        for (std::size_t column = 0; column < number_of_columns; ++column)
+          if (flat[(cell / L) * L * number_of_columns + column * L + cell % L] !=
+              1.0 + static_cast<double>(cell * number_of_columns + column))
+            return false;
+      return true;
+    }();
+    return has_layout;
+  }
+
+  /// @brief Throws if the flat storage of a matrix type does not have the CellGroupStorage layout
+  /// @param user Name of the kernel that indexes the flat storage, for the error message
+  template<typename MatrixPolicy>
+  void RequireCellGroupLayout(const std::string& user)
+  {
+    if (!HasCellGroupLayout<MatrixPolicy>())
+      throw MiamException(
+          MIAM_ERROR_CATEGORY_INTERNAL,
+          MIAM_INTERNAL_UNSUPPORTED_MATRIX,
+          "Internal Error: " + user + ": the matrix storage does not have the CellGroupStorage layout");
+  }
+
+  /// @brief Splits the grid cells into at most `number_of_blocks` contiguous, non-empty blocks
+  /// @param number_of_cells Total number of grid cells
+  /// @param number_of_blocks Maximum number of blocks
+  /// @param group_size Every block but the last starts and ends on a multiple of this size
+  /// @return The blocks in cell order
+  inline std::vector<CellBlock>
+  PartitionCells(std::size_t number_of_cells, std::size_t number_of_blocks, std::size_t group_size = 1)
+  {
+    std::vector<CellBlock> blocks;
+    if (number_of_cells == 0 || number_of_blocks == 0)
+      return blocks;
+    group_size = std::max(group_size, std::size_t(1));
+    const std::size_t number_of_groups = (number_of_cells + group_size - 1) / group_size;
+    const std::size_t groups_per_block = (number_of_groups + number_of_blocks - 1) / number_of_blocks;
+    const std::size_t cells_per_block = groups_per_block * group_size;
+    for (std::size_t first = 0; first < number_of_cells; first += cells_per_block)
+      blocks.push_back(CellBlock{ first, std::min(cells_per_block, number_of_cells - first) });
+    return blocks;
+  }
+
+  /// @brief Returns the number of stored values per grid cell of a dense or sparse matrix
+  template<typename MatrixPolicy>
+  std::size_t ValuesPerCell(const MatrixPolicy& matrix)
+  {
+    if constexpr (requires { matrix.FlatBlockSize(); })
+      return matrix.FlatBlockSize();
+    else
+      return matrix.NumColumns();
+  }
+
+  /// @brief Returns the non-zero (row, column) positions of a sparse matrix, in row-major order
+  template<typename SparseMatrixPolicy>
+  std::vector<std::pair<std::size_t, std::size_t>> NonZeroElements(const SparseMatrixPolicy& matrix)
+  {
+    std::vector<std::pair<std::size_t, std::size_t>> elements;
+    for (std::size_t i = 0; i < matrix.NumRows(); ++i)
+      for (std::size_t j = 0; j < matrix.NumRows(); ++j)
+        if (!matrix.IsZero(i, j))
+          elements.emplace_back(i, j);
+    return elements;
+  }
+
+  /// @brief Creates a sparse matrix with the given non-zero elements holding `number_of_cells` grid cells
+  /// @param matrix Matrix the elements were taken from (see NonZeroElements())
+  template<typename SparseMatrixPolicy>
+  SparseMatrixPolicy MakeCellBlockMatrix(
+      const SparseMatrixPolicy& matrix,
+      std::size_t number_of_cells,
+      const std::vector<std::pair<std::size_t, std::size_t>>& elements)
+  {
+    auto builder = SparseMatrixPolicy::Create(matrix.NumRows()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+    for (const auto& [i, j] : elements)
+      builder = builder.WithElement(i, j);
+    return SparseMatrixPolicy(builder);
+  }
+
+  /// @brief Creates a matrix shaped like `matrix` but holding only `number_of_cells` grid cells
+  /// @details Sparse matrices keep the non-zero pattern of `matrix`
+  template<typename MatrixPolicy>
+  MatrixPolicy MakeCellBlockMatrix(const MatrixPolicy& matrix, std::size_t number_of_cells)
+  {
+    if constexpr (requires { matrix.FlatBlockSize(); })
+      return MakeCellBlockMatrix(matrix, number_of_cells, NonZeroElements(matrix));
+    else
+      return MatrixPolicy{ number_of_cells, matrix.NumColumns(), 0.0 };
+  }
+
+  /// @brief Copies the cells of a block into a block-sized matrix
+  /// @details The block must start on a multiple of CellGroupSize(), so its values are one contiguous range
+  template<typename MatrixPolicy>
+  void CopyToCellBlock(const MatrixPolicy& matrix, const CellBlock& block, MatrixPolicy& block_matrix)
+  {
+    const auto& source = matrix.AsVector();
+    auto& destination = block_matrix.AsVector();
+    const std::size_t offset = block.first_cell_ * ValuesPerCell(matrix);
+    const std::size_t count = std::min(destination.size(), source.size() - offset);
+    std::copy(source.begin() + offset, source.begin() + offset + count, destination.begin());
+  }
+
+  /// @brief Copies the grid conditions of a block into a block-sized vector
+  template<typename T>
+  void CopyToCellBlock(const std::vector<T>& values, const CellBlock& block, std::vector<T>& block_values)
+  {
+    block_values.assign(values.begin() + block.first_cell_, values.begin() + block.first_cell_ + block.number_of_cells_);
+  }
+
+  /// @brief Copies a block-sized matrix back into the cells of a block
+  template<typename MatrixPolicy>
+  void CopyFromCellBlock(const MatrixPolicy& block_matrix, const CellBlock& block, MatrixPolicy& matrix)
+  {
+    const auto& source = block_matrix.AsVector();
+    auto& destination = matrix.AsVector();
+    const std::size_t offset = block.first_cell_ * ValuesPerCell(matrix);
+    const std::size_t count = std::min(source.size(), destination.size() - offset);
+    std::copy(source.begin(), source.begin() + count, destination.begin() + offset);
+  }
+
+  /// @brief Copies the listed values of every cell of a block into a block-sized matrix
+  /// @details The block must start on a multiple of CellGroupSize(). Value k of a cell group is a contiguous
+  ///          run of CellGroupSize() values, so each listed value is one short copy per group.
+  /// @param values Value positions within a cell (dense column or sparse element index, see CellValueIndex())
+  template<typename MatrixPolicy>
+  void CopyToCellBlock(
+      const MatrixPolicy& matrix,
+      const CellBlock& block,
+      const std::vector<std::size_t>& values,
+      MatrixPolicy& block_matrix)
+  {
+    constexpr std::size_t L = CellGroupSize<MatrixPolicy>();
+    const std::size_t group_stride = L * ValuesPerCell(matrix);
+    const std::size_t number_of_groups = (block.number_of_cells_ + L - 1) / L;
+    const double* source = matrix.AsVector().data() + block.first_cell_ * ValuesPerCell(matrix);
+    double* destination = block_matrix.AsVector().data();
+    for (std::size_t group = 0; group < number_of_groups; ++group)
+      for (std::size_t k : values)
+        std::copy_n(source + group * group_stride + k * L, L, destination + group * group_stride + k * L);
+  }
+
+  /// @brief Copies the listed values of every cell of a block-sized matrix back into the cells of a block
+  template<typename MatrixPolicy>
+  void CopyFromCellBlock(
+      const MatrixPolicy& block_matrix,
+      const CellBlock& block,
+      const std::vector<std::size_t>& values,
+      MatrixPolicy& matrix)
+  {
+    constexpr std::size_t L = CellGroupSize<MatrixPolicy>();
+    const std::size_t group_stride = L * ValuesPerCell(matrix);
+    const std::size_t number_of_groups = (block.number_of_cells_ + L - 1) / L;
+    const double* source = block_matrix.AsVector().data();
+    double* destination = matrix.AsVector().data() + block.first_cell_ * ValuesPerCell(matrix);
+    for (std::size_t group = 0; group < number_of_groups; ++group)
+      for (std::size_t k : values)
+        std::copy_n(source + group * group_stride + k * L, L, destination + group * group_stride + k * L);
+  }
+
+  /// @brief Returns the position of value `k` of grid cell `cell` in the flat data of a matrix
+  /// @details Cells are stored in groups of CellGroupSize() with the values of a group interleaved, which
+  ///          reduces to row-major storage for a group size of 1.
+  template<typename MatrixPolicy>
+  std::size_t CellValueIndex(std::size_t cell, std::size_t k, std::size_t values_per_cell)
+  {
+    constexpr std::size_t L = CellGroupSize<MatrixPolicy>();
+    return (cell / L) * L * values_per_cell + k * L + cell % L;
+  }
+
+  /// @brief Copies the listed grid cells of a matrix, in list order, into a matrix of at least that many cells
+  template<typename MatrixPolicy>
+  void GatherCells(const MatrixPolicy& matrix, const std::vector<std::size_t>& cells, MatrixPolicy& compact_matrix)
+  {
+    const std::size_t n = ValuesPerCell(matrix);
+    const auto& source = matrix.AsVector();
+    auto& destination = compact_matrix.AsVector();
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (std::size_t k = 0; k < n; ++k)
+        destination[CellValueIndex<MatrixPolicy>(i, k, n)] = source[CellValueIndex<MatrixPolicy>(cells[i], k, n)];
+  }
+
+  /// @brief Copies a matrix filled by GatherCells() back into the listed grid cells
+  template<typename MatrixPolicy>
+  void ScatterCells(const MatrixPolicy& compact_matrix, const std::vector<std::size_t>& cells, MatrixPolicy& matrix)
+  {
+    const std::size_t n = ValuesPerCell(matrix);
+    const auto& source = compact_matrix.AsVector();
+    auto& destination = matrix.AsVector();
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (std::size_t k = 0; k < n; ++k)
+        destination[CellValueIndex<MatrixPolicy>(cells[i], k, n)] = source[CellValueIndex<MatrixPolicy>(i, k, n)];
+  }
+
+  /// @brief Copies the listed values of the listed grid cells, in list order, into a matrix of at least that many cells
+  /// @param values Value positions within a cell (dense column or sparse element index, see CellValueIndex())
+  template<typename MatrixPolicy>
+  void GatherCells(
+      const MatrixPolicy& matrix,
+      const std::vector<std::size_t>& cells,
+      const std::vector<std::size_t>& values,
+      MatrixPolicy& compact_matrix)
+  {
+    const std::size_t n = ValuesPerCell(matrix);
+    const auto& source = matrix.AsVector();
+    auto& destination = compact_matrix.AsVector();
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (const auto k : values)
+        destination[CellValueIndex<MatrixPolicy>(i, k, n)] = source[CellValueIndex<MatrixPolicy>(cells[i], k, n)];
+  }
+
+  /// @brief Copies the listed values of a matrix filled by GatherCells() back into the listed grid cells
+  template<typename MatrixPolicy>
+  void ScatterCells(
+      const MatrixPolicy& compact_matrix,
+      const std::vector<std::size_t>& cells,
+      const std::vector<std::size_t>& values,
+      MatrixPolicy& matrix)
+  {
+    const std::size_t n = ValuesPerCell(matrix);
+    const auto& source = compact_matrix.AsVector();
+    auto& destination = matrix.AsVector();
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (const auto k : values)
+        destination[CellValueIndex<MatrixPolicy>(cells[i], k, n)] = source[CellValueIndex<MatrixPolicy>(i, k, n)];
+  }
+
+  /// @brief Evaluates a cell-wise function on blocks of grid cells in parallel
+  /// @details Holds one copy of the function per block, built by the Model so that no function state
+  ///          (property caches, workspaces) is shared between threads. On each call the cells are split into
+  ///          one block per function copy, aligned to the CellGroupSize() of every matrix, so every block is
+  ///          one contiguous range of each matrix's flat data. The functions sweep every row of the matrices
+  ///          they are given, so each block runs on block-sized matrices that own their storage: only the
+  ///          input columns the functions read (the state parameters and variables of the Model) are copied
+  ///          in, and only the output values they write (the forcing or residual columns, the Jacobian
+  ///          elements) are copied in and back out. Values the functions never touch, such as the columns of
+  ///          other models sharing the solver state or the solver's own Jacobian entries, are not moved.
+  ///
+  ///          The process and constraint kernels compute every grid cell independently of the others, so
+  ///          the result is bitwise identical to a serial evaluation for any number of threads. The
+  ///          block-sized matrices are reallocated only when the number of grid cells changes.
+  ///
+  ///          The arguments of a call travel with its ThreadPool::ParallelFor() task. The function copies and
+  ///          block workspaces hold per-evaluation state, so concurrent calls (e.g. through copies of one Model
+  ///          function) take turns using them, as ThreadPool::ParallelFor() calls already do.
+  /// @tparam OutputPolicy Matrix updated in place (forcing, Jacobian, residual or state parameters)
+  /// @tparam InputPolicies Read-only per-cell inputs (dense matrices or std::vector<micm::Conditions>)
+  template<typename OutputPolicy, typename... InputPolicies>
+  class CellBlockEvaluator
+  {
+   public:
+    using Function = std::function<void(const InputPolicies&..., OutputPolicy&)>;
+
+    /// @brief Per-cell values read from each input (dense columns, see CellValueIndex()); empty for all
+    /// @details Inputs that are not matrices, such as the grid conditions, are always copied whole
+    using InputValues = std::array<std::vector<std::size_t>, sizeof...(InputPolicies)>;
+
+    /// @brief Creates an evaluator
+    /// @param pool Thread pool the blocks run on
+    /// @param functions One independent copy of the function per block
+    /// @param output_values Per-cell output values the functions write (see CellValueIndex()); empty for all
+    /// @param input_values Per-cell values the functions read from each input
+    CellBlockEvaluator(
+        std::shared_ptr<ThreadPool> pool,
+        std::vector<Function> functions,
+        std::vector<std::size_t> output_values = {},
+        InputValues input_values = {})
+        : pool_(std::move(pool)),
+          functions_(std::move(functions)),
+          output_values_(std::move(output_values)),
+          input_values_(std::move(input_values))
+    {
+    }
+
+    CellBlockEvaluator(const CellBlockEvaluator&) = delete;
+    CellBlockEvaluator& operator=(const CellBlockEvaluator&) = delete;
+
+    /// @brief Evaluates the function for all grid cells
+    void operator()(const InputPolicies&... inputs, OutputPolicy& output)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const std::size_t number_of_cells = NumberOfCells(output);
+      if (number_of_cells != number_of_cells_)
+        Resize(number_of_cells, output);
+      Call call{ std::make_tuple(&inputs...), &output };
+      const std::function<void(std::size_t)> task = [this, &call](std::size_t i) { EvaluateBlock(call, i); };
+      pool_->ParallelFor(blocks_.size(), task);
+    }
+
+   private:
+    /// @brief Block-sized copies of the inputs and output of one block
+    struct BlockData
+    {
+      CellBlock cells_;
+      std::tuple<InputPolicies...> inputs_;
+      OutputPolicy output_;
+    };
+
+    /// @brief Arguments of one call
+    struct Call
+    {
+      std::tuple<const InputPolicies*...> inputs_;  ///< Inputs of the call
+      OutputPolicy* output_;                        ///< Output of the call
+    };
+
+    std::shared_ptr<ThreadPool> pool_;        ///< Pool the blocks run on
+    std::vector<Function> functions_;         ///< One function copy per block
+    std::vector<std::size_t> output_values_;  ///< Per-cell output values written; empty for all
+    InputValues input_values_;                ///< Per-cell values read from each input; empty for all
+    std::mutex mutex_;                        ///< Guards the function copies and workspaces during a call
+    std::vector<BlockData> blocks_;           ///< Block-sized workspaces
+    std::size_t number_of_cells_{ 0 };        ///< Number of grid cells the blocks cover
+
+    /// @brief Returns the block alignment that keeps every input and output group whole
+    static constexpr std::size_t GroupSize()
+    {
+      std::size_t size = CellGroupSize<OutputPolicy>();
+      ((size = std::lcm(size, CellGroupSize<InputPolicies>())), ...);
+      return size;
+    }
+
+    static std::size_t NumberOfCells(const OutputPolicy& output)
+    {
+      if constexpr (requires { output.NumberOfBlocks(); })
+        return output.NumberOfBlocks();
+      else
+        return output.NumRows();
+    }
+
+    void Resize(std::size_t number_of_cells, const OutputPolicy& output)
+    {
+      blocks_.clear();
+      for (const auto& cells : PartitionCells(number_of_cells, functions_.size(), GroupSize()))
+      {
+        blocks_.push_back(
+            BlockData{ cells, std::tuple<InputPolicies...>{}, MakeCellBlockMatrix(output, cells.number_of_cells_) });
+      }
+      number_of_cells_ = number_of_cells;
+    }
+
+    void EvaluateBlock(const Call& call, std::size_t i)
+    {
+      auto& block = blocks_[i];
+      std::apply(
+          [&](auto&... block_inputs)
+          {
+            CopyInputs(call.inputs_, block.cells_, block_inputs..., std::index_sequence_for<InputPolicies...>{});
+            CopyOutput(*call.output_, block.cells_, block.output_);
+            functions_[i](block_inputs..., block.output_);
+          },
+          block.inputs_);
+      if (output_values_.empty())
+        CopyFromCellBlock(block.output_, block.cells_, *call.output_);
+      else
+        CopyFromCellBlock(block.output_, block.cells_, output_values_, *call.output_);
+    }
+
+    template<std::size_t... I>
+    void CopyInputs(
+        const std::tuple<const InputPolicies*...>& inputs,
+        const CellBlock& cells,
+        InputPolicies&... block_inputs,
+        std::index_sequence<I...>) const
+    {
+      (CopyInput(*std::get<I>(inputs), cells, input_values_[I], block_inputs), ...);
+    }
+
+    void CopyOutput(const OutputPolicy& output, const CellBlock& cells, OutputPolicy& block_output) const
+    {
+      if (output_values_.empty())
+        CopyToCellBlock(output, cells, block_output);
+      else
+        CopyToCellBlock(output, cells, output_values_, block_output);
+    }
+
+    template<typename InputPolicy>
+    static void CopyInput(
+        const InputPolicy& input,
+        const CellBlock& cells,
+        const std::vector<std::size_t>& values,
+        InputPolicy& block_input)
+    {
+      if constexpr (requires { input.NumColumns(); })
+      {
+        if (block_input.NumRows() != cells.number_of_cells_ || block_input.NumColumns() != input.NumColumns())
+          block_input = InputPolicy{ cells.number_of_cells_, input.NumColumns(), 0.0 };
+        if (!values.empty())
+        {
+          CopyToCellBlock(input, cells, values, block_input);
+          return;
+        }
+      }
+      CopyToCellBlock(input, cells, block_input);
+    }
+  };
+}  // namespace miam
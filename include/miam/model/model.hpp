@@ -6,10 +6,19 @@
 #include <miam/constraints/dissolved_equilibrium_constraint.hpp>
 #include <miam/constraints/henry_law_equilibrium_constraint.hpp>
 #include <miam/constraints/linear_constraint.hpp>
+#include <miam/model/active_cells.hpp>
+#include <miam/model/cell_blocks.hpp>
+#include <miam/model/model_options.hpp>
+#include <miam/model/process_groups.hpp>
 #include <miam/processes.hpp>
 #include <miam/representations.hpp>
+#include <miam/representations/aerosol_property_cache.hpp>
+#include <miam/util/constant_jacobian.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/profiler.hpp>
+#include <miam/util/sparsity_pattern.hpp>
+#include <miam/util/trace.hpp>
 
 #include <micm/system/conditions.hpp>
 
@@ -17,17 +26,29 @@
 #include <any>
 #include <concepts>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 
 namespace miam
 {
+  /// @brief A constraint whose equations are rows of a LinearConstraintSystem
+  template<typename Constraint>
+  concept HasLinearConstraintRows = requires(
+      const std::remove_cvref_t<Constraint>& constraint,
+      const std::map<std::string, std::set<std::string>>& phase_prefixes,
+      const std::unordered_map<std::string, std::size_t>& indices,
+      LinearConstraintSystem& system) {
+    constraint.AppendLinearConstraintRows(phase_prefixes, indices, indices, system);
+  };
+
   /// @brief Aerosol/Cloud Model
   /// @details Model is a collection of representations that collectively define an aerosol
   ///          and/or cloud system. Model is compatible with the micm::ExternalModelSystem
@@ -35,7 +56,7 @@ namespace miam
   class Model
   {
    public:
-    using RepresentationVariant = std::variant<SingleMomentMode, TwoMomentMode, UniformSection>;
+    using RepresentationVariant = std::variant<SingleMomentMode, TwoMomentMode, UniformSection, SectionalDistribution>;
     using ProcessVariant = std::variant<DissolvedReaction, DissolvedReversibleReaction, HenryLawPhaseTransfer>;
     using ConstraintVariant = std::variant<DissolvedEquilibriumConstraint, HenryLawEquilibriumConstraint, LinearConstraint>;
 
@@ -43,6 +64,13 @@ namespace miam
     std::vector<RepresentationVariant> representations_;
     std::vector<ProcessVariant> processes_{};
     std::vector<ConstraintVariant> constraints_{};
+    ModelOptions options_{};
+#ifdef MIAM_ENABLE_PROFILING
+    /// @brief Call statistics of the functions built from this Model (see GetProfile())
+    /// @details Copies of a Model share the profiler, so the per-thread function copies of a parallel
+    ///          evaluation accumulate into the same entries.
+    std::shared_ptr<Profiler> profiler_{ std::make_shared<Profiler>() };
+#endif
 
     /// @brief Returns the total state size (number of variables, number of parameters)
     std::tuple<std::size_t, std::size_t> StateSize() const
@@ -68,6 +96,7 @@ namespace miam
             auto process_params = process.ProcessParameterNames(phase_prefixes);
             num_parameters += process_params.size();
           });
+      num_parameters += FrozenPropertyParameterNames().size();
       return { num_variables, num_parameters };
     }
 
@@ -89,6 +118,7 @@ namespace miam
     }
 
     /// @brief Returns unique names for all state parameters
+    /// @details Includes the frozen aerosol properties (see FrozenPropertyParameterNames())
     std::set<std::string> StateParameterNames() const
     {
       std::set<std::string> names;
@@ -111,6 +141,30 @@ namespace miam
             auto process_params = process.ProcessParameterNames(phase_prefixes);
             names.insert(process_params.begin(), process_params.end());
           });
+      names.merge(FrozenPropertyParameterNames());
+      return names;
+    }
+
+    /// @brief Returns the names of the state parameters that hold frozen aerosol properties
+    /// @details One parameter per representation instance and property required by a process (see
+    ///          FrozenPropertyParameterName()). Empty unless ModelOptions::frozen_aerosol_properties_ is set.
+    ///          They are listed with the process parameters by StateParameterNames() and computed from the
+    ///          state variables at the start of each Solve() (see UpdateFrozenPropertiesFunction()).
+    std::set<std::string> FrozenPropertyParameterNames() const
+    {
+      std::set<std::string> names;
+      if (!options_.frozen_aerosol_properties_)
+        return names;
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      for (const auto& [phase_name, properties] : CollectRequiredAerosolProperties())
+      {
+        auto it = phase_prefixes.find(phase_name);
+        if (it == phase_prefixes.end())
+          continue;
+        for (const auto& prefix : it->second)
+          for (const auto& property : properties)
+            names.insert(FrozenPropertyParameterName(prefix, property));
+      }
       return names;
     }
 
@@ -196,27 +250,150 @@ namespace miam
       (constraints_.push_back(ConstraintVariant{ constraints.CopyWithNewUuid() }), ...);
     }
 
+    /// @brief Returns the state name prefixes of the representations (e.g. "CLOUD")
+    std::set<std::string> RepresentationPrefixes() const
+    {
+      std::set<std::string> prefixes;
+      for (const auto& repr : representations_)
+        std::visit([&](const auto& r) { prefixes.insert(r.Prefix()); }, repr);
+      return prefixes;
+    }
+
+    /// @brief Returns a copy of the Model restricted to a subset of its representations
+    /// @details Representations not listed are removed, along with every process and constraint that acts on
+    ///          a phase no remaining representation holds (e.g. all aqueous chemistry when no cloud
+    ///          representation is kept). Processes and constraints on phases that remain keep acting on the
+    ///          remaining instances of the phase. Active-cell thresholds of removed representations are
+    ///          dropped; the other options are kept, and processes and constraints keep their UUIDs.
+    /// @param representation_prefixes Prefixes of the representations to keep
+    Model Specialize(const std::set<std::string>& representation_prefixes) const
+    {
+      const auto all_phase_prefixes = CollectPhaseStatePrefixes();
+      Model specialized = *this;
+      std::erase_if(
+          specialized.representations_,
+          [&](const RepresentationVariant& repr)
+          { return !representation_prefixes.contains(std::visit([](const auto& r) { return r.Prefix(); }, repr)); });
+      std::erase_if(
+          specialized.options_.active_cell_thresholds_,
+          [&](const auto& threshold) { return !representation_prefixes.contains(threshold.first); });
+
+      // State name stems ("<prefix>.<phase>.") of the phase instances that no longer exist
+      const auto kept_phase_prefixes = specialized.CollectPhaseStatePrefixes();
+      std::vector<std::string> removed_stems;
+      for (const auto& [phase_name, prefixes] : all_phase_prefixes)
+        if (!kept_phase_prefixes.contains(phase_name))
+          for (const auto& prefix : prefixes)
+            removed_stems.push_back(prefix + "." + phase_name + ".");
+      auto uses_removed_phase = [&](const std::set<std::string>& names)
+      {
+        return std::any_of(
+            names.begin(),
+            names.end(),
+            [&](const std::string& name)
+            {
+              return std::any_of(
+                  removed_stems.begin(),
+                  removed_stems.end(),
+                  [&](const std::string& stem) { return name.starts_with(stem); });
+            });
+      };
+      std::erase_if(
+          specialized.processes_,
+          [&](const ProcessVariant& process)
+          {
+            return std::visit(
+                [&](const auto& p) { return uses_removed_phase(p.SpeciesUsed(all_phase_prefixes)); }, process);
+          });
+      std::erase_if(
+          specialized.constraints_,
+          [&](const ConstraintVariant& constraint)
+          {
+            return std::visit(
+                [&](const auto& c)
+                {
+                  return uses_removed_phase(c.ConstraintSpeciesDependencies(all_phase_prefixes)) ||
+                         uses_removed_phase(c.ConstraintAlgebraicVariableNames(all_phase_prefixes));
+                },
+                constraint);
+          });
+      return specialized;
+    }
+
+    /// @brief Returns the call statistics of every process, constraint and combined Model function
+    /// @details Entries are keyed by type, UUID and function. Each process and constraint has one entry
+    ///          per function it contributes to; "Model" entries (UUID = name_) time the combined functions,
+    ///          including the aerosol property cache updates and the fused mass-action kernel of
+    ///          ModelOptions::compiled_forcing_, which have no entries of their own. The linear constraints
+    ///          are evaluated together and share one "LinearConstraintSystem" entry (UUID = name_). For
+    ///          parallel evaluation each cell block counts as a call and the wall time is summed over threads.
+    ///
+    ///          Statistics are only recorded when MIAM is compiled with MIAM_ENABLE_PROFILING (the CMake
+    ///          option of the same name); otherwise the Model functions carry no instrumentation and
+    ///          the profile is empty.
+    std::vector<ProfileEntry> GetProfile() const
+    {
+#ifdef MIAM_ENABLE_PROFILING
+      return profiler_->Report();
+#else
+      return {};
+#endif
+    }
+
+    /// @brief Zeroes the call statistics returned by GetProfile()
+    void ResetProfile()
+    {
+#ifdef MIAM_ENABLE_PROFILING
+      profiler_->Reset();
+#endif
+    }
+
     /// @brief Returns non-zero Jacobian element positions
+    /// @details Same elements as JacobianSparsityPattern(), converted to the std::set expected by
+    ///          micm::ExternalModelProcessSet
     std::set<std::pair<std::size_t, std::size_t>> NonZeroJacobianElements(
         const std::unordered_map<std::string, std::size_t>& state_indices) const
     {
-      // Collect needed Jacobian element indices from all processes
-      std::set<std::pair<std::size_t, std::size_t>> elements;
+      return JacobianSparsityPattern(state_indices).ToSet();
+    }
+
+    /// @brief Returns the finalized (sorted, unique) non-zero Jacobian element positions
+    /// @details Every process appends its elements to one flat pattern, which is sorted and
+    ///          deduplicated once at the end
+    SparsityPattern JacobianSparsityPattern(const std::unordered_map<std::string, std::size_t>& state_indices) const
+    {
+      SparsityPattern elements;
       auto phase_prefixes = CollectPhaseStatePrefixes();
       ForEachProcess(
           [&](const auto& process)
           {
-            auto process_elements = process.NonZeroJacobianElements(phase_prefixes, state_indices);
-            elements.insert(process_elements.begin(), process_elements.end());
+            // Frozen aerosol properties do not depend on the state variables, so only direct dependencies remain
+            if constexpr (requires { process.AppendDirectNonZeroJacobianElements(phase_prefixes, state_indices, elements); })
+            {
+              if (options_.frozen_aerosol_properties_)
+              {
+                process.AppendDirectNonZeroJacobianElements(phase_prefixes, state_indices, elements);
+                return;
+              }
+            }
+            process.AppendNonZeroJacobianElements(phase_prefixes, state_indices, elements);
           });
+      elements.Finalize();
       return elements;
     }
 
     /// @brief Returns a function that updates state parameters
+    /// @details The frozen aerosol properties depend on the state variables, which this function does not
+    ///          receive; InitializeConstraintParametersFunction() computes them instead.
     template<typename DenseMatrixPolicy>
     std::function<void(const std::vector<micm::Conditions>&, DenseMatrixPolicy&)> UpdateStateParametersFunction(
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices) const
     {
+      if (IsCellParallel())
+        return CellParallelFunction<DenseMatrixPolicy, std::vector<micm::Conditions>>(
+            [&](const Model& serial)
+            { return serial.UpdateStateParametersFunction<DenseMatrixPolicy>(state_parameter_indices); });
+
       // Collect parameter update functions from all processes and return a combined function
       auto phase_prefixes = CollectPhaseStatePrefixes();
       std::vector<std::function<void(const std::vector<micm::Conditions>&, DenseMatrixPolicy&)>> update_functions;
@@ -225,15 +402,58 @@ namespace miam
           {
             auto update_fn =
                 process.template UpdateStateParametersFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices);
-            update_functions.push_back(update_fn);
+            update_functions.push_back(Instrumented(
+                std::move(update_fn), TypeName(process), process.uuid_, ProfiledFunction::UpdateStateParameters));
           });
-      return [update_functions](const std::vector<micm::Conditions>& conditions, DenseMatrixPolicy& state_parameters)
-      {
-        for (const auto& fn : update_functions)
-        {
-          fn(conditions, state_parameters);
-        }
-      };
+      return Instrumented(
+          std::function<void(const std::vector<micm::Conditions>&, DenseMatrixPolicy&)>{
+              [update_functions](const std::vector<micm::Conditions>& conditions, DenseMatrixPolicy& state_parameters)
+              {
+                for (const auto& fn : update_functions)
+                {
+                  fn(conditions, state_parameters);
+                }
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::UpdateStateParameters);
+    }
+
+    /// @brief Returns a function that computes the frozen aerosol properties from the current state
+    /// @details Only does something when ModelOptions::frozen_aerosol_properties_ is set. It evaluates every
+    ///          aerosol property a process requires and writes it into its FrozenPropertyParameterName() state
+    ///          parameter, where the forcing and Jacobian functions read it for the rest of the step.
+    ///          InitializeConstraintParametersFunction() includes it, so micm runs it at the start of each Solve().
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> UpdateFrozenPropertiesFunction(
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      if (!options_.frozen_aerosol_properties_)
+        return [](const DenseMatrixPolicy&, DenseMatrixPolicy&) {};
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      auto providers =
+          BuildRepresentationProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      auto cache =
+          BuildPropertyCache<DenseMatrixPolicy>(providers, state_parameter_indices, state_variable_indices, true);
+      std::vector<std::pair<std::size_t, std::size_t>> columns;  // (cache entry, state parameter)
+      for (const auto& [prefix, prov_map] : providers)
+        for (const auto& [property, provider] : prov_map)
+          columns.emplace_back(
+              cache->Index(prefix, property), FrozenPropertyParameterIndex(prefix, property, state_parameter_indices));
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)>{
+              [cache, columns](const DenseMatrixPolicy& state_variables, DenseMatrixPolicy& state_parameters)
+              {
+                cache->Update(state_parameters, state_variables);
+                const auto& values = cache->PackedValues();
+                for (std::size_t cell = 0; cell < state_parameters.NumRows(); ++cell)
+                  for (const auto& [entry, parameter] : columns)
+                    state_parameters[cell][parameter] = values[cell][entry];
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::UpdateStateParameters);
     }
 
     /// @brief Returns a function that calculates forcing terms
@@ -242,28 +462,156 @@ namespace miam
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
+      if (IsCellParallel() && options_.process_parallel_forcing_)
+      {
+        if (!options_.active_cell_thresholds_.empty())
+          throw MiamException(
+              MIAM_ERROR_CATEGORY_CONFIGURATION,
+              MIAM_CONFIGURATION_MUTUALLY_EXCLUSIVE_PARAMETERS,
+              "Model '" + name_ + "': process_parallel_forcing_ cannot be combined with active_cell_thresholds_");
+        return ProcessParallelForcingFunction<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices);
+      }
+      if (IsCellParallel())
+        return CellParallelFunction<DenseMatrixPolicy, DenseMatrixPolicy, DenseMatrixPolicy>(
+            [&](const Model& serial)
+            { return serial.ForcingFunction<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices); },
+            ForcingColumns(state_variable_indices),
+            { ParameterColumns(state_parameter_indices), ProcessVariableColumns(state_variable_indices) });
+      if (!options_.active_cell_thresholds_.empty())
+        return ActiveCellFunction<DenseMatrixPolicy, DenseMatrixPolicy>(
+            state_parameter_indices,
+            state_variable_indices,
+            [&](const Model& part)
+            { return part.ForcingFunction<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices); },
+            [&](const Model& part) { return part.ForcingColumns(state_variable_indices); });
+      if (options_.compiled_forcing_)
+        return CompiledForcingFunction<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices);
+
       // Collect forcing functions from all processes and return a combined function
       auto phase_prefixes = CollectPhaseStatePrefixes();
       auto providers = BuildProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      auto cache = BuildPropertyCache<DenseMatrixPolicy>(
+          providers, state_parameter_indices, state_variable_indices, !options_.frozen_aerosol_properties_);
       std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>>
           forcing_functions;
       ForEachProcess(
           [&](const auto& process)
           {
-            auto forcing_fn = process.template ForcingFunction<DenseMatrixPolicy>(
-                phase_prefixes, state_parameter_indices, state_variable_indices, providers);
-            forcing_functions.push_back(forcing_fn);
+            forcing_functions.push_back(ProcessForcingFunction<DenseMatrixPolicy>(
+                process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, cache));
           });
-      return [forcing_functions](
-                 const DenseMatrixPolicy& state_parameters,
-                 const DenseMatrixPolicy& state_variables,
-                 DenseMatrixPolicy& forcing_terms)
-      {
-        for (const auto& fn : forcing_functions)
-        {
-          fn(state_parameters, state_variables, forcing_terms);
-        }
-      };
+      const auto cache_event = TraceEventIndex("AerosolPropertyCache::Update", "Forcing");
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>{
+              [forcing_functions, cache, trace = options_.trace_sink_, cache_event](
+                  const DenseMatrixPolicy& state_parameters,
+                  const DenseMatrixPolicy& state_variables,
+                  DenseMatrixPolicy& forcing_terms)
+              {
+                if (!cache->Empty())
+                {
+                  TraceSpan span(trace.get(), cache_event);
+                  cache->Update(state_parameters, state_variables);
+                }
+                for (const auto& fn : forcing_functions)
+                {
+                  fn(state_parameters, state_variables, forcing_terms);
+                }
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::Forcing);
+    }
+
+    /// @brief Returns a forcing function with all mass-action processes fused into one kernel
+    /// @details Processes are grouped by concrete type at build time. DissolvedReaction and
+    ///          DissolvedReversibleReaction contribute their per-instance index tables to a single
+    ///          flattened MassActionTerms table that is evaluated in one pass over the grid cells.
+    ///          All other processes keep their per-process forcing functions, which run after the
+    ///          fused group. This is the path taken by ForcingFunction when
+    ///          options_.compiled_forcing_ is set.
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> CompiledForcingFunction(
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      auto providers = BuildProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      auto cache = BuildPropertyCache<DenseMatrixPolicy>(
+          providers, state_parameter_indices, state_variable_indices, !options_.frozen_aerosol_properties_);
+      MassActionTerms mass_action_terms;
+      std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>>
+          unfused_functions;
+      ForEachProcess(
+          [&](const auto& process)
+          {
+            if constexpr (requires {
+                            process.AppendMassActionTerms(
+                                phase_prefixes, state_parameter_indices, state_variable_indices, mass_action_terms);
+                          })
+            {
+              if (process.AppendMassActionTerms(
+                      phase_prefixes, state_parameter_indices, state_variable_indices, mass_action_terms))
+                return;
+            }
+            unfused_functions.push_back(ProcessForcingFunction<DenseMatrixPolicy>(
+                process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, cache));
+          });
+      auto mass_action_function = mass_action_terms.template ForcingFunction<DenseMatrixPolicy>();
+      const auto cache_event = TraceEventIndex("AerosolPropertyCache::Update", "Forcing");
+      const auto kernel_event = TraceEventIndex("MassActionTerms::Forcing", "Forcing");
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>{
+              [mass_action_function = std::move(mass_action_function),
+               unfused_functions,
+               cache,
+               trace = options_.trace_sink_,
+               cache_event,
+               kernel_event](
+                  const DenseMatrixPolicy& state_parameters,
+                  const DenseMatrixPolicy& state_variables,
+                  DenseMatrixPolicy& forcing_terms)
+              {
+                if (!cache->Empty())
+                {
+                  TraceSpan span(trace.get(), cache_event);
+                  cache->Update(state_parameters, state_variables);
+                }
+                {
+                  TraceSpan span(trace.get(), kernel_event);
+                  mass_action_function(state_parameters, state_variables, forcing_terms);
+                }
+                for (const auto& fn : unfused_functions)
+                {
+                  fn(state_parameters, state_variables, forcing_terms);
+                }
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::Forcing);
+    }
+
+    /// @brief Returns a forcing function that runs conflict-free groups of processes concurrently
+    /// @details The forcing columns each process writes are the rows of its Jacobian sparsity pattern.
+    ///          Columns of state variables that no representation owns (the gas-phase species) are shared
+    ///          and reduced in process order; the other columns decide the process groups (see
+    ///          ProcessGroupEvaluator). This is the path taken by ForcingFunction when
+    ///          options_.process_parallel_forcing_ and options_.thread_pool_ are set. Every copy of the
+    ///          returned function has its own aerosol property cache and process workspaces (see
+    ///          ProcessParallelForcing).
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>
+    ProcessParallelForcingFunction(
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>{
+              ProcessParallelForcing<DenseMatrixPolicy>{
+                  std::make_shared<const Model>(*this), state_parameter_indices, state_variable_indices } },
+          "Model",
+          name_,
+          ProfiledFunction::Forcing);
     }
 
     /// @brief Returns a function that calculates Jacobian contributions
@@ -273,28 +621,75 @@ namespace miam
         const std::unordered_map<std::string, std::size_t>& state_variable_indices,
         const SparseMatrixPolicy& jacobian) const
     {
+      if (IsCellParallel())
+        return CellParallelFunction<SparseMatrixPolicy, DenseMatrixPolicy, DenseMatrixPolicy>(
+            [&](const Model& serial)
+            {
+              return serial.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                  state_parameter_indices, state_variable_indices, jacobian);
+            },
+            JacobianValues(JacobianSparsityPattern(state_variable_indices), jacobian),
+            { ParameterColumns(state_parameter_indices), ProcessVariableColumns(state_variable_indices) });
+      if (!options_.active_cell_thresholds_.empty())
+        return ActiveCellFunction<SparseMatrixPolicy, DenseMatrixPolicy>(
+            state_parameter_indices,
+            state_variable_indices,
+            [&](const Model& part)
+            {
+              return part.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                  state_parameter_indices, state_variable_indices, jacobian);
+            },
+            [&](const Model& part)
+            { return JacobianValues(part.JacobianSparsityPattern(state_variable_indices), jacobian); });
+
       // Collect Jacobian functions from all processes and return a combined function
       auto phase_prefixes = CollectPhaseStatePrefixes();
       auto providers = BuildProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      auto cache = BuildPropertyCache<DenseMatrixPolicy>(
+          providers, state_parameter_indices, state_variable_indices, !options_.frozen_aerosol_properties_);
       std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>>
           jacobian_functions;
       ForEachProcess(
           [&](const auto& process)
           {
-            auto jacobian_fn = process.template JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
-                phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
-            jacobian_functions.push_back(jacobian_fn);
+            std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> jacobian_fn;
+            if constexpr (requires {
+                            process.template JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                                phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, cache);
+                          })
+            {
+              jacobian_fn = process.template JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                  phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, cache);
+            }
+            else
+            {
+              jacobian_fn = process.template JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                  phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
+            }
+            jacobian_functions.push_back(
+                Instrumented(std::move(jacobian_fn), TypeName(process), process.uuid_, ProfiledFunction::Jacobian));
           });
-      return [jacobian_functions](
-                 const DenseMatrixPolicy& state_parameters,
-                 const DenseMatrixPolicy& state_variables,
-                 SparseMatrixPolicy& jacobian)
-      {
-        for (const auto& fn : jacobian_functions)
-        {
-          fn(state_parameters, state_variables, jacobian);
-        }
-      };
+      const auto cache_event = TraceEventIndex("AerosolPropertyCache::UpdateWithPartials", "Jacobian");
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>{
+              [jacobian_functions, cache, trace = options_.trace_sink_, cache_event](
+                  const DenseMatrixPolicy& state_parameters,
+                  const DenseMatrixPolicy& state_variables,
+                  SparseMatrixPolicy& jacobian)
+              {
+                if (!cache->Empty())
+                {
+                  TraceSpan span(trace.get(), cache_event);
+                  cache->UpdateWithPartials(state_parameters, state_variables);
+                }
+                for (const auto& fn : jacobian_functions)
+                {
+                  fn(state_parameters, state_variables, jacobian);
+                }
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::Jacobian);
     }
 
     // ── HasConstraints concept methods ──
@@ -337,6 +732,7 @@ namespace miam
     }
 
     /// @brief Returns a function that diagnoses constraint parameters from current state
+    /// @details Also computes the frozen aerosol properties (see UpdateFrozenPropertiesFunction())
     template<typename DenseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> InitializeConstraintParametersFunction(
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
@@ -344,10 +740,14 @@ namespace miam
     {
       auto phase_prefixes = CollectPhaseStatePrefixes();
       std::vector<std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)>> init_fns;
+      auto linear_system = BuildLinearConstraintSystem(phase_prefixes, state_parameter_indices, state_variable_indices);
+      if (linear_system.HasDiagnosedRows())
+        init_fns.push_back(linear_system.DiagnoseConstantsFunction<DenseMatrixPolicy>());
       ForEachConstraint(
           [&](const auto& c)
           {
-            if constexpr (requires {
+            // Linear constraint constants are diagnosed by the linear constraint system above
+            if constexpr (!HasLinearConstraintRows<decltype(c)> && requires {
                             c.template InitializeConstraintParametersFunction<DenseMatrixPolicy>(
                                 phase_prefixes, state_parameter_indices, state_variable_indices);
                           })
@@ -356,6 +756,9 @@ namespace miam
                   phase_prefixes, state_parameter_indices, state_variable_indices));
             }
           });
+      if (options_.frozen_aerosol_properties_)
+        init_fns.push_back(
+            UpdateFrozenPropertiesFunction<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices));
       return [init_fns](const DenseMatrixPolicy& state_variables, DenseMatrixPolicy& state_parameters)
       {
         for (const auto& fn : init_fns)
@@ -373,8 +776,11 @@ namespace miam
       ForEachConstraint(
           [&](const auto& c)
           {
-            update_fns.push_back(
-                c.template UpdateConstraintParametersFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices));
+            update_fns.push_back(Instrumented(
+                c.template UpdateConstraintParametersFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices),
+                TypeName(c),
+                c.uuid_,
+                ProfiledFunction::UpdateStateParameters));
           });
       return [update_fns](const std::vector<micm::Conditions>& conditions, DenseMatrixPolicy& state_parameters) mutable
       {
@@ -412,70 +818,462 @@ namespace miam
     }
 
     /// @brief Returns non-zero constraint Jacobian element positions
+    /// @details Same elements as ConstraintJacobianSparsityPattern(), converted to a std::set
     std::set<std::pair<std::size_t, std::size_t>> NonZeroConstraintJacobianElements(
         const std::unordered_map<std::string, std::size_t>& state_indices) const
+    {
+      return ConstraintJacobianSparsityPattern(state_indices).ToSet();
+    }
+
+    /// @brief Returns the finalized (sorted, unique) non-zero constraint Jacobian element positions
+    SparsityPattern ConstraintJacobianSparsityPattern(
+        const std::unordered_map<std::string, std::size_t>& state_indices) const
     {
       auto phase_prefixes = CollectPhaseStatePrefixes();
-      std::set<std::pair<std::size_t, std::size_t>> elements;
-      ForEachConstraint(
-          [&](const auto& c)
-          {
-            auto c_elements = c.NonZeroConstraintJacobianElements(phase_prefixes, state_indices);
-            elements.insert(c_elements.begin(), c_elements.end());
-          });
+      SparsityPattern elements;
+      ForEachConstraint([&](const auto& c)
+                        { c.AppendNonZeroConstraintJacobianElements(phase_prefixes, state_indices, elements); });
+      elements.Finalize();
       return elements;
     }
 
     /// @brief Returns combined constraint residual function G(y) = 0
+    /// @details The rows of every linear constraint are evaluated by one LinearConstraintSystem function; the
+    ///          other constraints contribute their own functions. The profile and trace record that function
+    ///          as a single "LinearConstraintSystem" entry for the model (see Instrumented()).
     template<typename DenseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ConstraintResidualFunction(
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
+      CheckConstraintsAreUnmasked();
+      if (IsCellParallel())
+        return CellParallelFunction<DenseMatrixPolicy, DenseMatrixPolicy, DenseMatrixPolicy>(
+            [&](const Model& serial)
+            {
+              return serial.ConstraintResidualFunction<DenseMatrixPolicy>(
+                  state_parameter_indices, state_variable_indices);
+            },
+            DependentColumns(ConstraintJacobianSparsityPattern(state_variable_indices)),
+            { ParameterColumns(state_parameter_indices),
+              IndependentColumns(ConstraintJacobianSparsityPattern(state_variable_indices)) });
+
       auto phase_prefixes = CollectPhaseStatePrefixes();
       std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>> residual_fns;
+      auto linear_system = BuildLinearConstraintSystem(phase_prefixes, state_parameter_indices, state_variable_indices);
+      if (!linear_system.Empty())
+        residual_fns.push_back(Instrumented(
+            linear_system.ResidualFunction<DenseMatrixPolicy>(),
+            "LinearConstraintSystem",
+            name_,
+            ProfiledFunction::ConstraintResidual));
       ForEachConstraint(
           [&](const auto& c)
           {
-            residual_fns.push_back(c.template ConstraintResidualFunction<DenseMatrixPolicy>(
-                phase_prefixes, state_parameter_indices, state_variable_indices));
+            if constexpr (!HasLinearConstraintRows<decltype(c)>)
+            {
+              residual_fns.push_back(Instrumented(
+                  c.template ConstraintResidualFunction<DenseMatrixPolicy>(
+                      phase_prefixes, state_parameter_indices, state_variable_indices),
+                  TypeName(c),
+                  c.uuid_,
+                  ProfiledFunction::ConstraintResidual));
+            }
           });
-      return [residual_fns](
-                 const DenseMatrixPolicy& state_variables,
-                 const DenseMatrixPolicy& state_parameters,
-                 DenseMatrixPolicy& residual)
-      {
-        for (const auto& fn : residual_fns)
-          fn(state_variables, state_parameters, residual);
-      };
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>{
+              [residual_fns](
+                  const DenseMatrixPolicy& state_variables,
+                  const DenseMatrixPolicy& state_parameters,
+                  DenseMatrixPolicy& residual)
+              {
+                for (const auto& fn : residual_fns)
+                  fn(state_variables, state_parameters, residual);
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::ConstraintResidual);
     }
 
     /// @brief Returns combined constraint Jacobian function (subtracts dG/dy)
+    /// @details Constraints whose Jacobian does not depend on the state (linear constraints) append their
+    ///          entries to one ConstantJacobian, assembled once here and added with one pass over the cell
+    ///          groups per call; the other constraints contribute their own functions. The profile and trace
+    ///          record the ConstantJacobian as a single "LinearConstraintSystem" entry for the model (see
+    ///          Instrumented()).
     template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> ConstraintJacobianFunction(
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices,
         const SparseMatrixPolicy& jacobian) const
     {
+      CheckConstraintsAreUnmasked();
       auto phase_prefixes = CollectPhaseStatePrefixes();
       std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>> jac_fns;
+      ConstantJacobian constant_elements;
       ForEachConstraint(
           [&](const auto& c)
           {
-            jac_fns.push_back(c.template ConstraintJacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
-                phase_prefixes, state_parameter_indices, state_variable_indices, jacobian));
+            if constexpr (requires {
+                            c.AppendConstantConstraintJacobianElements(
+                                phase_prefixes, state_variable_indices, constant_elements);
+                          })
+            {
+              c.AppendConstantConstraintJacobianElements(phase_prefixes, state_variable_indices, constant_elements);
+            }
+            else
+            {
+              jac_fns.push_back(Instrumented(
+                  c.template ConstraintJacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+                      phase_prefixes, state_parameter_indices, state_variable_indices, jacobian),
+                  TypeName(c),
+                  c.uuid_,
+                  ProfiledFunction::ConstraintJacobian));
+            }
           });
-      return [jac_fns](
-                 const DenseMatrixPolicy& state_variables,
+      if (!constant_elements.Empty())
+        jac_fns.insert(
+            jac_fns.begin(),
+            Instrumented(
+                constant_elements.Function<DenseMatrixPolicy, SparseMatrixPolicy>(jacobian),
+                "LinearConstraintSystem",
+                name_,
+                ProfiledFunction::ConstraintJacobian));
+      return Instrumented(
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>{
+              [jac_fns](
+                  const DenseMatrixPolicy& state_variables,
+                  const DenseMatrixPolicy& state_parameters,
+                  SparseMatrixPolicy& jacobian_values) mutable
+              {
+                for (auto& fn : jac_fns)
+                  fn(state_variables, state_parameters, jacobian_values);
+              } },
+          "Model",
+          name_,
+          ProfiledFunction::ConstraintJacobian);
+    }
+
+   private:
+    /// @brief Process-parallel forcing function whose copies each build their own per-call state
+    /// @details The aerosol property cache, the process functions with their workspaces and the
+    ///          ProcessGroupEvaluator are built from a Model copy when the function is created, and built
+    ///          again whenever it is copied, so copies held by solvers running concurrently share only the
+    ///          Model copy and the thread pool. Moving does not rebuild.
+    template<typename DenseMatrixPolicy>
+    class ProcessParallelForcing
+    {
+     public:
+      ProcessParallelForcing(
+          std::shared_ptr<const Model> model,
+          const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+          const std::unordered_map<std::string, std::size_t>& state_variable_indices)
+          : model_(std::move(model)),
+            state_parameter_indices_(state_parameter_indices),
+            state_variable_indices_(state_variable_indices),
+            function_(
+                model_->BuildProcessParallelForcing<DenseMatrixPolicy>(state_parameter_indices, state_variable_indices))
+      {
+      }
+
+      ProcessParallelForcing(const ProcessParallelForcing& other)
+          : ProcessParallelForcing(other.model_, other.state_parameter_indices_, other.state_variable_indices_)
+      {
+      }
+
+      ProcessParallelForcing(ProcessParallelForcing&&) = default;
+
+      ProcessParallelForcing& operator=(const ProcessParallelForcing& other)
+      {
+        return *this = ProcessParallelForcing(other);
+      }
+
+      ProcessParallelForcing& operator=(ProcessParallelForcing&&) = default;
+
+      void operator()(
+          const DenseMatrixPolicy& state_parameters,
+          const DenseMatrixPolicy& state_variables,
+          DenseMatrixPolicy& forcing_terms) const
+      {
+        function_(state_parameters, state_variables, forcing_terms);
+      }
+
+     private:
+      std::shared_ptr<const Model> model_;                                   ///< Model the state is built from
+      std::unordered_map<std::string, std::size_t> state_parameter_indices_;  ///< Host state parameter columns
+      std::unordered_map<std::string, std::size_t> state_variable_indices_;   ///< Host state variable columns
+      std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> function_;
+    };
+
+    /// @brief Builds the cache, process functions and group evaluator of one ProcessParallelForcing
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>
+    BuildProcessParallelForcing(
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      auto providers = BuildProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      auto cache = BuildPropertyCache<DenseMatrixPolicy>(
+          providers, state_parameter_indices, state_variable_indices, !options_.frozen_aerosol_properties_);
+
+      std::size_t number_of_columns = 0;
+      for (const auto& [name, index] : state_variable_indices)
+        number_of_columns = std::max(number_of_columns, index + 1);
+      std::vector<bool> is_shared_column(number_of_columns, false);
+      const auto representation_variables = StateVariableNames();
+      for (const auto& [name, index] : state_variable_indices)
+        is_shared_column[index] = !representation_variables.contains(name);
+
+      std::vector<std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>>
+          forcing_functions;
+      std::vector<std::vector<std::size_t>> written_columns;
+      ForEachProcess(
+          [&](const auto& process)
+          {
+            forcing_functions.push_back(ProcessForcingFunction<DenseMatrixPolicy>(
+                process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, cache));
+            SparsityPattern elements;
+            process.AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements);
+            written_columns.push_back(DependentColumns(std::move(elements)));
+          });
+      auto evaluator = std::make_shared<ProcessGroupEvaluator<DenseMatrixPolicy>>(
+          options_.thread_pool_, std::move(forcing_functions), written_columns, is_shared_column, number_of_columns);
+      const auto cache_event = TraceEventIndex("AerosolPropertyCache::Update", "Forcing");
+      return [evaluator, cache, trace = options_.trace_sink_, cache_event](
                  const DenseMatrixPolicy& state_parameters,
-                 SparseMatrixPolicy& jacobian_values) mutable
+                 const DenseMatrixPolicy& state_variables,
+                 DenseMatrixPolicy& forcing_terms)
       {
-        for (auto& fn : jac_fns)
-          fn(state_variables, state_parameters, jacobian_values);
+        if (!cache->Empty())
+        {
+          TraceSpan span(trace.get(), cache_event);
+          cache->Update(state_parameters, state_variables);
+        }
+        (*evaluator)(state_parameters, state_variables, forcing_terms);
+      };
+    }
+
+    /// @brief Returns true if the Model functions are evaluated on blocks of grid cells in parallel
+    bool IsCellParallel() const
+    {
+      return options_.thread_pool_ && options_.thread_pool_->NumberOfThreads() > 1;
+    }
+
+    /// @brief Throws if a constraint acts on a representation masked by options_.active_cell_thresholds_
+    /// @details A constraint is an algebraic equation that must hold in every grid cell, so its rows cannot be
+    ///          skipped where the representation is inactive. Such models are solved with CellBatchSolver,
+    ///          which removes the inactive representations together with their constraints.
+    void CheckConstraintsAreUnmasked() const
+    {
+      if (options_.active_cell_thresholds_.empty())
+        return;
+      auto names = ConstraintSpeciesDependencies();
+      names.merge(ConstraintAlgebraicVariableNames());
+      for (const auto& [prefix, activity] : options_.active_cell_thresholds_)
+        for (const auto& name : names)
+          if (name.starts_with(prefix + "."))
+            throw MiamException(
+                MIAM_ERROR_CATEGORY_CONFIGURATION,
+                MIAM_CONFIGURATION_MUTUALLY_EXCLUSIVE_PARAMETERS,
+                "Model '" + name_ + "': constraint on '" + name + "' acts on representation '" + prefix +
+                    "', which active_cell_thresholds_ masks; use CellBatchSolver instead");
+    }
+
+    /// @brief Returns the sorted, unique dependent (row) indices of a finalized sparsity pattern
+    static std::vector<std::size_t> DependentColumns(SparsityPattern elements)
+    {
+      std::vector<std::size_t> columns;
+      for (const auto& [dependent, independent] : elements.Finalize())
+        if (columns.empty() || columns.back() != dependent)
+          columns.push_back(dependent);
+      return columns;
+    }
+
+    /// @brief Returns the independent (column) indices of a sparsity pattern, sorted and deduplicated
+    static std::vector<std::size_t> IndependentColumns(SparsityPattern elements)
+    {
+      std::vector<std::size_t> columns;
+      for (const auto& [dependent, independent] : elements.Finalize())
+        columns.push_back(independent);
+      std::sort(columns.begin(), columns.end());
+      columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+      return columns;
+    }
+
+    /// @brief Returns the state variable columns the process functions read
+    /// @details The columns of the full process Jacobian sparsity pattern, which includes the dependencies
+    ///          through aerosol properties
+    std::vector<std::size_t>
+    ProcessVariableColumns(const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      SparsityPattern elements;
+      ForEachProcess([&](const auto& process)
+                     { process.AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements); });
+      return IndependentColumns(std::move(elements));
+    }
+
+    /// @brief Returns the sorted state parameter columns of this Model, including frozen aerosol properties
+    std::vector<std::size_t>
+    ParameterColumns(const std::unordered_map<std::string, std::size_t>& state_parameter_indices) const
+    {
+      std::vector<std::size_t> columns;
+      for (const auto& name : StateParameterNames())
+        if (auto it = state_parameter_indices.find(name); it != state_parameter_indices.end())
+          columns.push_back(it->second);
+      std::sort(columns.begin(), columns.end());
+      return columns;
+    }
+
+    /// @brief Returns the state variable columns the process forcing functions write
+    /// @details The forcing columns each process writes are the rows of its full Jacobian sparsity pattern
+    std::vector<std::size_t> ForcingColumns(const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      SparsityPattern elements;
+      ForEachProcess([&](const auto& process)
+                     { process.AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements); });
+      return DependentColumns(std::move(elements));
+    }
+
+    /// @brief Returns the per-cell value positions (see CellValueIndex()) of Jacobian elements
+    template<typename SparseMatrixPolicy>
+    static std::vector<std::size_t> JacobianValues(SparsityPattern elements, const SparseMatrixPolicy& jacobian)
+    {
+      // Flat offsets in the first cell group; value k of a group starts at k * L
+      constexpr std::size_t L = CellGroupSize<SparseMatrixPolicy>();
+      std::vector<std::size_t> values;
+      for (const auto& [dependent, independent] : elements.Finalize())
+        values.push_back(jacobian.VectorIndex(0, dependent, independent) / L);
+      std::sort(values.begin(), values.end());
+      return values;
+    }
+
+    /// @brief Wraps one serial function per pool thread in a CellBlockEvaluator
+    /// @details The serial functions are built from a copy of this Model without a thread pool. Process
+    ///          functions refer to their process, so the returned function keeps the copy alive.
+    /// @param make_function Builds the serial function from the Model copy
+    /// @param output_values Per-cell output values the serial function writes; empty for all of them
+    /// @param input_values Per-cell values the serial function reads from each input; empty for all of them
+    template<typename OutputPolicy, typename... InputPolicies, typename MakeFunction>
+    std::function<void(const InputPolicies&..., OutputPolicy&)> CellParallelFunction(
+        MakeFunction&& make_function,
+        std::vector<std::size_t> output_values = {},
+        typename CellBlockEvaluator<OutputPolicy, InputPolicies...>::InputValues input_values = {}) const
+    {
+      using Evaluator = CellBlockEvaluator<OutputPolicy, InputPolicies...>;
+      auto serial = std::make_shared<Model>(*this);
+      serial->options_.thread_pool_.reset();
+      std::vector<typename Evaluator::Function> functions;
+      for (std::size_t i = 0; i < options_.thread_pool_->NumberOfThreads(); ++i)
+        functions.push_back(make_function(*serial));
+      auto evaluator = std::make_shared<Evaluator>(
+          options_.thread_pool_, std::move(functions), std::move(output_values), std::move(input_values));
+      return [serial, evaluator](const InputPolicies&... inputs, OutputPolicy& output) { (*evaluator)(inputs..., output); };
+    }
+
+    /// @brief Evaluates groups of processes only in the grid cells where their representations are active
+    /// @details Processes are grouped by the set of masked representations (options_.active_cell_thresholds_)
+    ///          they act on; processes that act on any unmasked representation form the group evaluated in every
+    ///          cell. Each group's function is built from a copy of this Model holding only the group's processes
+    ///          and no masks, so that it has its own aerosol property cache and evaluates properties only in
+    ///          the cells the group is evaluated in. Masked groups are wrapped in an ActiveCellEvaluator.
+    ///          Each evaluator gathers only the state parameters of the Model copy, the state variables its
+    ///          processes depend on and the output values they write.
+    /// @param make_function Builds the function of one group from its Model copy
+    /// @param make_output_values Returns the per-cell output values the function of a Model copy writes
+    template<typename OutputPolicy, typename DenseMatrixPolicy, typename MakeFunction, typename MakeOutputValues>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, OutputPolicy&)> ActiveCellFunction(
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        MakeFunction&& make_function,
+        MakeOutputValues&& make_output_values) const
+    {
+      using Function = std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, OutputPolicy&)>;
+      auto phase_prefixes = CollectPhaseStatePrefixes();
+      const auto representation_prefixes = RepresentationPrefixes();
+      for (const auto& [prefix, activity] : options_.active_cell_thresholds_)
+      {
+        if (!representation_prefixes.contains(prefix))
+          throw MiamException(
+              MIAM_ERROR_CATEGORY_CONFIGURATION,
+              MIAM_CONFIGURATION_INVALID_PARAMETER,
+              "Active cell threshold given for unknown representation '" + prefix + "'");
+        if (state_variable_indices.find(activity.variable_) == state_variable_indices.end())
+          throw MiamException(
+              MIAM_ERROR_CATEGORY_CONFIGURATION,
+              MIAM_CONFIGURATION_INVALID_PARAMETER,
+              "Active cell threshold of representation '" + prefix + "' uses unknown state variable '" +
+                  activity.variable_ + "'");
+      }
+
+      // Group the processes by the masked representations they act on; the empty set is always active
+      std::map<std::set<std::string>, std::vector<ProcessVariant>> groups;
+      for (const auto& process : processes_)
+      {
+        std::set<std::string> masked;
+        bool always_active = false;
+        std::visit(
+            [&](const auto& p)
+            {
+              for (const auto& name : p.SpeciesUsed(phase_prefixes))
+                for (const auto& prefix : representation_prefixes)
+                {
+                  if (!name.starts_with(prefix + "."))
+                    continue;
+                  if (options_.active_cell_thresholds_.contains(prefix))
+                    masked.insert(prefix);
+                  else
+                    always_active = true;
+                }
+            },
+            process);
+        groups[always_active ? std::set<std::string>{} : masked].push_back(process);
+      }
+
+      std::vector<std::shared_ptr<Model>> parts;
+      std::vector<Function> functions;
+      for (auto& [masked, processes] : groups)
+      {
+        auto part = std::make_shared<Model>(*this);
+        part->processes_ = std::move(processes);
+        part->constraints_.clear();
+        part->options_.active_cell_thresholds_.clear();
+        if (masked.empty())
+        {
+          functions.push_back(make_function(*part));
+        }
+        else
+        {
+          std::vector<std::pair<std::size_t, double>> criteria;
+          for (const auto& prefix : masked)
+          {
+            const auto& activity = options_.active_cell_thresholds_.at(prefix);
+            criteria.emplace_back(state_variable_indices.at(activity.variable_), activity.threshold_);
+            part->name_ += (criteria.size() == 1 ? "[" : ",") + prefix;
+          }
+          part->name_ += "]";
+          typename ActiveCellEvaluator<OutputPolicy, DenseMatrixPolicy>::UsedValues used_values;
+          used_values.parameter_columns_ = part->ParameterColumns(state_parameter_indices);
+          used_values.variable_columns_ = part->ProcessVariableColumns(state_variable_indices);
+          used_values.output_values_ = make_output_values(*part);
+          auto evaluator = std::make_shared<ActiveCellEvaluator<OutputPolicy, DenseMatrixPolicy>>(
+              make_function(*part), std::move(criteria), std::move(used_values));
+          functions.push_back(
+              [evaluator](const DenseMatrixPolicy& parameters, const DenseMatrixPolicy& variables, OutputPolicy& output)
+              { (*evaluator)(parameters, variables, output); });
+        }
+        parts.push_back(std::move(part));
+      }
+      return [parts, functions](
+                 const DenseMatrixPolicy& state_parameters, const DenseMatrixPolicy& state_variables, OutputPolicy& output)
+      {
+        for (const auto& fn : functions)
+          fn(state_parameters, state_variables, output);
       };
     }
 
-   private:
     /// @brief Iterate over all registered processes with a generic callable
     template<typename Func>
     void ForEachProcess(Func&& fn) const
@@ -496,16 +1294,195 @@ namespace miam
       }
     }
 
+    /// @brief Assembles the rows of every linear constraint into one LinearConstraintSystem
+    LinearConstraintSystem BuildLinearConstraintSystem(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      LinearConstraintSystem system;
+      ForEachConstraint(
+          [&](const auto& c)
+          {
+            if constexpr (HasLinearConstraintRows<decltype(c)>)
+            {
+              c.AppendLinearConstraintRows(phase_prefixes, state_parameter_indices, state_variable_indices, system);
+            }
+          });
+      return system;
+    }
+
+    /// @brief Wraps a function in a profile counter and a trace span, when enabled
+    /// @details The profile counter is added when MIAM_ENABLE_PROFILING is defined, and the trace span
+    ///          (named "<type>::<function>", with the function as its category) when options_.trace_sink_
+    ///          is set. Otherwise the function is returned unchanged.
+    template<typename Function>
+    Function Instrumented(
+        Function function,
+        const std::string& type,
+        [[maybe_unused]] const std::string& uuid,
+        ProfiledFunction profiled_function) const
+    {
+#ifdef MIAM_ENABLE_PROFILING
+      function = ProfileFunction(std::move(function), profiler_->Register(type, uuid, profiled_function));
+#endif
+      if (options_.trace_sink_)
+        function = TraceFunction(
+            std::move(function),
+            options_.trace_sink_,
+            TraceEventIndex(type + "::" + ToString(profiled_function), ToString(profiled_function), uuid));
+      return function;
+    }
+
+    /// @brief Registers a span kind with options_.trace_sink_, or returns 0 when tracing is off
+    std::size_t TraceEventIndex(const std::string& name, const std::string& category, const std::string& uuid = "") const
+    {
+      return options_.trace_sink_ ? options_.trace_sink_->RegisterEvent(name, category, uuid) : 0;
+    }
+
+    /// @brief Returns the type name of a process or constraint, as used in the profile and trace
+    template<typename T>
+    static std::string TypeName(const T&)
+    {
+      if constexpr (std::same_as<T, DissolvedReaction>)
+        return "DissolvedReaction";
+      else if constexpr (std::same_as<T, DissolvedReversibleReaction>)
+        return "DissolvedReversibleReaction";
+      else if constexpr (std::same_as<T, HenryLawPhaseTransfer>)
+        return "HenryLawPhaseTransfer";
+      else if constexpr (std::same_as<T, DissolvedEquilibriumConstraint>)
+        return "DissolvedEquilibriumConstraint";
+      else if constexpr (std::same_as<T, HenryLawEquilibriumConstraint>)
+        return "HenryLawEquilibriumConstraint";
+      else
+        return "LinearConstraint";
+    }
+
+    /// @brief Returns a process' forcing function, reading aerosol properties from the shared cache when supported
+    template<typename DenseMatrixPolicy, typename ProcessType>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ProcessForcingFunction(
+        const ProcessType& process,
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        const std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>& providers,
+        const std::shared_ptr<AerosolPropertyCache<DenseMatrixPolicy>>& cache) const
+    {
+      std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> forcing_fn;
+      if constexpr (requires {
+                      process.template ForcingFunction<DenseMatrixPolicy>(
+                          phase_prefixes, state_parameter_indices, state_variable_indices, cache);
+                    })
+      {
+        forcing_fn = process.template ForcingFunction<DenseMatrixPolicy>(
+            phase_prefixes, state_parameter_indices, state_variable_indices, cache);
+      }
+      else
+      {
+        forcing_fn = process.template ForcingFunction<DenseMatrixPolicy>(
+            phase_prefixes, state_parameter_indices, state_variable_indices, providers);
+      }
+      return Instrumented(std::move(forcing_fn), TypeName(process), process.uuid_, ProfiledFunction::Forcing);
+    }
+
     /// @brief Build aerosol property providers for all processes
-    /// @details Queries RequiredAerosolProperties() on each process, finds the representation
-    ///          that owns each phase prefix, and calls GetPropertyProvider() to create providers.
+    /// @details The representation providers (see BuildRepresentationProviders()), or, when
+    ///          options_.frozen_aerosol_properties_ is set, providers that read the same properties from their
+    ///          frozen state parameters and have no dependent variables.
     template<typename DenseMatrixPolicy>
     std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> BuildProviders(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      // Collect all required properties across all processes
+      auto providers =
+          BuildRepresentationProviders<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+      if (!options_.frozen_aerosol_properties_)
+        return providers;
+      for (auto& [prefix, prov_map] : providers)
+        for (auto& [property, provider] : prov_map)
+          provider = ParameterPropertyProvider<DenseMatrixPolicy>(
+              FrozenPropertyParameterIndex(prefix, property, state_parameter_indices),
+              state_parameter_indices.size(),
+              state_variable_indices.size());
+      return providers;
+    }
+
+    /// @brief Creates the aerosol property cache shared by the processes of a forcing or Jacobian function
+    /// @details With `fuse` set, each property of a multi-instance representation is registered with
+    ///          AerosolPropertyCache::AddFused(), so the cache computes it for all instances in one pass, with the
+    ///          target phase BuildRepresentationProviders() used for it. Every other provider gets its own entry.
+    /// @param fuse False when the providers are not the representations' own (frozen properties)
+    template<typename DenseMatrixPolicy>
+    std::shared_ptr<AerosolPropertyCache<DenseMatrixPolicy>> BuildPropertyCache(
+        const std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>& providers,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        bool fuse) const
+    {
+      auto cache = std::make_shared<AerosolPropertyCache<DenseMatrixPolicy>>();
+      if (fuse)
+      {
+        if constexpr (CellGroupStorage<DenseMatrixPolicy>)
+        {
+          // BuildRepresentationProviders() keeps the provider of the last phase; AddFused() keeps the first
+          auto required = CollectRequiredAerosolProperties();
+          for (auto it = required.rbegin(); it != required.rend(); ++it)
+            for (const auto& repr : representations_)
+            {
+              std::visit(
+                  [&](const auto& r)
+                  {
+                    if constexpr (requires { r.NumberOfBins(); })
+                    {
+                      if (!r.PhaseStatePrefixes().contains(it->first))
+                        return;
+                      for (const auto& prop : it->second)
+                      {
+                        std::vector<std::string> prefixes;
+                        std::vector<AerosolPropertyProvider<DenseMatrixPolicy>> instance_providers;
+                        for (std::size_t bin = 0; bin < r.NumberOfBins(); ++bin)
+                        {
+                          prefixes.push_back(r.BinPrefix(bin));
+                          instance_providers.push_back(providers.at(prefixes.back()).at(prop));
+                        }
+                        cache->AddFused(
+                            prefixes,
+                            prop,
+                            instance_providers,
+                            r.template GetFusedPropertyProvider<DenseMatrixPolicy>(
+                                prop, state_parameter_indices, state_variable_indices, it->first));
+                      }
+                    }
+                  },
+                  repr);
+            }
+        }
+      }
+      for (const auto& [prefix, prov_map] : providers)
+        for (const auto& [property, provider] : prov_map)
+          cache->Add(prefix, property, provider);
+      return cache;
+    }
+
+    /// @brief Returns the state parameter index of a frozen aerosol property
+    std::size_t FrozenPropertyParameterIndex(
+        const std::string& prefix,
+        AerosolProperty property,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices) const
+    {
+      auto it = state_parameter_indices.find(FrozenPropertyParameterName(prefix, property));
+      if (it == state_parameter_indices.end())
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_INTERNAL,
+            MIAM_INTERNAL_MISSING_STATE_PARAMETER,
+            "Internal Error: Frozen property parameter " + FrozenPropertyParameterName(prefix, property) + " not found");
+      return it->second;
+    }
+
+    /// @brief Collects the aerosol properties required by all processes, keyed by phase name
+    std::map<std::string, std::vector<AerosolProperty>> CollectRequiredAerosolProperties() const
+    {
       std::map<std::string, std::vector<AerosolProperty>> required;
       ForEachProcess(
           [&](const auto& process)
@@ -519,6 +1496,20 @@ namespace miam
                   existing.push_back(prop);
               }
           });
+      return required;
+    }
+
+    /// @brief Build the representations' aerosol property providers for all processes
+    /// @details Queries RequiredAerosolProperties() on each process, finds the representation
+    ///          that owns each phase prefix, and calls GetPropertyProvider() to create providers.
+    template<typename DenseMatrixPolicy>
+    std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>
+    BuildRepresentationProviders(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
+    {
+      auto required = CollectRequiredAerosolProperties();
 
       std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> result;
       if (required.empty())
@@ -535,26 +1526,34 @@ namespace miam
               "BuildProviders: phase not found: " + phase_name);
         }
 
-        for (const auto& prefix : pp_it->second)
+        for (const auto& repr : representations_)
         {
-          for (const auto& repr : representations_)
-          {
-            std::visit(
-                [&](const auto& r)
+          std::visit(
+              [&](const auto& r)
+              {
+                auto repr_prefixes = r.PhaseStatePrefixes();
+                auto phase_it = repr_prefixes.find(phase_name);
+                if (phase_it == repr_prefixes.end())
+                  return;
+                for (const auto& prop : properties)
                 {
-                  auto repr_prefixes = r.PhaseStatePrefixes();
-                  auto phase_it = repr_prefixes.find(phase_name);
-                  if (phase_it != repr_prefixes.end() && phase_it->second.count(prefix))
+                  // Multi-instance representations build the providers of all their instances in one call
+                  if constexpr (requires { r.NumberOfBins(); })
                   {
-                    for (const auto& prop : properties)
-                    {
+                    auto providers = r.template GetPropertyProviders<DenseMatrixPolicy>(
+                        prop, state_parameter_indices, state_variable_indices, phase_name);
+                    for (auto& [prefix, provider] : providers)
+                      result[prefix][prop] = std::move(provider);
+                  }
+                  else
+                  {
+                    for (const auto& prefix : phase_it->second)
                       result[prefix][prop] = r.template GetPropertyProvider<DenseMatrixPolicy>(
                           prop, state_parameter_indices, state_variable_indices, phase_name);
-                    }
                   }
-                },
-                repr);
-          }
+                }
+              },
+              repr);
         }
       }
       return result;
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/active_cells.hpp>
+#include <miam/util/thread_pool.hpp>
+#include <miam/util/trace.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace miam
+{
+  /// @brief Opt-in evaluation strategies for a Model
+  /// @details All options default to the reference (per-process) evaluation path.
+  struct ModelOptions
+  {
+    /// @brief Compile mass-action processes into a single fused forcing kernel
+    /// @details When true, ForcingFunction groups DissolvedReaction and DissolvedReversibleReaction
+    ///          processes into one flattened MassActionTerms table that is evaluated in a single
+    ///          pass over the grid cells. Processes that cannot be fused (e.g. rate-capped reactions
+    ///          or phase transfer) keep their per-process forcing functions.
+    bool compiled_forcing_{ false };
+
+    /// @brief Evaluate the Model functions on blocks of grid cells in parallel
+    /// @details When set to a pool of more than one thread, UpdateStateParametersFunction, ForcingFunction,
+    ///          JacobianFunction and ConstraintResidualFunction split the grid cells into one contiguous block
+    ///          per thread (aligned to the vector group size of the matrix type) and evaluate each block with
+    ///          its own copy of the serial function. Grid cells are independent, so the results are bitwise
+    ///          identical to the serial path for any thread count. Functions built from one Model share the
+    ///          pool, and must not be called from inside another pool task.
+    std::shared_ptr<ThreadPool> thread_pool_{};
+
+    /// @brief Run independent processes concurrently instead of splitting the grid cells into blocks
+    /// @details Only used with thread_pool_. ForcingFunction colors the processes by the forcing columns
+    ///          they write into conflict-free groups that run one after the other, each group in parallel
+    ///          (see ProcessGroupEvaluator). Gas-phase columns, which many phase-transfer processes share,
+    ///          receive the contribution of each process in process order, so they match the serial result
+    ///          to rounding and do not depend on the thread count. This scales within a grid cell, for runs
+    ///          with few cells per rank. The per-process path is used, so compiled_forcing_ is ignored; the
+    ///          other Model functions keep evaluating cell blocks. Copying the returned forcing function
+    ///          builds a new aerosol property cache and new process workspaces for the copy, so copies can
+    ///          be called concurrently.
+    bool process_parallel_forcing_{ false };
+
+    /// @brief Record a timeline of Model function evaluations
+    /// @details When set before the Model functions are built, every call of a combined Model function,
+    ///          of each process and constraint function, of the aerosol property cache updates and of the
+    ///          fused mass-action kernel is recorded as a span on the calling thread. The sink can be written
+    ///          out with TraceSink::WriteChromeTrace() and shared by several Models.
+    std::shared_ptr<TraceSink> trace_sink_{};
+
+    /// @brief Evaluate condensed-phase processes only in the grid cells where their representations are present
+    /// @details Keyed by representation prefix (e.g. "CLOUD"). ForcingFunction and JacobianFunction group the
+    ///          processes by the masked representations they act on; each group is evaluated only in the cells
+    ///          where at least one of them is active (see ActiveCellEvaluator), so its cost scales with e.g. the
+    ///          cloud fraction instead of the number of grid cells. Processes that also act on an unmasked
+    ///          representation are evaluated in every cell. Inactive cells receive no forcing or Jacobian
+    ///          contributions from a group, which is the limit its rates approach as the solvent or number
+    ///          concentration vanishes. Constraints must hold in every cell, so building the constraint
+    ///          functions throws if a constraint acts on a masked representation (CellBatchSolver handles
+    ///          those Models), and combining the thresholds with process_parallel_forcing_ throws as well.
+    std::map<std::string, ActivityThreshold> active_cell_thresholds_{};
+
+    /// @brief Hold the aerosol properties fixed for the duration of a Solve
+    /// @details Effective radius, number concentration and phase volume fraction then become state parameters,
+    ///          listed with the process parameters (see Model::FrozenPropertyParameterNames()) and computed from
+    ///          the state variables at the start of each Solve() by Model::InitializeConstraintParametersFunction().
+    ///          The forcing and Jacobian functions read them instead of evaluating the representation providers on
+    ///          every call, and the property partials drop out of the Jacobian along with the sparsity elements
+    ///          they add (e.g. the dense rows of a TwoMomentMode effective radius). Suited to properties that
+    ///          change slowly compared to the chemistry; the Jacobian is then exact for the frozen-property
+    ///          system the solver integrates.
+    bool frozen_aerosol_properties_{ false };
+  };
+}  // namespace miam
@@ -0,0 +1,335 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/util/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Colors the write-conflict graph of a sequence of processes into ordered groups
+  /// @details Two processes conflict when they write a common forcing column. Each process is placed in
+  ///          the group after the last group holding a conflicting earlier process, so processes within a
+  ///          group write disjoint columns and every column receives its contributions in process order,
+  ///          as in a serial evaluation.
+  /// @param written_columns Forcing columns written by each process, in process order
+  /// @return Groups of process indices, each in ascending order
+  inline std::vector<std::vector<std::size_t>> ColorProcessConflicts(
+      const std::vector<std::vector<std::size_t>>& written_columns)
+  {
+    std::size_t number_of_columns = 0;
+    for (const auto& columns : written_columns)
+      for (const auto column : columns)
+        number_of_columns = std::max(number_of_columns, column + 1);
+
+    // Group index + 1 of the last process writing each column (0 = not yet written)
+    std::vector<std::size_t> last_group(number_of_columns, 0);
+    std::vector<std::vector<std::size_t>> groups;
+    for (std::size_t i_process = 0; i_process < written_columns.size(); ++i_process)
+    {
+      std::size_t group = 0;
+      for (const auto column : written_columns[i_process])
+        group = std::max(group, last_group[column]);
+      for (const auto column : written_columns[i_process])
+        last_group[column] = group + 1;
+      if (group == groups.size())
+        groups.emplace_back();
+      groups[group].push_back(i_process);
+    }
+    return groups;
+  }
+
+  /// @brief Runs process forcing functions as concurrent, conflict-free groups
+  /// @details Processes are colored by the forcing columns they own (see ColorProcessConflicts()), and the
+  ///          groups run one after the other, each as one ThreadPool::ParallelFor() over the pool threads.
+  ///          Process j of a group runs on thread j modulo the number of threads, so the assignment does not
+  ///          depend on scheduling. Shared columns (the gas-phase species that many phase-transfer processes
+  ///          write) are excluded from the coloring: a process writing any of them runs on its thread's
+  ///          buffer, whose owned columns are copied from and back to the forcing around the call and whose
+  ///          shared columns start at zero. The process's contribution to its shared columns is then moved
+  ///          into its own columns of a contribution matrix, and after the last group the contributions are
+  ///          added to the forcing in process order.
+  ///
+  ///          Owned columns are therefore updated exactly as in a serial evaluation, and each shared column
+  ///          receives the contributions of its processes in process order, whatever the number of threads.
+  ///          A process that adds one term to a shared column matches the serial result bitwise; one that
+  ///          adds several matches it to rounding. Process forcing functions write through a single forcing
+  ///          matrix, so the thread buffers have every forcing column; the contribution matrix has one column
+  ///          for each (process, shared column) pair.
+  ///
+  ///          The arguments of a call travel with its ParallelFor() task, and each call takes its own set of
+  ///          buffers from a free list, so concurrent calls do not share per-call state. Buffer sets are kept
+  ///          for reuse, so steady-state calls do not allocate. The process functions themselves are shared
+  ///          by all calls; see Model::ForcingFunction() for how copies of a Model function get their own.
+  template<typename DenseMatrixPolicy>
+  class ProcessGroupEvaluator
+  {
+   public:
+    using Function = std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>;
+
+    /// @brief Creates an evaluator
+    /// @param pool Thread pool the groups run on
+    /// @param functions Forcing function of each process, in process order
+    /// @param written_columns Forcing columns written by each process
+    /// @param is_shared_column Flags the columns whose contributions are reduced in process order
+    /// @param number_of_columns Number of forcing columns
+    ProcessGroupEvaluator(
+        std::shared_ptr<ThreadPool> pool,
+        std::vector<Function> functions,
+        const std::vector<std::vector<std::size_t>>& written_columns,
+        const std::vector<bool>& is_shared_column,
+        std::size_t number_of_columns)
+        : pool_(std::move(pool)),
+          number_of_columns_(number_of_columns)
+    {
+      std::vector<std::vector<std::size_t>> owned_columns;
+      std::vector<std::size_t> shared_columns;
+      std::vector<std::size_t> contribution_columns;  // shared column of each contribution column
+      std::vector<std::vector<std::size_t>> process_shared_columns;
+      for (std::size_t i = 0; i < functions.size(); ++i)
+      {
+        Process process{ std::move(functions[i]) };
+        std::vector<std::size_t> owned;
+        std::vector<std::size_t> shared;
+        for (const auto column : written_columns[i])
+        {
+          if (column < is_shared_column.size() && is_shared_column[column])
+            shared.push_back(column);
+          else
+            owned.push_back(column);
+        }
+        if (!shared.empty())
+        {
+          process.writes_shared_columns_ = true;
+          AddOwnedColumnFunctions(process, owned);
+          shared_columns.insert(shared_columns.end(), shared.begin(), shared.end());
+          contribution_columns.insert(contribution_columns.end(), shared.begin(), shared.end());
+        }
+        processes_.push_back(std::move(process));
+        owned_columns.push_back(std::move(owned));
+        process_shared_columns.push_back(std::move(shared));
+      }
+      groups_ = ColorProcessConflicts(owned_columns);
+      std::sort(shared_columns.begin(), shared_columns.end());
+      shared_columns.erase(std::unique(shared_columns.begin(), shared_columns.end()), shared_columns.end());
+      number_of_contributions_ = contribution_columns.size();
+      std::size_t first_contribution = 0;
+      for (std::size_t i = 0; i < processes_.size(); ++i)
+      {
+        if (!processes_[i].writes_shared_columns_)
+          continue;
+        AddContributionFunction(processes_[i], process_shared_columns[i], first_contribution);
+        first_contribution += process_shared_columns[i].size();
+      }
+      if (!shared_columns.empty())
+        AddSharedColumnFunctions(shared_columns, contribution_columns);
+    }
+
+    ProcessGroupEvaluator(const ProcessGroupEvaluator&) = delete;
+    ProcessGroupEvaluator& operator=(const ProcessGroupEvaluator&) = delete;
+
+    /// @brief Returns the process groups, in evaluation order
+    const std::vector<std::vector<std::size_t>>& Groups() const
+    {
+      return groups_;
+    }
+
+    /// @brief Adds the forcing of all processes
+    void operator()(
+        const DenseMatrixPolicy& state_parameters,
+        const DenseMatrixPolicy& state_variables,
+        DenseMatrixPolicy& forcing)
+    {
+      Call call{ &state_parameters, &state_variables, &forcing };
+      if (zero_shared_)
+      {
+        call.buffers_ = AcquireBuffers();
+        for (auto& buffer : call.buffers_.threads_)
+        {
+          if (buffer.NumRows() != forcing.NumRows())
+            buffer = DenseMatrixPolicy{ forcing.NumRows(), number_of_columns_, 0.0 };
+          zero_shared_(buffer);
+        }
+        if (call.buffers_.contributions_.NumRows() != forcing.NumRows())
+          call.buffers_.contributions_ = DenseMatrixPolicy{ forcing.NumRows(), number_of_contributions_, 0.0 };
+      }
+      const std::function<void(std::size_t)> task = [this, &call](std::size_t thread) { RunThread(call, thread); };
+      for (const auto& group : groups_)
+      {
+        call.group_ = &group;
+        pool_->ParallelFor(std::min(group.size(), pool_->NumberOfThreads()), task);
+      }
+      if (reduce_shared_)
+      {
+        reduce_shared_(call.buffers_.contributions_, forcing);
+        ReleaseBuffers(std::move(call.buffers_));
+      }
+    }
+
+   private:
+    /// @brief A process forcing function and, if it writes shared columns, the copies of its columns
+    struct Process
+    {
+      Function forcing_;                                                            ///< Process forcing
+      bool writes_shared_columns_{ false };                                         ///< Runs on a thread buffer
+      std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> load_{};   ///< Owned columns to buffer
+      std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> store_{};  ///< Owned columns to forcing
+      std::function<void(DenseMatrixPolicy&, DenseMatrixPolicy&)> contribute_{};    ///< Shared columns to contributions
+    };
+
+    /// @brief Buffers of one call
+    struct Buffers
+    {
+      std::vector<DenseMatrixPolicy> threads_{};  ///< Forcing of the processes writing shared columns, per thread
+      DenseMatrixPolicy contributions_{};         ///< Shared column contributions of each process
+    };
+
+    /// @brief Arguments and buffers of one call
+    struct Call
+    {
+      const DenseMatrixPolicy* state_parameters_;         ///< Inputs of the call
+      const DenseMatrixPolicy* state_variables_;          ///< Inputs of the call
+      DenseMatrixPolicy* forcing_;                        ///< Output of the call
+      const std::vector<std::size_t>* group_{ nullptr };  ///< Group being evaluated
+      Buffers buffers_{};                                 ///< Buffers of the call
+    };
+
+    std::shared_ptr<ThreadPool> pool_;                                                   ///< Pool the groups run on
+    std::size_t number_of_columns_;                                                      ///< Number of forcing columns
+    std::size_t number_of_contributions_{ 0 };                                           ///< Contribution matrix columns
+    std::vector<Process> processes_;                                                     ///< Processes in process order
+    std::vector<std::vector<std::size_t>> groups_;                                       ///< Conflict-free process groups
+    std::function<void(DenseMatrixPolicy&)> zero_shared_{};                              ///< Zeroes shared columns
+    std::function<void(const DenseMatrixPolicy&, DenseMatrixPolicy&)> reduce_shared_{};  ///< Adds contributions
+    std::mutex free_buffers_mutex_;                                                      ///< Guards free_buffers_
+    std::vector<Buffers> free_buffers_;                                                  ///< Buffer sets not in use
+
+    /// @brief Takes a set of buffers from the free list, or a new one if it is empty
+    Buffers AcquireBuffers()
+    {
+      {
+        std::lock_guard<std::mutex> lock(free_buffers_mutex_);
+        if (!free_buffers_.empty())
+        {
+          auto buffers = std::move(free_buffers_.back());
+          free_buffers_.pop_back();
+          return buffers;
+        }
+      }
+      return Buffers{ std::vector<DenseMatrixPolicy>(pool_->NumberOfThreads()) };
+    }
+
+    /// @brief Returns a set of buffers to the free list
+    void ReleaseBuffers(Buffers buffers)
+    {
+      std::lock_guard<std::mutex> lock(free_buffers_mutex_);
+      free_buffers_.push_back(std::move(buffers));
+    }
+
+    void RunThread(Call& call, std::size_t thread)
+    {
+      const auto& group = *call.group_;
+      for (std::size_t j = thread; j < group.size(); j += pool_->NumberOfThreads())
+      {
+        auto& process = processes_[group[j]];
+        if (!process.writes_shared_columns_)
+        {
+          process.forcing_(*call.state_parameters_, *call.state_variables_, *call.forcing_);
+          continue;
+        }
+        auto& buffer = call.buffers_.threads_[thread];
+        process.load_(*call.forcing_, buffer);
+        process.forcing_(*call.state_parameters_, *call.state_variables_, buffer);
+        process.store_(buffer, *call.forcing_);
+        process.contribute_(buffer, call.buffers_.contributions_);
+      }
+    }
+
+    void AddOwnedColumnFunctions(Process& process, const std::vector<std::size_t>& owned) const
+    {
+      DenseMatrixPolicy dummy{ 1, number_of_columns_, 0.0 };
+      process.load_ = DenseMatrixPolicy::Function(
+          [owned](auto&& forcing, auto&& buffer)
+          {
+            for (const auto column : owned)
+              buffer.ForEachRow(
+                  [](const double& f, double& b) { b = f; },
+                  forcing.GetConstColumnView(column),
+                  buffer.GetColumnView(column));
+          },
+          dummy,
+          dummy);
+      process.store_ = DenseMatrixPolicy::Function(
+          [owned](auto&& buffer, auto&& forcing)
+          {
+            for (const auto column : owned)
+              forcing.ForEachRow(
+                  [](const double& b, double& f) { f = b; },
+                  buffer.GetConstColumnView(column),
+                  forcing.GetColumnView(column));
+          },
+          dummy,
+          dummy);
+    }
+
+    /// @brief Moves a process's shared columns from its thread buffer into its contribution columns
+    /// @param first First contribution column of the process
+    void AddContributionFunction(Process& process, const std::vector<std::size_t>& shared, std::size_t first) const
+    {
+      DenseMatrixPolicy dummy{ 1, number_of_columns_, 0.0 };
+      DenseMatrixPolicy dummy_contributions{ 1, number_of_contributions_, 0.0 };
+      process.contribute_ = DenseMatrixPolicy::Function(
+          [shared, first](auto&& buffer, auto&& contributions)
+          {
+            for (std::size_t k = 0; k < shared.size(); ++k)
+              buffer.ForEachRow(
+                  [](double& b, double& c)
+                  {
+                    c = b;
+                    b = 0.0;
+                  },
+                  buffer.GetColumnView(shared[k]),
+                  contributions.GetColumnView(first + k));
+          },
+          dummy,
+          dummy_contributions);
+    }
+
+    /// @brief Adds the functions that zero the shared columns of a thread buffer and reduce the contributions
+    /// @param shared Shared columns
+    /// @param contribution_columns Shared column of each contribution column, in process order
+    void AddSharedColumnFunctions(
+        const std::vector<std::size_t>& shared,
+        const std::vector<std::size_t>& contribution_columns)
+    {
+      DenseMatrixPolicy dummy{ 1, number_of_columns_, 0.0 };
+      DenseMatrixPolicy dummy_contributions{ 1, contribution_columns.size(), 0.0 };
+      zero_shared_ = DenseMatrixPolicy::Function(
+          [shared](auto&& buffer)
+          {
+            for (const auto column : shared)
+              buffer.ForEachRow([](double& b) { b = 0.0; }, buffer.GetColumnView(column));
+          },
+          dummy);
+      reduce_shared_ = DenseMatrixPolicy::Function(
+          [contribution_columns](auto&& contributions, auto&& forcing)
+          {
+            for (std::size_t k = 0; k < contribution_columns.size(); ++k)
+              forcing.ForEachRow(
+                  [](const double& c, double& f) { f += c; },
+                  contributions.GetConstColumnView(k),
+                  forcing.GetColumnView(contribution_columns[k]));
+          },
+          dummy_contributions,
+          dummy);
+    }
+  };
+}  // namespace miam
@@ -5,10 +5,12 @@
 
 #include <miam/processes/constants/equilibrium_constant.hpp>
 #include <miam/processes/constants/henry_law_constant.hpp>
+#include <miam/processes/constants/rate_constant.hpp>
 #include <miam/processes/dissolved_reaction.hpp>
 #include <miam/processes/dissolved_reaction_builder.hpp>
 #include <miam/processes/dissolved_reversible_reaction.hpp>
 #include <miam/processes/dissolved_reversible_reaction_builder.hpp>
 #include <miam/processes/henry_law_phase_transfer.hpp>
 #include <miam/processes/henry_law_phase_transfer_builder.hpp>
+#include <miam/processes/mass_action_terms.hpp>
 #include <miam/processes/process_set.hpp>
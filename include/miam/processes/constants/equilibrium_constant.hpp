@@ -8,6 +8,7 @@
 #include <micm/system/conditions.hpp>
 
 #include <cmath>
+#include <memory>
 
 namespace miam
 {
@@ -50,6 +51,25 @@ namespace miam
     {
     }
 
+    /// @brief Constructor with parameters that tabulates the constant over a temperature range
+    /// @param parameters A set of equilibrium constant parameters
+    /// @param table_options Temperature range and accuracy of the lookup table
+    /// @details Inside the tabulated range Calculate() interpolates instead of evaluating exp;
+    ///          outside it, the exact expression is used.
+    EquilibriumConstant(const EquilibriumConstantParameters& parameters, const VantHoffTableOptions& table_options)
+        : parameters_(parameters),
+          table_(std::make_shared<const VantHoffTable>(
+              VantHoffParameters{ parameters.A_, parameters.C_, parameters.T0_ },
+              table_options))
+    {
+    }
+
+    /// @brief Returns the lookup table, or nullptr if the constant is evaluated exactly
+    const VantHoffTable* Table() const
+    {
+      return table_.get();
+    }
+
     /// @brief Calculate the equilibrium constant
     /// @param conditions The current environmental conditions of the chemical system
     /// @return An equilibrium constant based off of the conditions in the system
@@ -63,8 +83,13 @@ namespace miam
     /// @return An equilibrium constant
     double Calculate(const double& temperature) const
     {
+      if (table_)
+        return table_->Evaluate(temperature);
       // K_eq = A * exp( C * (1/T0 - 1/T) ) — the van 't Hoff form used directly.
       return CalculateVantHoff({ parameters_.A_, parameters_.C_, parameters_.T0_ }, temperature);
     }
+
+   private:
+    std::shared_ptr<const VantHoffTable> table_;  ///< Optional lookup table (shared between copies)
   };
 }  // namespace miam
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <micm/system/conditions.hpp>
 
 #include <cmath>
+#include <memory>
 
 namespace miam
 {
@@ -43,6 +44,25 @@ namespace miam
     {
     }
 
+    /// @brief Constructor with parameters that tabulates the constant over a temperature range
+    /// @param parameters A set of Henry's Law constant parameters
+    /// @param table_options Temperature range and accuracy of the lookup table
+    /// @details Inside the tabulated range Calculate() interpolates instead of evaluating exp;
+    ///          outside it, the exact expression is used.
+    HenryLawConstant(const HenryLawConstantParameters& parameters, const VantHoffTableOptions& table_options)
+        : parameters_(parameters),
+          table_(std::make_shared<const VantHoffTable>(
+              VantHoffParameters{ parameters.HLC_ref_, -parameters.C_, parameters.T0_ },
+              table_options))
+    {
+    }
+
+    /// @brief Returns the lookup table, or nullptr if the constant is evaluated exactly
+    const VantHoffTable* Table() const
+    {
+      return table_.get();
+    }
+
     /// @brief Calculate the Henry's Law constant
     /// @param conditions The current environmental conditions of the chemical system
     /// @return A Henry's Law constant based off of the conditions in the system [mol m⁻³ Pa⁻¹]
@@ -56,9 +76,14 @@ namespace miam
     /// @return A Henry's Law constant [mol m⁻³ Pa⁻¹]
     double Calculate(const double& temperature) const
     {
+      if (table_)
+        return table_->Evaluate(temperature);
       // HLC = HLC_ref * exp( C * (1/T - 1/T0) ) = HLC_ref * exp( -C * (1/T0 - 1/T) ),
       // van 't Hoff kernel with C negated
       return CalculateVantHoff({ parameters_.HLC_ref_, -parameters_.C_, parameters_.T0_ }, temperature);
     }
+
+   private:
+    std::shared_ptr<const VantHoffTable> table_;  ///< Optional lookup table (shared between copies)
   };
 }  // namespace miam
\ No newline at end of file
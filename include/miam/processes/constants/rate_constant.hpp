@@ -0,0 +1,282 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/processes/constants/vant_hoff.hpp>
+
+#include <micm/process/rate_constant/arrhenius_rate_constant.hpp>
+#include <micm/system/conditions.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace miam
+{
+  /// @brief Parameters for a Troe fall-off rate constant
+  /// @details Field names and defaults follow micm's Troe rate constant:
+  ///          \f[
+  ///            k_0 = A_0 e^{C_0/T} (T/300)^{B_0}, \qquad k_\infty = A_\infty e^{C_\infty/T} (T/300)^{B_\infty}
+  ///          \f]
+  ///          \f[
+  ///            k = \frac{k_0 M}{1 + k_0 M / k_\infty} \, F_c^{1 / (1 + (\log_{10}(k_0 M / k_\infty) / N)^2)}
+  ///          \f]
+  ///          where \f$ M \f$ is the air number density from micm::Conditions::air_density_.
+  struct TroeRateConstantParameters
+  {
+    double k0_A_{ 1.0 };    ///< Low-pressure pre-exponential factor
+    double k0_B_{ 0.0 };    ///< Low-pressure temperature exponent
+    double k0_C_{ 0.0 };    ///< Low-pressure exponential factor [K]
+    double kinf_A_{ 1.0 };  ///< High-pressure pre-exponential factor
+    double kinf_B_{ 0.0 };  ///< High-pressure temperature exponent
+    double kinf_C_{ 0.0 };  ///< High-pressure exponential factor [K]
+    double Fc_{ 0.6 };      ///< Broadening factor
+    double N_{ 1.0 };       ///< Broadening exponent
+  };
+
+  /// @brief A rate constant that the process kernels can evaluate column-wise
+  /// @details Holds one of a small set of closed-form kinds, or an arbitrary function:
+  ///
+  ///          | Kind       | Expression                                                      |
+  ///          |------------|-----------------------------------------------------------------|
+  ///          | Constant   | \f$ k \f$                                                        |
+  ///          | VantHoff   | \f$ A \exp(C (1/T_0 - 1/T)) \f$ (see CalculateVantHoff)          |
+  ///          | Arrhenius  | \f$ A e^{C/T} (T/D)^B (1 + E P) \f$ (micm Arrhenius parameters)  |
+  ///          | Troe       | see TroeRateConstantParameters                                  |
+  ///          | Function   | any `double(const micm::Conditions&)` callable                   |
+  ///
+  ///          EvaluateColumn() selects the kind once and then fills a whole state-parameter column in a single
+  ///          loop over the grid cells, so the closed-form kinds inline into that loop instead of paying an
+  ///          indirect std::function call per cell. The Function kind remains available as the slow path for
+  ///          expressions that are not covered by the closed forms.
+  ///
+  ///          Processes give representations with equal rate constants (see operator==) a single shared
+  ///          state-parameter column, so a reaction applied to many sections with one rate constant evaluates it
+  ///          once per cell.
+  ///
+  ///          A RateConstant is implicitly constructible from each kind's parameters and from callables, so it
+  ///          can be used wherever a `std::function<double(const micm::Conditions&)>` was accepted before.
+  class RateConstant
+  {
+   public:
+    /// @brief Signature of the fallback rate constant function
+    using Function = std::function<double(const micm::Conditions&)>;
+
+    /// @brief The closed-form kind, or Function for the fallback
+    enum class Kind
+    {
+      Constant,
+      VantHoff,
+      Arrhenius,
+      Troe,
+      Function
+    };
+
+    /// @brief Constant rate constant [s⁻¹]
+    RateConstant(double k)
+        : kind_(k)
+    {
+    }
+
+    /// @brief van 't Hoff (reference-temperature Arrhenius) rate constant
+    RateConstant(const VantHoffParameters& parameters)
+        : kind_(parameters)
+    {
+    }
+
+    /// @brief Arrhenius rate constant with micm's parameterization
+    RateConstant(const micm::ArrheniusRateConstantParameters& parameters)
+        : kind_(parameters)
+    {
+    }
+
+    /// @brief Troe fall-off rate constant
+    RateConstant(const TroeRateConstantParameters& parameters)
+        : kind_(parameters)
+    {
+    }
+
+    /// @brief Arbitrary rate constant function (slow path)
+    template<typename F>
+      requires(
+          !std::is_same_v<std::remove_cvref_t<F>, RateConstant> &&
+          std::is_invocable_r_v<double, const std::remove_cvref_t<F>&, const micm::Conditions&>)
+    RateConstant(F&& function)
+        : kind_(std::make_shared<const Function>(std::forward<F>(function)))
+    {
+    }
+
+    /// @brief Returns the kind of this rate constant
+    Kind GetKind() const
+    {
+      return static_cast<Kind>(kind_.index());
+    }
+
+    /// @brief Returns true if both rate constants are guaranteed to produce the same value for any conditions
+    /// @details Closed-form kinds compare their parameters. Function kinds compare by identity: copies of one
+    ///          RateConstant are equal, but two RateConstants built from separate callables never are, even if the
+    ///          callables compute the same thing. Reuse one RateConstant object, or pass a set of prefixes to the
+    ///          builders' Add*RateConstant overloads, to let processes share its evaluation.
+    friend bool operator==(const RateConstant& a, const RateConstant& b)
+    {
+      if (a.kind_.index() != b.kind_.index())
+        return false;
+      return std::visit(
+          [&](const auto& parameters)
+          {
+            using T = std::decay_t<decltype(parameters)>;
+            return Equal(parameters, std::get<T>(b.kind_));
+          },
+          a.kind_);
+    }
+
+    /// @brief Calculates the rate constant for one set of conditions
+    double operator()(const micm::Conditions& conditions) const
+    {
+      return std::visit(
+          [&](const auto& parameters) -> double
+          {
+            using T = std::decay_t<decltype(parameters)>;
+            if constexpr (std::is_same_v<T, std::shared_ptr<const Function>>)
+              return (*parameters)(conditions);
+            else
+              return Calculate(parameters, conditions.temperature_, conditions.pressure_, conditions.air_density_);
+          },
+          kind_);
+    }
+
+    /// @brief Fills one state-parameter column with this rate constant for every grid cell
+    /// @param conditions Conditions for each grid cell
+    /// @param params State parameter matrix (row per grid cell)
+    /// @param column Column of the state parameter matrix to write
+    /// @details Intended to be called from inside a DenseMatrixPolicy::Function body
+    template<typename ConditionsPolicy, typename ParamsPolicy>
+    void EvaluateColumn(const ConditionsPolicy& conditions, ParamsPolicy& params, std::size_t column) const
+    {
+      std::visit(
+          [&](const auto& parameters)
+          {
+            using T = std::decay_t<decltype(parameters)>;
+            if constexpr (std::is_same_v<T, std::shared_ptr<const Function>>)
+            {
+              const Function& function = *parameters;
+              params.ForEachRow(
+                  [&](const micm::Conditions& cond, double& k) { k = function(cond); },
+                  conditions,
+                  params.GetColumnView(column));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+              const double value = parameters;
+              params.ForEachRow(
+                  [value](const micm::Conditions&, double& k) { k = value; }, conditions, params.GetColumnView(column));
+            }
+            else
+            {
+              const T p = parameters;
+              params.ForEachRow(
+                  [p](const micm::Conditions& cond, double& k)
+                  { k = Calculate(p, cond.temperature_, cond.pressure_, cond.air_density_); },
+                  conditions,
+                  params.GetColumnView(column));
+            }
+          },
+          kind_);
+    }
+
+   private:
+    std::variant<
+        double,
+        VantHoffParameters,
+        micm::ArrheniusRateConstantParameters,
+        TroeRateConstantParameters,
+        std::shared_ptr<const Function>>
+        kind_;  ///< Parameters of the active kind (variant index matches Kind)
+
+    static bool Equal(double a, double b)
+    {
+      return a == b;
+    }
+
+    static bool Equal(const VantHoffParameters& a, const VantHoffParameters& b)
+    {
+      return a.A_ == b.A_ && a.C_ == b.C_ && a.T0_ == b.T0_;
+    }
+
+    static bool Equal(const micm::ArrheniusRateConstantParameters& a, const micm::ArrheniusRateConstantParameters& b)
+    {
+      return a.A_ == b.A_ && a.B_ == b.B_ && a.C_ == b.C_ && a.D_ == b.D_ && a.E_ == b.E_;
+    }
+
+    static bool Equal(const TroeRateConstantParameters& a, const TroeRateConstantParameters& b)
+    {
+      return a.k0_A_ == b.k0_A_ && a.k0_B_ == b.k0_B_ && a.k0_C_ == b.k0_C_ && a.kinf_A_ == b.kinf_A_ &&
+             a.kinf_B_ == b.kinf_B_ && a.kinf_C_ == b.kinf_C_ && a.Fc_ == b.Fc_ && a.N_ == b.N_;
+    }
+
+    static bool Equal(const std::shared_ptr<const Function>& a, const std::shared_ptr<const Function>& b)
+    {
+      return a == b;
+    }
+
+    static double Calculate(double k, double, double, double)
+    {
+      return k;
+    }
+
+    static double Calculate(const VantHoffParameters& p, double temperature, double, double)
+    {
+      return CalculateVantHoff(p, temperature);
+    }
+
+    // Same operation order as micm::CalculateArrhenius, so results are bitwise identical
+    static double Calculate(const micm::ArrheniusRateConstantParameters& p, double temperature, double pressure, double)
+    {
+      return p.A_ * std::exp(p.C_ / temperature) * std::pow(temperature / p.D_, p.B_) * (1.0 + p.E_ * pressure);
+    }
+
+    static double Calculate(const TroeRateConstantParameters& p, double temperature, double, double air_density)
+    {
+      const double k0 = p.k0_A_ * std::exp(p.k0_C_ / temperature) * std::pow(temperature / 300.0, p.k0_B_);
+      const double kinf = p.kinf_A_ * std::exp(p.kinf_C_ / temperature) * std::pow(temperature / 300.0, p.kinf_B_);
+      const double k0_M = k0 * air_density;
+      const double log_ratio = std::log10(k0_M / kinf) / p.N_;
+      return k0_M / (1.0 + k0_M / kinf) * std::pow(p.Fc_, 1.0 / (1.0 + log_ratio * log_ratio));
+    }
+  };
+
+  /// @brief Returns the prefix whose rate constant parameter a prefix shares
+  /// @param rate_constants Rate constants keyed by representation prefix
+  /// @param prefixes All prefixes the rate constants are applied to
+  /// @param prefix The prefix to look up
+  /// @return The first prefix in sorted order whose rate constant compares equal to that of `prefix`
+  ///         (`prefix` itself if there is none, or if it has no rate constant)
+  /// @details Processes name their rate constant parameters after the returned prefix, so a rate constant shared
+  ///          by many representations occupies a single state-parameter column that is evaluated once per cell.
+  inline std::string SharedRateConstantPrefix(
+      const std::map<std::string, RateConstant>& rate_constants,
+      const std::set<std::string>& prefixes,
+      const std::string& prefix)
+  {
+    auto rate_it = rate_constants.find(prefix);
+    if (rate_it == rate_constants.end())
+      return prefix;
+    for (const auto& other : prefixes)
+    {
+      if (other == prefix)
+        break;
+      auto other_it = rate_constants.find(other);
+      if (other_it != rate_constants.end() && other_it->second == rate_it->second)
+        return other;
+    }
+    return prefix;
+  }
+}  // namespace miam
@@ -3,7 +3,14 @@
 
 #pragma once
 
+#include <miam/util/error.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 namespace miam
 {
@@ -25,4 +32,161 @@ namespace miam
   {
     return p.A_ * std::exp(p.C_ * (1.0 / p.T0_ - 1.0 / temperature));
   }
+
+  /// @brief Options for tabulating a van 't Hoff constant
+  /// @details The table size grows as tolerance^(-1/4): for C ≈ 5000 K over 180-330 K the default 1e-6
+  ///          needs about 160 intervals (5 KB), while 1e-10 needs about 1600 (50 KB). The default is well
+  ///          below the solver tolerances and the uncertainty of the tabulated parameters, and keeps the
+  ///          tables of hundreds of constants small enough to stay in cache.
+  struct VantHoffTableOptions
+  {
+    double min_temperature_{ 180.0 };       ///< Lowest tabulated temperature [K]
+    double max_temperature_{ 330.0 };       ///< Highest tabulated temperature [K]
+    double relative_tolerance_{ 1.0e-6 };   ///< Target bound on the relative interpolation error
+    std::size_t max_intervals_{ 1 << 16 };  ///< Upper limit on the table size
+  };
+
+  /// @brief Tabulated van 't Hoff constant
+  /// @details Pre-evaluates f(T) and its temperature derivative f'(T) = f·C/T² on a uniform temperature
+  ///          grid and stores the cubic Hermite polynomial of each interval, so an evaluation costs one
+  ///          multiply to locate the interval and three multiply-adds instead of a divide and an exp.
+  ///          The grid spacing starts from the cubic Hermite error bound h⁴/384 · max|f⁽⁴⁾| and is
+  ///          refined until the relative error measured at every interval midpoint (where the Hermite
+  ///          error term peaks) is within the requested tolerance, or the size limit is reached.
+  ///          MaxRelativeError() reports the error that was achieved.
+  ///
+  ///          Temperatures outside [min_temperature_, max_temperature_] fall back to CalculateVantHoff.
+  class VantHoffTable
+  {
+   public:
+    /// @brief Builds the table
+    /// @param parameters van 't Hoff parameters of the tabulated constant
+    /// @param options Temperature range and accuracy of the table
+    VantHoffTable(const VantHoffParameters& parameters, const VantHoffTableOptions& options = {})
+        : parameters_(parameters),
+          min_temperature_(options.min_temperature_),
+          max_temperature_(options.max_temperature_)
+    {
+      if (!(options.min_temperature_ > 0.0) || !(options.max_temperature_ > options.min_temperature_))
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "VantHoffTable: temperature range must satisfy 0 < min_temperature < max_temperature");
+      if (!(options.relative_tolerance_ > 0.0) || options.max_intervals_ == 0)
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "VantHoffTable: relative tolerance and maximum table size must be positive");
+
+      // In u = 1/T the relative fourth derivative is C⁴, so (C·h_u)⁴/384 ≤ tol gives the spacing in u;
+      // dT = T²·du makes the coldest end of the range the most demanding in T.
+      const double range = max_temperature_ - min_temperature_;
+      const double abs_C = std::abs(parameters_.C_);
+      std::size_t intervals = 1;
+      if (abs_C > 0.0)
+      {
+        const double h_u = std::pow(384.0 * options.relative_tolerance_, 0.25) / abs_C;
+        const double h_T = h_u * min_temperature_ * min_temperature_;
+        intervals = static_cast<std::size_t>(std::ceil(range / h_T));
+      }
+      intervals = std::clamp(intervals, std::size_t(1), options.max_intervals_);
+
+      while (true)
+      {
+        Build(intervals);
+        if (max_relative_error_ <= options.relative_tolerance_ || intervals >= options.max_intervals_)
+          break;
+        intervals = std::min(2 * intervals, options.max_intervals_);
+      }
+    }
+
+    /// @brief Evaluates the constant, interpolating inside the tabulated range
+    /// @param temperature Temperature [K]
+    double Evaluate(double temperature) const
+    {
+      if (!(temperature >= min_temperature_ && temperature <= max_temperature_))
+        return CalculateVantHoff(parameters_, temperature);
+      return Interpolate(temperature);
+    }
+
+    /// @brief Largest relative interpolation error measured when the table was built
+    double MaxRelativeError() const
+    {
+      return max_relative_error_;
+    }
+
+    /// @brief Number of tabulated points
+    std::size_t Size() const
+    {
+      return coefficients_.size() / 4 + 1;
+    }
+
+    /// @brief Lowest tabulated temperature [K]
+    double MinTemperature() const
+    {
+      return min_temperature_;
+    }
+
+    /// @brief Highest tabulated temperature [K]
+    double MaxTemperature() const
+    {
+      return max_temperature_;
+    }
+
+   private:
+    /// @brief Fills the interval coefficients for a number of intervals and measures the interpolation error
+    void Build(std::size_t intervals)
+    {
+      h_ = (max_temperature_ - min_temperature_) / static_cast<double>(intervals);
+      inverse_h_ = 1.0 / h_;
+      coefficients_.resize(4 * intervals);
+      auto node = [this](std::size_t i, double& f, double& scaled_slope)
+      {
+        const double T = min_temperature_ + h_ * static_cast<double>(i);
+        f = CalculateVantHoff(parameters_, T);
+        scaled_slope = h_ * f * parameters_.C_ / (T * T);  // h·df/dT
+      };
+      double f0, d0, f1, d1;
+      node(0, f0, d0);
+      for (std::size_t i = 0; i < intervals; ++i)
+      {
+        node(i + 1, f1, d1);
+        // Cubic Hermite polynomial in t ∈ [0, 1], stored in monomial form for Horner evaluation
+        coefficients_[4 * i] = f0;
+        coefficients_[4 * i + 1] = d0;
+        coefficients_[4 * i + 2] = 3.0 * (f1 - f0) - 2.0 * d0 - d1;
+        coefficients_[4 * i + 3] = 2.0 * (f0 - f1) + d0 + d1;
+        f0 = f1;
+        d0 = d1;
+      }
+      max_relative_error_ = 0.0;
+      for (std::size_t i = 0; i < intervals; ++i)
+      {
+        const double T_mid = min_temperature_ + h_ * (static_cast<double>(i) + 0.5);
+        const double exact = CalculateVantHoff(parameters_, T_mid);
+        if (exact != 0.0)
+          max_relative_error_ = std::max(max_relative_error_, std::abs(Interpolate(T_mid) - exact) / std::abs(exact));
+      }
+    }
+
+    /// @brief Cubic Hermite interpolation for a temperature inside the table
+    double Interpolate(double temperature) const
+    {
+      const double x = (temperature - min_temperature_) * inverse_h_;
+      const std::ptrdiff_t last = static_cast<std::ptrdiff_t>(coefficients_.size() / 4) - 1;
+      // Signed conversion is a single instruction on common targets; x ≥ 0 inside the range
+      const std::ptrdiff_t i = std::min(static_cast<std::ptrdiff_t>(x), last);
+      const double t = x - static_cast<double>(i);
+      const double* c = &coefficients_[4 * i];
+      return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+
+    VantHoffParameters parameters_;     ///< Parameters of the tabulated constant
+    double min_temperature_;            ///< Lowest tabulated temperature [K]
+    double max_temperature_;            ///< Highest tabulated temperature [K]
+    double h_{ 0.0 };                   ///< Grid spacing [K]
+    double inverse_h_{ 0.0 };           ///< 1 / h_ [K⁻¹]
+    double max_relative_error_{ 0.0 };  ///< Measured interpolation error
+    std::vector<double> coefficients_;  ///< Four cubic coefficients per interval
+  };
 }  // namespace miam
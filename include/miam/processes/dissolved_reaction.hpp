@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <miam/math/reaction_order.hpp>
+#include <miam/processes/constants/rate_constant.hpp>
+#include <miam/processes/mass_action_terms.hpp>
 #include <miam/representations/aerosol_property.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -19,6 +23,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace miam
@@ -61,8 +66,7 @@ namespace miam
   class DissolvedReaction
   {
    public:
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        rate_constants_;                    ///< Rate constant functions keyed by representation prefix
+    std::map<std::string, RateConstant> rate_constants_;  ///< Rate constants keyed by representation prefix
     std::vector<micm::Species> reactants_;  ///< Reactant species
     std::vector<micm::Species> products_;   ///< Product species
     micm::Species solvent_;                 ///< Solvent species
@@ -79,7 +83,7 @@ namespace miam
 
     /// @brief Constructor
     DissolvedReaction(
-        std::map<std::string, std::function<double(const micm::Conditions& conditions)>> rate_constants,
+        std::map<std::string, RateConstant> rate_constants,
         const std::vector<micm::Species>& reactants,
         const std::vector<micm::Species>& products,
         micm::Species solvent,
@@ -114,7 +118,7 @@ namespace miam
       auto it = phase_prefixes.find(phase_.name_);
       if (it != phase_prefixes.end())
         for (const auto& prefix : it->second)
-          names.insert(prefix + "." + phase_.name_ + "." + uuid_ + ".k");
+          names.insert(RateParameterName(it->second, prefix));
       return names;
     }
 
@@ -170,8 +174,22 @@ namespace miam
         const auto& state_variable_indices  // acts like std::unordered_map<std::string, std::size_t>
     ) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> jacobian_indices;
+      SparsityPattern jacobian_indices;
+      AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, jacobian_indices);
+      return jacobian_indices.ToSet();
+    }
 
+    /// @brief Appends the Jacobian index pairs for this process to a sparsity pattern
+    /// @param phase_prefixes Map of phase names to sets of state variable prefixes (prefix does not include phase or
+    /// species names)
+    /// @param state_variable_indices Map of state variable names to their corresponding indices in the Jacobian
+    /// @param jacobian_indices Pattern to append the (dependent, independent) pairs to; may contain duplicates until
+    ///        it is finalized
+    void AppendNonZeroJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_variable_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        SparsityPattern& jacobian_indices) const
+    {
       StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
       // Get pairs for each phase instance
       for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
@@ -187,13 +205,13 @@ namespace miam
           for (std::size_t r2 = 0; r2 < variable_indices.reactant_indices_.NumColumns(); ++r2)
           {
             std::size_t dependent_index = variable_indices.reactant_indices_[i_phase][r2];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
           // Each reactant affects all products
           for (std::size_t p = 0; p < variable_indices.product_indices_.NumColumns(); ++p)
           {
             std::size_t dependent_index = variable_indices.product_indices_[i_phase][p];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
         }
         // Solvent contributions (affects all reactants and products)
@@ -201,16 +219,14 @@ namespace miam
         for (std::size_t r = 0; r < variable_indices.reactant_indices_.NumColumns(); ++r)
         {
           std::size_t dependent_index = variable_indices.reactant_indices_[i_phase][r];
-          jacobian_indices.insert({ dependent_index, independent_index });
+          jacobian_indices.Add(dependent_index, independent_index);
         }
         for (std::size_t p = 0; p < variable_indices.product_indices_.NumColumns(); ++p)
         {
           std::size_t dependent_index = variable_indices.product_indices_[i_phase][p];
-          jacobian_indices.insert({ dependent_index, independent_index });
+          jacobian_indices.Add(dependent_index, independent_index);
         }
       }
-
-      return jacobian_indices;
     }
 
     /// @brief Returns non-zero Jacobian elements (common interface overload accepting providers)
@@ -237,10 +253,13 @@ namespace miam
         const auto& state_parameter_indices  // acts like std::unordered_map<std::string, std::size_t>
     ) const
     {
-      std::vector<std::pair<std::size_t, std::function<double(const micm::Conditions&)>>> k_slots;
+      // Prefixes sharing a rate constant share its parameter column, which is filled once
+      std::vector<std::pair<std::size_t, RateConstant>> k_slots;
       auto phase_it = phase_prefixes.find(phase_.name_);
       for (const auto& prefix : phase_it->second)
       {
+        if (SharedRateConstantPrefix(rate_constants_, phase_it->second, prefix) != prefix)
+          continue;
         std::string k_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k";
         if (state_parameter_indices.find(k_param) == state_parameter_indices.end())
           throw MiamException(
@@ -262,11 +281,8 @@ namespace miam
       return DenseMatrixPolicy::Function(
           [k_slots](auto&& conditions, auto&& params)
           {
-            for (const auto& [k_idx, rate_fn] : k_slots)
-              params.ForEachRow(
-                  [&](const micm::Conditions& cond, double& param) { param = rate_fn(cond); },
-                  conditions,
-                  params.GetColumnView(k_idx));
+            for (const auto& [k_idx, rate_constant] : k_slots)
+              rate_constant.EvaluateColumn(conditions, params, k_idx);
           },
           conditions_vector,
           state_parameters);
@@ -304,57 +320,16 @@ namespace miam
       DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
 
-      if (min_halflife_ > 0.0)
-      {
-        return ForcingFunctionCapped<DenseMatrixPolicy>(
-            variable_indices, k_indices, dummy_state_parameters, dummy_state_variables);
-      }
-
-      return DenseMatrixPolicy::Function(
-          [this, variable_indices, k_indices](auto&& state_parameters, auto&& state_variables, auto&& forcing_terms)
+      return DispatchReactionOrder(
+          reactants_.size(),
+          [&](auto order) -> std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>
           {
-            auto rate = forcing_terms.GetRowVariable();
-            const double eps = solvent_floor_;
-            const std::size_t n_r = reactants_.size();
-
-            // For each phase instance, calculate the reaction rate and update the forcing terms
-            for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
-            {
-              // Calculate the damped rate: k * [S] / ([S] + eps)^n_r * prod([reactants])
-              state_parameters.ForEachRow(
-                  [&](const double& rate_constant, const double& solvent, double& rate)
-                  { rate = rate_constant * solvent / std::pow(solvent + eps, n_r); },
-                  state_parameters.GetConstColumnView(k_indices[i_phase]),
-                  state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
-                  rate);
-              for (std::size_t r = 0; r < reactants_.size(); ++r)
-              {
-                state_variables.ForEachRow(
-                    [&](const double& reactant, double& rate) { rate *= reactant; },
-                    state_variables.GetConstColumnView(variable_indices.reactant_indices_[i_phase][r]),
-                    rate);
-              }
-
-              // Apply the reaction rate to the forcing terms for reactants and products
-              for (std::size_t r = 0; r < reactants_.size(); ++r)
-              {
-                state_variables.ForEachRow(
-                    [&](const double& rate, double& forcing) { forcing -= rate; },
-                    rate,
-                    forcing_terms.GetColumnView(variable_indices.reactant_indices_[i_phase][r]));
-              }
-              for (std::size_t p = 0; p < products_.size(); ++p)
-              {
-                state_variables.ForEachRow(
-                    [&](const double& rate, double& forcing) { forcing += rate; },
-                    rate,
-                    forcing_terms.GetColumnView(variable_indices.product_indices_[i_phase][p]));
-              }
-            }
-          },
-          dummy_state_parameters,
-          dummy_state_variables,
-          dummy_state_variables);
+            if (min_halflife_ > 0.0)
+              return ForcingFunctionCapped<decltype(order)::value, DenseMatrixPolicy>(
+                  variable_indices, k_indices, dummy_state_parameters, dummy_state_variables);
+            return ForcingFunctionUncapped<decltype(order)::value, DenseMatrixPolicy>(
+                variable_indices, k_indices, dummy_state_parameters, dummy_state_variables);
+          });
     }
 
     /// @brief Returns a function that calculates the Jacobian contributions for this process (common interface overload)
@@ -384,12 +359,202 @@ namespace miam
       DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
 
+      return DispatchReactionOrder(
+          reactants_.size(),
+          [&](auto order) -> std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>
+          {
+            if (min_halflife_ > 0.0)
+              return JacobianFunctionCapped<decltype(order)::value, DenseMatrixPolicy, SparseMatrixPolicy>(
+                  variable_indices, jacobian_indices, k_indices, dummy_state_parameters, dummy_state_variables, jacobian);
+            return JacobianFunctionUncapped<decltype(order)::value, DenseMatrixPolicy, SparseMatrixPolicy>(
+                variable_indices, jacobian_indices, k_indices, dummy_state_parameters, dummy_state_variables, jacobian);
+          });
+    }
+
+    /// @brief Appends one mass-action term per phase instance to a fused forcing table
+    /// @details Rate-capped reactions (min_halflife_ > 0) cannot be expressed as plain
+    ///          mass-action terms and are left to the per-process ForcingFunction.
+    /// @param phase_prefixes Map of phase names to sets of state variable prefixes
+    /// @param state_parameter_indices Map of state parameter names to indices
+    /// @param state_variable_indices Map of state variable names to indices
+    /// @param terms Table to append to
+    /// @return true if the reaction was appended, false if it must be evaluated separately
+    bool AppendMassActionTerms(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
+        MassActionTerms& terms) const
+    {
       if (min_halflife_ > 0.0)
+        return false;
+      StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
+      std::vector<std::size_t> k_indices = GetParameterIndices(phase_prefixes, state_parameter_indices);
+      for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
       {
-        return JacobianFunctionCapped<DenseMatrixPolicy, SparseMatrixPolicy>(
-            variable_indices, jacobian_indices, k_indices, dummy_state_parameters, dummy_state_variables, jacobian);
+        std::vector<std::size_t> reactants(reactants_.size());
+        std::vector<std::size_t> products(products_.size());
+        for (std::size_t r = 0; r < reactants_.size(); ++r)
+          reactants[r] = variable_indices.reactant_indices_[i_phase][r];
+        for (std::size_t p = 0; p < products_.size(); ++p)
+          products[p] = variable_indices.product_indices_[i_phase][p];
+        terms.AddTerm(k_indices[i_phase], variable_indices.solvent_indices_[i_phase], solvent_floor_, reactants, products);
       }
+      return true;
+    }
+
+   private:
+    /// @brief Soft-min exponent for rate capping
+    /// @details Higher values approximate hard min more closely. 10 gives <7% error for
+    ///          equal-concentration reactants, and rapid convergence to exact min otherwise.
+    static constexpr double kSoftMinP = 10.0;
+    /// @brief Tiny floor to prevent pow(0, -p) overflow in soft-min
+    static constexpr double kSoftMinFloor = 1.0e-300;
+
+    /// @brief Helper struct for keeping track of state variable indices for reactants, products, and solvent across
+    /// multiple phase instances (e.g. grid cells)
+    struct StateVariableIndices
+    {
+      std::size_t number_of_phase_instances_;  ///< Number of instances of the phase in the system
+      micm::Matrix<std::size_t>
+          reactant_indices_;  ///< Matrix of state variable indices for reactants (num_prefixes x num_reactants)
+      micm::Matrix<std::size_t>
+          product_indices_;  ///< Matrix of state variable indices for products (num_prefixes x num_products)
+      std::vector<std::size_t> solvent_indices_;  ///< Vector of state variable indices for solvent (num_prefixes)
+    };
+
+    /// @brief Helper struct for keeping track of Jacobian sparse matrix elements
+    struct JacobianIndices
+    {
+      micm::Matrix<std::size_t>
+          indices_;  // Index in sparse matrix for each dependent/independent pair (num_pairs x num_prefixes)
+    };
 
+    /// @brief Sets a row variable to the damped rate k * [S] / ([S] + eps)^n_r * prod([reactants]) of one instance
+    /// @details With the reaction order fixed at compile time, the rate constant, solvent and all reactant
+    ///          columns are read in a single pass over the grid cells; the generic order makes one pass per reactant.
+    ///          The multiplication order is the same in both cases.
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order>
+    void DampedRate(
+        auto& state_parameters,
+        auto& state_variables,
+        auto& rate,
+        const StateVariableIndices& variable_indices,
+        std::size_t k_index,
+        std::size_t i_phase) const
+    {
+      const double eps = solvent_floor_;
+      const std::size_t n_r = reactants_.size();
+      if constexpr (Order == kGenericReactionOrder)
+      {
+        state_parameters.ForEachRow(
+            [&](const double& rate_constant, const double& solvent, double& rate)
+            { rate = rate_constant * solvent / ReactionOrderPower<Order>(solvent + eps, n_r); },
+            state_parameters.GetConstColumnView(k_index),
+            state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
+            rate);
+        for (std::size_t r = 0; r < n_r; ++r)
+        {
+          state_variables.ForEachRow(
+              [](const double& reactant, double& rate) { rate *= reactant; },
+              state_variables.GetConstColumnView(variable_indices.reactant_indices_[i_phase][r]),
+              rate);
+        }
+      }
+      else
+      {
+        [&]<std::size_t... R>(std::index_sequence<R...>)
+        {
+          state_parameters.ForEachRow(
+              [&](const double& rate_constant, const double& solvent, double& rate, const auto&... reactant)
+              { rate = ((rate_constant * solvent / ReactionOrderPower<Order>(solvent + eps, n_r)) * ... * reactant); },
+              state_parameters.GetConstColumnView(k_index),
+              state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
+              rate,
+              state_variables.GetConstColumnView(variable_indices.reactant_indices_[i_phase][R])...);
+        }(std::make_index_sequence<Order>{});
+      }
+    }
+
+    /// @brief Subtracts a rate row variable from the forcing of every reactant of one instance
+    /// @details With the reaction order fixed at compile time all reactant columns are updated in one pass
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order>
+    void SubtractFromReactants(
+        auto& forcing_terms,
+        auto& rate,
+        const StateVariableIndices& variable_indices,
+        std::size_t i_phase) const
+    {
+      if constexpr (Order == kGenericReactionOrder)
+      {
+        for (std::size_t r = 0; r < reactants_.size(); ++r)
+        {
+          forcing_terms.ForEachRow(
+              [](const double& rate, double& forcing) { forcing -= rate; },
+              rate,
+              forcing_terms.GetColumnView(variable_indices.reactant_indices_[i_phase][r]));
+        }
+      }
+      else
+      {
+        [&]<std::size_t... R>(std::index_sequence<R...>)
+        {
+          forcing_terms.ForEachRow(
+              [](const double& rate, auto&... forcing) { ((forcing -= rate), ...); },
+              rate,
+              forcing_terms.GetColumnView(variable_indices.reactant_indices_[i_phase][R])...);
+        }(std::make_index_sequence<Order>{});
+      }
+    }
+
+    /// @brief Returns the uncapped forcing function
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order, typename DenseMatrixPolicy>
+    auto ForcingFunctionUncapped(
+        const StateVariableIndices& variable_indices,
+        const std::vector<std::size_t>& k_indices,
+        DenseMatrixPolicy& dummy_state_parameters,
+        DenseMatrixPolicy& dummy_state_variables) const
+    {
+      return DenseMatrixPolicy::Function(
+          [this, variable_indices, k_indices](auto&& state_parameters, auto&& state_variables, auto&& forcing_terms)
+          {
+            auto rate = forcing_terms.GetRowVariable();
+
+            // For each phase instance, calculate the reaction rate and update the forcing terms
+            for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
+            {
+              // Calculate the damped rate: k * [S] / ([S] + eps)^n_r * prod([reactants])
+              DampedRate<Order>(state_parameters, state_variables, rate, variable_indices, k_indices[i_phase], i_phase);
+
+              // Apply the reaction rate to the forcing terms for reactants and products
+              SubtractFromReactants<Order>(forcing_terms, rate, variable_indices, i_phase);
+              for (std::size_t p = 0; p < products_.size(); ++p)
+              {
+                state_variables.ForEachRow(
+                    [&](const double& rate, double& forcing) { forcing += rate; },
+                    rate,
+                    forcing_terms.GetColumnView(variable_indices.product_indices_[i_phase][p]));
+              }
+            }
+          },
+          dummy_state_parameters,
+          dummy_state_variables,
+          dummy_state_variables);
+    }
+
+    /// @brief Returns the uncapped Jacobian function
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order, typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    auto JacobianFunctionUncapped(
+        const StateVariableIndices& variable_indices,
+        const JacobianIndices& jacobian_indices,
+        const std::vector<std::size_t>& k_indices,
+        DenseMatrixPolicy& dummy_state_parameters,
+        DenseMatrixPolicy& dummy_state_variables,
+        const SparseMatrixPolicy& jacobian) const
+    {
       return SparseMatrixPolicy::Function(
           [this, variable_indices, jacobian_indices, k_indices](
               auto&& state_parameters, auto&& state_variables, auto&& jacobian_values)
@@ -408,7 +573,7 @@ namespace miam
                 // dr/d[R_i] = k * [S] / ([S]+eps)^n_r * prod(R_j, j!=i)
                 jacobian_values.ForEachBlock(
                     [&](const double& rate_constant, const double& solvent, double& partial)
-                    { partial = rate_constant * solvent / std::pow(solvent + eps, n_r); },
+                    { partial = rate_constant * solvent / ReactionOrderPower<Order>(solvent + eps, n_r); },
                     state_parameters.GetConstColumnView(k_indices[i_phase]),
                     state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
                     d_rate_d_ind);
@@ -443,8 +608,8 @@ namespace miam
               // dr/d[S] = k * (eps + (1-n_r)*[S]) / ([S]+eps)^(n_r+1) * prod([R_i])
               jacobian_values.ForEachBlock(
                   [&](const double& rate_constant, const double& solvent, double& partial) {
-                    partial =
-                        rate_constant * (eps + (1.0 - static_cast<int>(n_r)) * solvent) / std::pow(solvent + eps, n_r + 1);
+                    partial = rate_constant * (eps + (1.0 - static_cast<int>(n_r)) * solvent) /
+                              ReactionOrderPower<kNextReactionOrder<Order>>(solvent + eps, n_r + 1);
                   },
                   state_parameters.GetConstColumnView(k_indices[i_phase]),
                   state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
@@ -480,35 +645,9 @@ namespace miam
           jacobian);
     }
 
-   private:
-    /// @brief Soft-min exponent for rate capping
-    /// @details Higher values approximate hard min more closely. 10 gives <7% error for
-    ///          equal-concentration reactants, and rapid convergence to exact min otherwise.
-    static constexpr double kSoftMinP = 10.0;
-    /// @brief Tiny floor to prevent pow(0, -p) overflow in soft-min
-    static constexpr double kSoftMinFloor = 1.0e-300;
-
-    /// @brief Helper struct for keeping track of state variable indices for reactants, products, and solvent across
-    /// multiple phase instances (e.g. grid cells)
-    struct StateVariableIndices
-    {
-      std::size_t number_of_phase_instances_;  ///< Number of instances of the phase in the system
-      micm::Matrix<std::size_t>
-          reactant_indices_;  ///< Matrix of state variable indices for reactants (num_prefixes x num_reactants)
-      micm::Matrix<std::size_t>
-          product_indices_;  ///< Matrix of state variable indices for products (num_prefixes x num_products)
-      std::vector<std::size_t> solvent_indices_;  ///< Vector of state variable indices for solvent (num_prefixes)
-    };
-
-    /// @brief Helper struct for keeping track of Jacobian sparse matrix elements
-    struct JacobianIndices
-    {
-      micm::Matrix<std::size_t>
-          indices_;  // Index in sparse matrix for each dependent/independent pair (num_pairs x num_prefixes)
-    };
-
     /// @brief Returns the capped forcing function (called only when min_halflife_ > 0)
-    template<typename DenseMatrixPolicy>
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order, typename DenseMatrixPolicy>
     auto ForcingFunctionCapped(
         const StateVariableIndices& variable_indices,
         const std::vector<std::size_t>& k_indices,
@@ -520,26 +659,13 @@ namespace miam
           {
             auto rate = forcing_terms.GetRowVariable();
             auto accum = forcing_terms.GetRowVariable();
-            const double eps = solvent_floor_;
             const std::size_t n_r = reactants_.size();
             const double t_half = min_halflife_;
 
             for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
             {
               // 1. Compute raw rate: k * [S] / ([S] + eps)^n_r * prod([R_i])
-              state_parameters.ForEachRow(
-                  [&](const double& rate_constant, const double& solvent, double& rate)
-                  { rate = rate_constant * solvent / std::pow(solvent + eps, n_r); },
-                  state_parameters.GetConstColumnView(k_indices[i_phase]),
-                  state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
-                  rate);
-              for (std::size_t r = 0; r < n_r; ++r)
-              {
-                state_variables.ForEachRow(
-                    [](const double& reactant, double& rate) { rate *= reactant; },
-                    state_variables.GetConstColumnView(variable_indices.reactant_indices_[i_phase][r]),
-                    rate);
-              }
+              DampedRate<Order>(state_parameters, state_variables, rate, variable_indices, k_indices[i_phase], i_phase);
 
               // 2. Compute soft-min of reactant concentrations: C_min = (sum R_i^{-p})^{-1/p}
               state_variables.ForEachRow(
@@ -567,13 +693,7 @@ namespace miam
                   accum);
 
               // 4. Apply capped rate to forcing
-              for (std::size_t r = 0; r < n_r; ++r)
-              {
-                state_variables.ForEachRow(
-                    [](const double& rate, double& forcing) { forcing -= rate; },
-                    rate,
-                    forcing_terms.GetColumnView(variable_indices.reactant_indices_[i_phase][r]));
-              }
+              SubtractFromReactants<Order>(forcing_terms, rate, variable_indices, i_phase);
               for (std::size_t p = 0; p < products_.size(); ++p)
               {
                 state_variables.ForEachRow(
@@ -597,7 +717,8 @@ namespace miam
     ///
     ///          For independent solvent S (r_max doesn't depend on S):
     ///            dr_c/dS = sech^2(u) * dr/dS
-    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    /// @tparam Order Number of reactants, or kGenericReactionOrder
+    template<int Order, typename DenseMatrixPolicy, typename SparseMatrixPolicy>
     auto JacobianFunctionCapped(
         const StateVariableIndices& variable_indices,
         const JacobianIndices& jacobian_indices,
@@ -625,7 +746,7 @@ namespace miam
               // Step A: Compute raw rate into raw_rate
               jacobian_values.ForEachBlock(
                   [&](const double& rate_constant, const double& solvent, double& rr)
-                  { rr = rate_constant * solvent / std::pow(solvent + eps, n_r); },
+                  { rr = rate_constant * solvent / ReactionOrderPower<Order>(solvent + eps, n_r); },
                   state_parameters.GetConstColumnView(k_indices[i_phase]),
                   state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
                   raw_rate);
@@ -680,7 +801,7 @@ namespace miam
                 // D1: Compute raw partial dr/dR_{i_ind}
                 jacobian_values.ForEachBlock(
                     [&](const double& rate_constant, const double& solvent, double& partial)
-                    { partial = rate_constant * solvent / std::pow(solvent + eps, n_r); },
+                    { partial = rate_constant * solvent / ReactionOrderPower<Order>(solvent + eps, n_r); },
                     state_parameters.GetConstColumnView(k_indices[i_phase]),
                     state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
                     d_rate_d_ind);
@@ -729,8 +850,8 @@ namespace miam
               // dr/dS = k * (eps + (1-n_r)*S) / (S+eps)^{n_r+1} * prod(R_i)
               jacobian_values.ForEachBlock(
                   [&](const double& rate_constant, const double& solvent, double& partial) {
-                    partial =
-                        rate_constant * (eps + (1.0 - static_cast<int>(n_r)) * solvent) / std::pow(solvent + eps, n_r + 1);
+                    partial = rate_constant * (eps + (1.0 - static_cast<int>(n_r)) * solvent) /
+                              ReactionOrderPower<kNextReactionOrder<Order>>(solvent + eps, n_r + 1);
                   },
                   state_parameters.GetConstColumnView(k_indices[i_phase]),
                   state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
@@ -770,6 +891,13 @@ namespace miam
           jacobian);
     }
 
+    /// @brief Returns the name of the state parameter that holds the rate constant for a prefix
+    /// @details Prefixes with equal rate constants share one parameter (see SharedRateConstantPrefix)
+    std::string RateParameterName(const std::set<std::string>& prefixes, const std::string& prefix) const
+    {
+      return SharedRateConstantPrefix(rate_constants_, prefixes, prefix) + "." + phase_.name_ + "." + uuid_ + ".k";
+    }
+
     /// @brief Returns one parameter index per phase instance, in the same prefix-sorted order as GetStateVariableIndices
     std::vector<std::size_t> GetParameterIndices(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
@@ -785,7 +913,7 @@ namespace miam
             "Internal Error: GetParameterIndices: Phase " + phase_.name_ + " not found in phase_prefixes");
       for (const auto& prefix : phase_it->second)
       {
-        std::string k_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k";
+        std::string k_param = RateParameterName(phase_it->second, prefix);
         if (state_parameter_indices.find(k_param) == state_parameter_indices.end())
           throw MiamException(
               MIAM_ERROR_CATEGORY_INTERNAL,
@@ -3,16 +3,15 @@
 
 #pragma once
 
+#include <miam/processes/constants/rate_constant.hpp>
 #include <miam/processes/dissolved_reaction.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
 
-#include <micm/process/rate_constant/arrhenius_rate_constant.hpp>
-#include <micm/process/rate_constant/rate_constant_functions.hpp>
 #include <micm/system/conditions.hpp>
 
-#include <functional>
 #include <map>
+#include <set>
 #include <string>
 
 namespace miam
@@ -73,19 +72,22 @@ namespace miam
     }
 
     /// @brief Adds a rate constant for a specific representation prefix
-    DissolvedReactionBuilder& AddRateConstant(
-        const std::string& prefix,
-        std::function<double(const micm::Conditions&)> rate_constant)
+    /// @details Accepts a constant, VantHoffParameters, micm::ArrheniusRateConstantParameters,
+    ///          TroeRateConstantParameters, or any `double(const micm::Conditions&)` callable.
+    ///          The closed-form kinds are evaluated column-wise; callables are the slow path.
+    DissolvedReactionBuilder& AddRateConstant(const std::string& prefix, RateConstant rate_constant)
     {
-      rate_constants_[prefix] = std::move(rate_constant);
+      rate_constants_.insert_or_assign(prefix, std::move(rate_constant));
       return *this;
     }
 
-    /// @brief Adds an Arrhenius rate constant for a specific representation prefix
-    DissolvedReactionBuilder& AddRateConstant(const std::string& prefix, const micm::ArrheniusRateConstantParameters& params)
+    /// @brief Adds one rate constant for several representation prefixes
+    /// @details The prefixes share the rate constant, so the reaction evaluates it into a single state parameter
+    ///          even when it is a callable (e.g. one function for every bin of a sectional distribution)
+    DissolvedReactionBuilder& AddRateConstant(const std::set<std::string>& prefixes, const RateConstant& rate_constant)
     {
-      rate_constants_[prefix] = [params](const micm::Conditions& conditions)
-      { return micm::CalculateArrhenius(params, conditions.temperature_, conditions.pressure_); };
+      for (const auto& prefix : prefixes)
+        rate_constants_.insert_or_assign(prefix, rate_constant);
       return *this;
     }
 
@@ -137,8 +139,7 @@ namespace miam
     std::vector<micm::Species> products_;   ///< Product species
     micm::Species solvent_;                 ///< Solvent species
     bool solvent_is_set_ = false;           ///< Flag to track if the solvent has been set
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        rate_constants_;               ///< Per-prefix rate constants
+    std::map<std::string, RateConstant> rate_constants_;  ///< Per-prefix rate constants
     double solvent_floor_{ 1.0e-20 };  ///< Floor δ [mol m⁻³] added to [S] in ([S]+δ)^n denominator; see SetSolventFloor()
     double min_halflife_{ 0.0 };       ///< Minimum half-life for rate capping [s]
   };
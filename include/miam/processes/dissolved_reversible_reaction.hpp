@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <miam/math/reaction_order.hpp>
+#include <miam/processes/constants/rate_constant.hpp>
+#include <miam/processes/mass_action_terms.hpp>
 #include <miam/representations/aerosol_property.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -51,10 +55,8 @@ namespace miam
   class DissolvedReversibleReaction
   {
    public:
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        forward_rate_constants_;  ///< Forward rate constant functions keyed by representation prefix
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        reverse_rate_constants_;            ///< Reverse rate constant functions keyed by representation prefix
+    std::map<std::string, RateConstant> forward_rate_constants_;  ///< Forward rate constants keyed by representation prefix
+    std::map<std::string, RateConstant> reverse_rate_constants_;  ///< Reverse rate constants keyed by representation prefix
     std::vector<micm::Species> reactants_;  ///< Reactant species
     std::vector<micm::Species> products_;   ///< Product species
     micm::Species solvent_;                 ///< Solvent species
@@ -68,8 +70,8 @@ namespace miam
 
     /// @brief Constructor
     DissolvedReversibleReaction(
-        std::map<std::string, std::function<double(const micm::Conditions& conditions)>> forward_rate_constants,
-        std::map<std::string, std::function<double(const micm::Conditions& conditions)>> reverse_rate_constants,
+        std::map<std::string, RateConstant> forward_rate_constants,
+        std::map<std::string, RateConstant> reverse_rate_constants,
         const std::vector<micm::Species>& reactants,
         const std::vector<micm::Species>& products,
         micm::Species solvent,
@@ -100,15 +102,16 @@ namespace miam
     /// @return Set of unique parameter names for this process
     std::set<std::string> ProcessParameterNames(const std::map<std::string, std::set<std::string>>& phase_prefixes) const
     {
-      // One forward and one reverse rate constant parameter per representation instance of this phase.
+      // One forward and one reverse rate constant parameter per distinct rate constant among the
+      // representation instances of this phase.
       std::set<std::string> parameter_names;
       auto it = phase_prefixes.find(phase_.name_);
       if (it != phase_prefixes.end())
       {
         for (const auto& prefix : it->second)
         {
-          parameter_names.insert(prefix + "." + phase_.name_ + "." + uuid_ + ".k_forward");
-          parameter_names.insert(prefix + "." + phase_.name_ + "." + uuid_ + ".k_reverse");
+          parameter_names.insert(ForwardParameterName(it->second, prefix));
+          parameter_names.insert(ReverseParameterName(it->second, prefix));
         }
       }
       return parameter_names;
@@ -166,8 +169,22 @@ namespace miam
         const auto& state_variable_indices  // acts like std::unordered_map<std::string, std::size_t>
     ) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> jacobian_indices;
+      SparsityPattern jacobian_indices;
+      AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, jacobian_indices);
+      return jacobian_indices.ToSet();
+    }
 
+    /// @brief Appends the Jacobian index pairs for this process to a sparsity pattern
+    /// @param phase_prefixes Map of phase names to sets of state variable prefixes (prefix does not include phase or
+    /// species names)
+    /// @param state_variable_indices Map of state variable names to their corresponding indices in the Jacobian
+    /// @param jacobian_indices Pattern to append the (dependent, independent) pairs to; may contain duplicates until
+    ///        it is finalized
+    void AppendNonZeroJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_variable_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        SparsityPattern& jacobian_indices) const
+    {
       StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
       // Get pairs for each phase instance
       for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
@@ -180,13 +197,13 @@ namespace miam
           for (std::size_t r2 = 0; r2 < variable_indices.reactant_indices_.NumColumns(); ++r2)
           {
             std::size_t dependent_index = variable_indices.reactant_indices_[i_phase][r2];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
           // Each reactant affects all products
           for (std::size_t p = 0; p < variable_indices.product_indices_.NumColumns(); ++p)
           {
             std::size_t dependent_index = variable_indices.product_indices_[i_phase][p];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
         }
         // Product contributions
@@ -197,13 +214,13 @@ namespace miam
           for (std::size_t r = 0; r < variable_indices.reactant_indices_.NumColumns(); ++r)
           {
             std::size_t dependent_index = variable_indices.reactant_indices_[i_phase][r];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
           // Each product affects all products
           for (std::size_t p2 = 0; p2 < variable_indices.product_indices_.NumColumns(); ++p2)
           {
             std::size_t dependent_index = variable_indices.product_indices_[i_phase][p2];
-            jacobian_indices.insert({ dependent_index, independent_index });
+            jacobian_indices.Add(dependent_index, independent_index);
           }
         }
         // Solvent contributions (affects all reactants and products)
@@ -211,16 +228,14 @@ namespace miam
         for (std::size_t r = 0; r < variable_indices.reactant_indices_.NumColumns(); ++r)
         {
           std::size_t dependent_index = variable_indices.reactant_indices_[i_phase][r];
-          jacobian_indices.insert({ dependent_index, independent_index });
+          jacobian_indices.Add(dependent_index, independent_index);
         }
         for (std::size_t p = 0; p < variable_indices.product_indices_.NumColumns(); ++p)
         {
           std::size_t dependent_index = variable_indices.product_indices_[i_phase][p];
-          jacobian_indices.insert({ dependent_index, independent_index });
+          jacobian_indices.Add(dependent_index, independent_index);
         }
       }
-
-      return jacobian_indices;
     }
 
     /// @brief Returns non-zero Jacobian elements (common interface overload accepting providers)
@@ -247,19 +262,20 @@ namespace miam
         const auto& state_parameter_indices  // acts like std::unordered_map<std::string, std::size_t>
     ) const
     {
-      // Build per-prefix parameter slots paired with the matching rate constant functions
-      std::vector<std::pair<std::size_t, std::function<double(const micm::Conditions&)>>> forward_slots;
-      std::vector<std::pair<std::size_t, std::function<double(const micm::Conditions&)>>> reverse_slots;
+      // Build per-prefix parameter slots paired with the matching rate constants
+      std::vector<std::pair<std::size_t, RateConstant>> forward_slots;
+      std::vector<std::pair<std::size_t, RateConstant>> reverse_slots;
       auto phase_it = phase_prefixes.find(phase_.name_);
       if (phase_it == phase_prefixes.end())
         throw MiamException(
             MIAM_ERROR_CATEGORY_INTERNAL,
             MIAM_INTERNAL_MISSING_PHASE_PREFIX,
             "Internal Error: UpdateStateParametersFunction: Phase " + phase_.name_ + " not found in phase_prefixes");
+      // Prefixes sharing a rate constant share its parameter column, which is filled once
       for (const auto& prefix : phase_it->second)
       {
-        std::string forward_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k_forward";
-        std::string reverse_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k_reverse";
+        std::string forward_param = ForwardParameterName(phase_it->second, prefix);
+        std::string reverse_param = ReverseParameterName(phase_it->second, prefix);
         if (state_parameter_indices.find(forward_param) == state_parameter_indices.end())
           throw MiamException(
               MIAM_ERROR_CATEGORY_INTERNAL,
@@ -284,8 +300,10 @@ namespace miam
               MIAM_ERROR_CATEGORY_CONFIGURATION,
               MIAM_CONFIGURATION_MISSING_REQUIRED_PARAMETER,
               "DissolvedReversibleReaction: No reverse rate constant configured for representation prefix '" + prefix + "'");
-        forward_slots.push_back({ state_parameter_indices.at(forward_param), forward_it->second });
-        reverse_slots.push_back({ state_parameter_indices.at(reverse_param), reverse_it->second });
+        if (SharedRateConstantPrefix(forward_rate_constants_, phase_it->second, prefix) == prefix)
+          forward_slots.push_back({ state_parameter_indices.at(forward_param), forward_it->second });
+        if (SharedRateConstantPrefix(reverse_rate_constants_, phase_it->second, prefix) == prefix)
+          reverse_slots.push_back({ state_parameter_indices.at(reverse_param), reverse_it->second });
       }
 
       // Set up dummy arguments to build the function
@@ -296,16 +314,10 @@ namespace miam
       return DenseMatrixPolicy::Function(
           [forward_slots, reverse_slots](auto&& conditions, auto&& params)
           {
-            for (const auto& [param_index, rate_fn] : forward_slots)
-              params.ForEachRow(
-                  [&](const micm::Conditions& condition, double& parameter) { parameter = rate_fn(condition); },
-                  conditions,
-                  params.GetColumnView(param_index));
-            for (const auto& [param_index, rate_fn] : reverse_slots)
-              params.ForEachRow(
-                  [&](const micm::Conditions& condition, double& parameter) { parameter = rate_fn(condition); },
-                  conditions,
-                  params.GetColumnView(param_index));
+            for (const auto& [param_index, rate_constant] : forward_slots)
+              rate_constant.EvaluateColumn(conditions, params, param_index);
+            for (const auto& [param_index, rate_constant] : reverse_slots)
+              rate_constant.EvaluateColumn(conditions, params, param_index);
           },
           conditions_vector,
           state_parameters);
@@ -342,6 +354,131 @@ namespace miam
       auto [forward_indices, reverse_indices] = GetParameterIndices(phase_prefixes, state_parameter_indices);
       DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
+      using ForcingFunctionType =
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)>;
+      return DispatchReactionOrder(
+          reactants_.size(),
+          [&](auto reactant_order) -> ForcingFunctionType
+          {
+            return DispatchReactionOrder(
+                products_.size(),
+                [&](auto product_order) -> ForcingFunctionType
+                {
+                  return ForcingFunctionImpl<decltype(reactant_order)::value, decltype(product_order)::value>(
+                      variable_indices, forward_indices, reverse_indices, dummy_state_parameters, dummy_state_variables);
+                });
+          });
+    }
+
+    /// @brief Returns a function that calculates the Jacobian contributions for this process (common interface overload)
+    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
+        const SparseMatrixPolicy& jacobian,
+        std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> /* providers */) const
+    {
+      return JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+          phase_prefixes, state_parameter_indices, state_variable_indices, jacobian);
+    }
+
+    /// @brief Returns a function that calculates the Jacobian contributions for this process (original)
+    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
+        const SparseMatrixPolicy& jacobian) const
+    {
+      StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
+      JacobianIndices jacobian_indices = GetJacobianIndices(variable_indices, jacobian);
+      auto [forward_indices, reverse_indices] = GetParameterIndices(phase_prefixes, state_parameter_indices);
+      DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
+      DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
+      using JacobianFunctionType =
+          std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)>;
+      return DispatchReactionOrder(
+          reactants_.size(),
+          [&](auto reactant_order) -> JacobianFunctionType
+          {
+            return DispatchReactionOrder(
+                products_.size(),
+                [&](auto product_order) -> JacobianFunctionType
+                {
+                  return JacobianFunctionImpl<decltype(reactant_order)::value, decltype(product_order)::value>(
+                      variable_indices,
+                      jacobian_indices,
+                      forward_indices,
+                      reverse_indices,
+                      dummy_state_parameters,
+                      dummy_state_variables,
+                      jacobian);
+                });
+          });
+    }
+
+    /// @brief Appends a forward and a reverse mass-action term per phase instance to a fused forcing table
+    /// @param phase_prefixes Map of phase names to sets of state variable prefixes
+    /// @param state_parameter_indices Map of state parameter names to indices
+    /// @param state_variable_indices Map of state variable names to indices
+    /// @param terms Table to append to
+    /// @return Always true; reversible reactions are always expressible as mass-action terms
+    bool AppendMassActionTerms(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
+        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
+        MassActionTerms& terms) const
+    {
+      StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
+      auto [forward_indices, reverse_indices] = GetParameterIndices(phase_prefixes, state_parameter_indices);
+      for (std::size_t i_phase = 0; i_phase < variable_indices.number_of_phase_instances_; ++i_phase)
+      {
+        std::vector<std::size_t> reactants(reactants_.size());
+        std::vector<std::size_t> products(products_.size());
+        for (std::size_t r = 0; r < reactants_.size(); ++r)
+          reactants[r] = variable_indices.reactant_indices_[i_phase][r];
+        for (std::size_t p = 0; p < products_.size(); ++p)
+          products[p] = variable_indices.product_indices_[i_phase][p];
+        const std::size_t solvent_index = variable_indices.solvent_indices_[i_phase];
+        terms.AddTerm(forward_indices[i_phase], solvent_index, solvent_floor_, reactants, products);
+        terms.AddTerm(reverse_indices[i_phase], solvent_index, solvent_floor_, products, reactants);
+      }
+      return true;
+    }
+
+   private:
+    /// @brief Helper struct for keeping track of state varible indices for reactants, products, and solvent across
+    /// multiple phase instances (e.g. grid cells)
+    struct StateVariableIndices
+    {
+      std::size_t number_of_phase_instances_;  ///< Number of instances of the phase in the system (e.g. number of grid
+                                               ///< cells containing this phase)
+      micm::Matrix<std::size_t>
+          reactant_indices_;  ///< Matrix of state variable indices for reactants (num_reactants x num_prefixes)
+      micm::Matrix<std::size_t>
+          product_indices_;  ///< Matrix of state variable indices for products (num_products x num_prefixes)
+      std::vector<std::size_t> solvent_indices_;  ///< Vector of state variable indices for solvent (num_prefixes)
+    };
+
+    /// @brief Helper struct for keeping track of Jacobian sparse matrix elements
+    struct JacobianIndices
+    {
+      micm::Matrix<std::size_t>
+          indices_;  // Index in sparse matrix for each dependent/independent pair (num_pairs x num_prefixes)
+    };
+
+    /// @brief Returns the forcing function for a given reactant and product count
+    /// @tparam ReactantOrder Number of reactants, or kGenericReactionOrder
+    /// @tparam ProductOrder Number of products, or kGenericReactionOrder
+    template<int ReactantOrder, int ProductOrder, typename DenseMatrixPolicy>
+    auto ForcingFunctionImpl(
+        const StateVariableIndices& variable_indices,
+        const std::vector<std::size_t>& forward_indices,
+        const std::vector<std::size_t>& reverse_indices,
+        DenseMatrixPolicy& dummy_state_parameters,
+        DenseMatrixPolicy& dummy_state_variables) const
+    {
       return DenseMatrixPolicy::Function(
           [this, variable_indices, forward_indices, reverse_indices](
               auto&& state_parameters, auto&& state_variables, auto&& forcing_terms)
@@ -363,8 +500,8 @@ namespace miam
                       double& forward_rate,
                       double& reverse_rate)
                   {
-                    forward_rate = forward_rate_constant * solvent / std::pow(solvent + eps, n_r);
-                    reverse_rate = reverse_rate_constant * solvent / std::pow(solvent + eps, n_p);
+                    forward_rate = forward_rate_constant * solvent / ReactionOrderPower<ReactantOrder>(solvent + eps, n_r);
+                    reverse_rate = reverse_rate_constant * solvent / ReactionOrderPower<ProductOrder>(solvent + eps, n_p);
                   },
                   state_parameters.GetConstColumnView(forward_indices[i_phase]),
                   state_parameters.GetConstColumnView(reverse_indices[i_phase]),
@@ -418,32 +555,19 @@ namespace miam
           dummy_state_variables);
     }
 
-    /// @brief Returns a function that calculates the Jacobian contributions for this process (common interface overload)
-    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
-    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
-        const std::map<std::string, std::set<std::string>>& phase_prefixes,
-        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
-        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
-        const SparseMatrixPolicy& jacobian,
-        std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> /* providers */) const
-    {
-      return JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
-          phase_prefixes, state_parameter_indices, state_variable_indices, jacobian);
-    }
-
-    /// @brief Returns a function that calculates the Jacobian contributions for this process (original)
-    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
-    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
-        const std::map<std::string, std::set<std::string>>& phase_prefixes,
-        const auto& state_parameter_indices,  // acts like std::unordered_map<std::string, std::size_t>
-        const auto& state_variable_indices,   // acts like std::unordered_map<std::string, std::size_t>
+    /// @brief Returns the Jacobian function for a given reactant and product count
+    /// @tparam ReactantOrder Number of reactants, or kGenericReactionOrder
+    /// @tparam ProductOrder Number of products, or kGenericReactionOrder
+    template<int ReactantOrder, int ProductOrder, typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    auto JacobianFunctionImpl(
+        const StateVariableIndices& variable_indices,
+        const JacobianIndices& jacobian_indices,
+        const std::vector<std::size_t>& forward_indices,
+        const std::vector<std::size_t>& reverse_indices,
+        DenseMatrixPolicy& dummy_state_parameters,
+        DenseMatrixPolicy& dummy_state_variables,
         const SparseMatrixPolicy& jacobian) const
     {
-      StateVariableIndices variable_indices = GetStateVariableIndices(phase_prefixes, state_variable_indices);
-      JacobianIndices jacobian_indices = GetJacobianIndices(variable_indices, jacobian);
-      auto [forward_indices, reverse_indices] = GetParameterIndices(phase_prefixes, state_parameter_indices);
-      DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
       return SparseMatrixPolicy::Function(
           [this, variable_indices, jacobian_indices, forward_indices, reverse_indices](
               auto&& state_parameters, auto&& state_variables, auto&& jacobian_values)
@@ -464,7 +588,7 @@ namespace miam
                 // dr_fwd/d[R_i] = k_f * [S] / ([S]+eps)^n_r * prod(R_j, j!=i)
                 jacobian_values.ForEachBlock(
                     [&](const double& forward_rate_constant, const double& solvent, double& partial)
-                    { partial = forward_rate_constant * solvent / std::pow(solvent + eps, n_r); },
+                    { partial = forward_rate_constant * solvent / ReactionOrderPower<ReactantOrder>(solvent + eps, n_r); },
                     state_parameters.GetConstColumnView(forward_indices[i_phase]),
                     state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
                     d_forward_rate_d_ind);
@@ -501,7 +625,7 @@ namespace miam
                 // dr_rev/d[P_i] = k_r * [S] / ([S]+eps)^n_p * prod(P_j, j!=i)
                 jacobian_values.ForEachBlock(
                     [&](const double& reverse_rate_constant, const double& solvent, double& partial)
-                    { partial = reverse_rate_constant * solvent / std::pow(solvent + eps, n_p); },
+                    { partial = reverse_rate_constant * solvent / ReactionOrderPower<ProductOrder>(solvent + eps, n_p); },
                     state_parameters.GetConstColumnView(reverse_indices[i_phase]),
                     state_variables.GetConstColumnView(variable_indices.solvent_indices_[i_phase]),
                     d_reverse_rate_d_ind);
@@ -542,9 +666,9 @@ namespace miam
                       double& reverse_partial)
                   {
                     forward_partial = forward_rate_constant * (eps + (1.0 - static_cast<int>(n_r)) * solvent) /
-                                      std::pow(solvent + eps, n_r + 1);
+                                      ReactionOrderPower<kNextReactionOrder<ReactantOrder>>(solvent + eps, n_r + 1);
                     reverse_partial = reverse_rate_constant * (eps + (1.0 - static_cast<int>(n_p)) * solvent) /
-                                      std::pow(solvent + eps, n_p + 1);
+                                      ReactionOrderPower<kNextReactionOrder<ProductOrder>>(solvent + eps, n_p + 1);
                   },
                   state_parameters.GetConstColumnView(forward_indices[i_phase]),
                   state_parameters.GetConstColumnView(reverse_indices[i_phase]),
@@ -599,27 +723,6 @@ namespace miam
           jacobian);
     }
 
-   private:
-    /// @brief Helper struct for keeping track of state varible indices for reactants, products, and solvent across
-    /// multiple phase instances (e.g. grid cells)
-    struct StateVariableIndices
-    {
-      std::size_t number_of_phase_instances_;  ///< Number of instances of the phase in the system (e.g. number of grid
-                                               ///< cells containing this phase)
-      micm::Matrix<std::size_t>
-          reactant_indices_;  ///< Matrix of state variable indices for reactants (num_reactants x num_prefixes)
-      micm::Matrix<std::size_t>
-          product_indices_;  ///< Matrix of state variable indices for products (num_products x num_prefixes)
-      std::vector<std::size_t> solvent_indices_;  ///< Vector of state variable indices for solvent (num_prefixes)
-    };
-
-    /// @brief Helper struct for keeping track of Jacobian sparse matrix elements
-    struct JacobianIndices
-    {
-      micm::Matrix<std::size_t>
-          indices_;  // Index in sparse matrix for each dependent/independent pair (num_pairs x num_prefixes)
-    };
-
     /// @brief Helper function to return parameter indices for the forward and reverse rate constants
     /// @param phase_prefixes Map of phase names to sets of state variable prefixes (prefix does not include phase or
     /// species names)
@@ -641,8 +744,8 @@ namespace miam
             "Internal Error: GetParameterIndices: Phase " + phase_.name_ + " not found in phase_prefixes");
       for (const auto& prefix : phase_it->second)
       {
-        std::string forward_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k_forward";
-        std::string reverse_param = prefix + "." + phase_.name_ + "." + uuid_ + ".k_reverse";
+        std::string forward_param = ForwardParameterName(phase_it->second, prefix);
+        std::string reverse_param = ReverseParameterName(phase_it->second, prefix);
         if (state_parameter_indices.find(forward_param) == state_parameter_indices.end())
           throw MiamException(
               MIAM_ERROR_CATEGORY_INTERNAL,
@@ -661,6 +764,22 @@ namespace miam
       return { forward_indices, reverse_indices };
     }
 
+    /// @brief Returns the name of the state parameter that holds the forward rate constant for a prefix
+    /// @details Prefixes with equal forward rate constants share one parameter (see SharedRateConstantPrefix)
+    std::string ForwardParameterName(const std::set<std::string>& prefixes, const std::string& prefix) const
+    {
+      return SharedRateConstantPrefix(forward_rate_constants_, prefixes, prefix) + "." + phase_.name_ + "." + uuid_ +
+             ".k_forward";
+    }
+
+    /// @brief Returns the name of the state parameter that holds the reverse rate constant for a prefix
+    /// @details Prefixes with equal reverse rate constants share one parameter (see SharedRateConstantPrefix)
+    std::string ReverseParameterName(const std::set<std::string>& prefixes, const std::string& prefix) const
+    {
+      return SharedRateConstantPrefix(reverse_rate_constants_, prefixes, prefix) + "." + phase_.name_ + "." + uuid_ +
+             ".k_reverse";
+    }
+
     /// @brief Helper function to return variable indices for all species involved in the reaction
     /// @param phase_prefixes Map of phase names to sets of state variable prefixes (prefix does not include phase or
     /// species names)
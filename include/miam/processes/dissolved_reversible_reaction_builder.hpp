@@ -3,18 +3,21 @@
 
 #pragma once
 
+#include <miam/processes/constants/equilibrium_constant.hpp>
+#include <miam/processes/constants/rate_constant.hpp>
 #include <miam/processes/dissolved_reversible_reaction.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
 
-#include <micm/process/rate_constant/arrhenius_rate_constant.hpp>
-#include <micm/process/rate_constant/rate_constant_functions.hpp>
 #include <micm/system/conditions.hpp>
 
 #include <functional>
 #include <map>
 #include <set>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace miam
 {
@@ -72,41 +75,87 @@ namespace miam
     }
 
     /// @brief Adds a forward rate constant for a specific representation prefix
-    DissolvedReversibleReactionBuilder& AddForwardRateConstant(const std::string& prefix, const auto& forward_rate_constant)
+    /// @details Accepts anything RateConstant is constructible from (a constant, VantHoffParameters,
+    ///          micm::ArrheniusRateConstantParameters, TroeRateConstantParameters, or a callable).
+    DissolvedReversibleReactionBuilder& AddForwardRateConstant(const std::string& prefix, RateConstant forward_rate_constant)
     {
-      forward_rate_constants_[prefix] = [forward_rate_constant](const micm::Conditions& conditions)
-      { return forward_rate_constant.Calculate(conditions); };
+      forward_rate_constants_.insert_or_assign(prefix, std::move(forward_rate_constant));
       return *this;
     }
 
-    /// @brief Adds a forward rate constant from Arrhenius parameters for a specific representation prefix
+    /// @brief Adds a forward rate constant object with a Calculate(conditions) method for a specific representation prefix
+    template<typename ConstantType>
+      requires requires(const ConstantType& constant, const micm::Conditions& conditions) { constant.Calculate(conditions); }
     DissolvedReversibleReactionBuilder& AddForwardRateConstant(
         const std::string& prefix,
-        const micm::ArrheniusRateConstantParameters& params)
+        const ConstantType& forward_rate_constant)
     {
-      forward_rate_constants_[prefix] = [params](const micm::Conditions& conditions)
-      { return micm::CalculateArrhenius(params, conditions.temperature_, conditions.pressure_); };
+      forward_rate_constants_.insert_or_assign(prefix, ToRateConstant(forward_rate_constant));
       return *this;
     }
 
+    /// @brief Adds one forward rate constant for several representation prefixes
+    /// @details The prefixes share the rate constant, so the reaction evaluates it into a single state parameter
+    ///          even when it is a callable
+    DissolvedReversibleReactionBuilder& AddForwardRateConstant(
+        const std::set<std::string>& prefixes,
+        const RateConstant& forward_rate_constant)
+    {
+      for (const auto& prefix : prefixes)
+        forward_rate_constants_.insert_or_assign(prefix, forward_rate_constant);
+      return *this;
+    }
+
+    /// @brief Adds one forward rate constant object with a Calculate(conditions) method for several representation prefixes
+    template<typename ConstantType>
+      requires requires(const ConstantType& constant, const micm::Conditions& conditions) { constant.Calculate(conditions); }
+    DissolvedReversibleReactionBuilder& AddForwardRateConstant(
+        const std::set<std::string>& prefixes,
+        const ConstantType& forward_rate_constant)
+    {
+      return AddForwardRateConstant(prefixes, ToRateConstant(forward_rate_constant));
+    }
+
     /// @brief Adds a reverse rate constant for a specific representation prefix
-    DissolvedReversibleReactionBuilder& AddReverseRateConstant(const std::string& prefix, const auto& reverse_rate_constant)
+    /// @details Accepts the same kinds as AddForwardRateConstant.
+    DissolvedReversibleReactionBuilder& AddReverseRateConstant(const std::string& prefix, RateConstant reverse_rate_constant)
     {
-      reverse_rate_constants_[prefix] = [reverse_rate_constant](const micm::Conditions& conditions)
-      { return reverse_rate_constant.Calculate(conditions); };
+      reverse_rate_constants_.insert_or_assign(prefix, std::move(reverse_rate_constant));
       return *this;
     }
 
-    /// @brief Adds a reverse rate constant from Arrhenius parameters for a specific representation prefix
+    /// @brief Adds a reverse rate constant object with a Calculate(conditions) method for a specific representation prefix
+    template<typename ConstantType>
+      requires requires(const ConstantType& constant, const micm::Conditions& conditions) { constant.Calculate(conditions); }
     DissolvedReversibleReactionBuilder& AddReverseRateConstant(
         const std::string& prefix,
-        const micm::ArrheniusRateConstantParameters& params)
+        const ConstantType& reverse_rate_constant)
+    {
+      reverse_rate_constants_.insert_or_assign(prefix, ToRateConstant(reverse_rate_constant));
+      return *this;
+    }
+
+    /// @brief Adds one reverse rate constant for several representation prefixes
+    /// @details See the forward overload
+    DissolvedReversibleReactionBuilder& AddReverseRateConstant(
+        const std::set<std::string>& prefixes,
+        const RateConstant& reverse_rate_constant)
     {
-      reverse_rate_constants_[prefix] = [params](const micm::Conditions& conditions)
-      { return micm::CalculateArrhenius(params, conditions.temperature_, conditions.pressure_); };
+      for (const auto& prefix : prefixes)
+        reverse_rate_constants_.insert_or_assign(prefix, reverse_rate_constant);
       return *this;
     }
 
+    /// @brief Adds one reverse rate constant object with a Calculate(conditions) method for several representation prefixes
+    template<typename ConstantType>
+      requires requires(const ConstantType& constant, const micm::Conditions& conditions) { constant.Calculate(conditions); }
+    DissolvedReversibleReactionBuilder& AddReverseRateConstant(
+        const std::set<std::string>& prefixes,
+        const ConstantType& reverse_rate_constant)
+    {
+      return AddReverseRateConstant(prefixes, ToRateConstant(reverse_rate_constant));
+    }
+
     /// @brief Sets the (shared) equilibrium constant function
     DissolvedReversibleReactionBuilder& SetEquilibriumConstant(const auto& equilibrium_constant)
     {
@@ -164,9 +213,12 @@ namespace miam
 
       // For each prefix, require exactly two of {forward, reverse, equilibrium} and derive the third.
       // The equilibrium constant is shared across all prefixes.
-      std::map<std::string, std::function<double(const micm::Conditions&)>> forward = forward_rate_constants_;
-      std::map<std::string, std::function<double(const micm::Conditions&)>> reverse = reverse_rate_constants_;
+      std::map<std::string, RateConstant> forward = forward_rate_constants_;
+      std::map<std::string, RateConstant> reverse = reverse_rate_constants_;
       const bool has_eq = static_cast<bool>(equilibrium_constant_);
+      // Derived constants are reused for equal source constants so that the reaction can share their parameters
+      std::vector<std::pair<RateConstant, RateConstant>> derived_forward;
+      std::vector<std::pair<RateConstant, RateConstant>> derived_reverse;
       for (const auto& prefix : prefixes)
       {
         const bool has_fwd = forward.count(prefix) > 0;
@@ -183,19 +235,9 @@ namespace miam
         if (has_eq)
         {
           if (!has_fwd)
-          {
-            auto eq_const = equilibrium_constant_;
-            auto rev_const = reverse.at(prefix);
-            forward[prefix] = [eq_const, rev_const](const micm::Conditions& conditions)
-            { return eq_const(conditions) * rev_const(conditions); };
-          }
+            forward.insert_or_assign(prefix, Derive(derived_forward, reverse.at(prefix), true));
           else if (!has_rev)
-          {
-            auto eq_const = equilibrium_constant_;
-            auto fwd_const = forward.at(prefix);
-            reverse[prefix] = [eq_const, fwd_const](const micm::Conditions& conditions)
-            { return fwd_const(conditions) / eq_const(conditions); };
-          }
+            reverse.insert_or_assign(prefix, Derive(derived_reverse, forward.at(prefix), false));
         }
       }
 
@@ -209,12 +251,45 @@ namespace miam
     std::vector<micm::Species> products_;   ///< Product species
     micm::Species solvent_;                 ///< Solvent species
     bool solvent_is_set_ = false;           ///< Flag to track if the solvent has been set
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        forward_rate_constants_;  ///< Per-prefix forward rate constant functions
-    std::map<std::string, std::function<double(const micm::Conditions& conditions)>>
-        reverse_rate_constants_;  ///< Per-prefix reverse rate constant functions
+    std::map<std::string, RateConstant> forward_rate_constants_;  ///< Per-prefix forward rate constants
+    std::map<std::string, RateConstant> reverse_rate_constants_;  ///< Per-prefix reverse rate constants
     std::function<double(const micm::Conditions& conditions)>
         equilibrium_constant_;         ///< Shared equilibrium constant function (representation-independent)
     double solvent_floor_{ 1.0e-20 };  ///< Floor δ [mol m⁻³] added to [S] in ([S]+δ)^n denominator; see SetSolventFloor()
+
+    /// @brief Returns the rate constant derived from a source constant and the equilibrium constant
+    /// @param derived Previously derived (source, result) pairs; a new pair is appended on a miss
+    /// @param source Reverse rate constant when deriving k_f = K_eq · k_r, forward rate constant when deriving
+    ///        k_r = k_f / K_eq
+    /// @param is_forward Whether the forward rate constant is derived
+    RateConstant Derive(
+        std::vector<std::pair<RateConstant, RateConstant>>& derived,
+        const RateConstant& source,
+        bool is_forward) const
+    {
+      for (const auto& [known_source, result] : derived)
+        if (known_source == source)
+          return result;
+      auto eq_const = equilibrium_constant_;
+      RateConstant result =
+          is_forward ? RateConstant([eq_const, source](const micm::Conditions& conditions)
+                                    { return eq_const(conditions) * source(conditions); })
+                     : RateConstant([eq_const, source](const micm::Conditions& conditions)
+                                    { return source(conditions) / eq_const(conditions); });
+      derived.emplace_back(source, result);
+      return result;
+    }
+
+    /// @brief Converts a constant object to a RateConstant, keeping the closed form when one exists
+    template<typename ConstantType>
+    static RateConstant ToRateConstant(const ConstantType& constant)
+    {
+      if constexpr (std::is_same_v<ConstantType, EquilibriumConstant>)
+      {
+        if (!constant.Table())
+          return VantHoffParameters{ constant.parameters_.A_, constant.parameters_.C_, constant.parameters_.T0_ };
+      }
+      return [constant](const micm::Conditions& conditions) { return constant.Calculate(conditions); };
+    }
   };
 }  // namespace miam
@@ -5,8 +5,10 @@
 
 #include <miam/math/condensation_rate.hpp>
 #include <miam/representations/aerosol_property.hpp>
+#include <miam/representations/aerosol_property_cache.hpp>
 #include <miam/util/error.hpp>
 #include <miam/util/miam_exception.hpp>
+#include <miam/util/sparsity_pattern.hpp>
 #include <miam/util/uuid.hpp>
 
 #include <micm/system/conditions.hpp>
@@ -15,9 +17,11 @@
 #include <micm/util/constants.hpp>
 #include <micm/util/matrix.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -35,6 +39,11 @@ namespace miam
   ///
   ///          where k_evap = k_cond / (HLC · R · T), f_v = [solvent] · solvent_molecular_weight / solvent_density  [m³
   ///          mol⁻¹], and φ_p is the phase volume fraction.
+  ///
+  ///          Each phase instance has two state parameters derived from the conditions alone: the mean
+  ///          free path λ of the gas molecules and HLC · R · T. They are evaluated once per grid cell by
+  ///          UpdateStateParametersFunction, so the forcing and Jacobian kernels evaluate only the
+  ///          state-dependent terms.
   class HenryLawPhaseTransfer
   {
    public:
@@ -103,8 +112,8 @@ namespace miam
       {
         for (const auto& prefix : it->second)
         {
-          names.insert(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".hlc");
-          names.insert(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".temperature");
+          names.insert(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".mean_free_path");
+          names.insert(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".hlc_rt");
         }
       }
       return names;
@@ -150,7 +159,47 @@ namespace miam
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const std::unordered_map<std::string, std::size_t>& state_variable_indices) const
     {
-      std::set<std::pair<std::size_t, std::size_t>> elements;
+      SparsityPattern elements;
+      AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements);
+      return elements.ToSet();
+    }
+
+    /// @brief Appends non-zero Jacobian element positions to a sparsity pattern
+    void AppendNonZeroJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        SparsityPattern& elements) const
+    {
+      AppendDirectNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements);
+      std::size_t gas_idx = state_variable_indices.at(gas_species_.name_);
+
+      // We need provider-dependent indices, but at this stage we don't have providers yet.
+      // Conservatively include all variables in each representation prefix as potential
+      // indirect dependencies (through EffectiveRadius, NumberConcentration, PhaseVolumeFraction).
+      for (const auto& prefix : phase_prefixes.at(condensed_phase_.name_))
+      {
+        std::size_t aq_idx =
+            state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + condensed_species_.name_);
+        std::string prefix_dot = prefix + ".";
+        for (const auto& [var_name, var_idx] : state_variable_indices)
+        {
+          if (var_name.compare(0, prefix_dot.size(), prefix_dot) == 0)
+          {
+            elements.Add(gas_idx, var_idx);
+            elements.Add(aq_idx, var_idx);
+          }
+        }
+      }
+    }
+
+    /// @brief Appends the Jacobian element positions of the direct gas, solute and solvent dependencies
+    /// @details These are all the elements when the aerosol properties are frozen
+    ///          (ModelOptions::frozen_aerosol_properties_) and so do not depend on the state variables.
+    void AppendDirectNonZeroJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        SparsityPattern& elements) const
+    {
       auto gas_it = state_variable_indices.find(gas_species_.name_);
       if (gas_it == state_variable_indices.end())
         throw MiamException(
@@ -168,35 +217,18 @@ namespace miam
             "Internal Error: Phase " + condensed_phase_.name_ + " not found in phase_prefixes for process " + uuid_);
       }
 
-      // We need provider-dependent indices, but at this stage we don't have providers yet.
-      // Conservatively include all variables in each representation prefix as potential
-      // indirect dependencies (through EffectiveRadius, NumberConcentration, PhaseVolumeFraction).
       for (const auto& prefix : phase_it->second)
       {
         std::size_t aq_idx =
             state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + condensed_species_.name_);
         std::size_t solvent_idx = state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + solvent_.name_);
-
-        // Direct dependencies
-        elements.insert({ gas_idx, gas_idx });
-        elements.insert({ gas_idx, aq_idx });
-        elements.insert({ gas_idx, solvent_idx });
-        elements.insert({ aq_idx, gas_idx });
-        elements.insert({ aq_idx, aq_idx });
-        elements.insert({ aq_idx, solvent_idx });
-
-        // Indirect dependencies: any variable under this prefix may affect aerosol properties
-        std::string prefix_dot = prefix + ".";
-        for (const auto& [var_name, var_idx] : state_variable_indices)
-        {
-          if (var_name.substr(0, prefix_dot.size()) == prefix_dot)
-          {
-            elements.insert({ gas_idx, var_idx });
-            elements.insert({ aq_idx, var_idx });
-          }
-        }
+        elements.Add(gas_idx, gas_idx);
+        elements.Add(gas_idx, aq_idx);
+        elements.Add(gas_idx, solvent_idx);
+        elements.Add(aq_idx, gas_idx);
+        elements.Add(aq_idx, aq_idx);
+        elements.Add(aq_idx, solvent_idx);
       }
-      return elements;
     }
 
     /// @brief Returns non-zero Jacobian elements (common interface overload with providers)
@@ -206,7 +238,20 @@ namespace miam
         const std::unordered_map<std::string, std::size_t>& state_variable_indices,
         const std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>& providers) const
     {
-      auto elements = NonZeroJacobianElements(phase_prefixes, state_variable_indices);
+      SparsityPattern elements;
+      AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, providers, elements);
+      return elements.ToSet();
+    }
+
+    /// @brief Appends non-zero Jacobian element positions, including provider dependencies, to a sparsity pattern
+    template<typename DenseMatrixPolicy>
+    void AppendNonZeroJacobianElements(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::unordered_map<std::string, std::size_t>& state_variable_indices,
+        const std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>& providers,
+        SparsityPattern& elements) const
+    {
+      AppendNonZeroJacobianElements(phase_prefixes, state_variable_indices, elements);
       auto gas_idx = state_variable_indices.at(gas_species_.name_);
 
       // Add indirect dependencies through aerosol property providers
@@ -219,61 +264,53 @@ namespace miam
         {
           for (std::size_t var_j : provider.dependent_variable_indices)
           {
-            elements.insert({ gas_idx, var_j });
-            elements.insert({ aq_idx, var_j });
+            elements.Add(gas_idx, var_j);
+            elements.Add(aq_idx, var_j);
           }
         }
       }
-      return elements;
     }
 
-    /// @brief Returns a function that updates state parameters (HLC and temperature)
+    /// @brief Returns a function that updates state parameters (mean free path and HLC·R·T)
     template<typename DenseMatrixPolicy>
     std::function<void(const std::vector<micm::Conditions>&, DenseMatrixPolicy&)> UpdateStateParametersFunction(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
         const auto& state_parameter_indices) const
     {
-      std::vector<std::size_t> hlc_indices;
-      std::vector<std::size_t> temp_indices;
+      std::vector<std::size_t> mean_free_path_indices;
+      std::vector<std::size_t> hlc_rt_indices;
       auto it = phase_prefixes.find(condensed_phase_.name_);
       if (it != phase_prefixes.end())
       {
         for (const auto& prefix : it->second)
         {
-          std::string hlc_param = prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".hlc";
-          std::string temp_param = prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".temperature";
-          if (state_parameter_indices.find(hlc_param) == state_parameter_indices.end())
-            throw MiamException(
-                MIAM_ERROR_CATEGORY_INTERNAL,
-                MIAM_INTERNAL_MISSING_STATE_PARAMETER,
-                "Internal Error: HLC parameter " + hlc_param + " not found");
-          if (state_parameter_indices.find(temp_param) == state_parameter_indices.end())
-            throw MiamException(
-                MIAM_ERROR_CATEGORY_INTERNAL,
-                MIAM_INTERNAL_MISSING_STATE_PARAMETER,
-                "Internal Error: Temperature parameter " + temp_param + " not found");
-          hlc_indices.push_back(state_parameter_indices.at(hlc_param));
-          temp_indices.push_back(state_parameter_indices.at(temp_param));
+          std::string param_prefix = prefix + "." + condensed_phase_.name_ + "." + uuid_;
+          mean_free_path_indices.push_back(
+              ParameterIndex(state_parameter_indices, param_prefix + ".mean_free_path", "Mean free path"));
+          hlc_rt_indices.push_back(ParameterIndex(state_parameter_indices, param_prefix + ".hlc_rt", "HLC·R·T"));
         }
       }
+      const FuchsSutuginKernel cond_rate_kernel =
+          MakeFuchsSutuginKernel(diffusion_coefficient_, accommodation_coefficient_, gas_molecular_weight_);
 
       DenseMatrixPolicy dummy{ 1, state_parameter_indices.size(), 0.0 };
       std::vector<micm::Conditions> dummy_conditions;
 
       return DenseMatrixPolicy::Function(
-          [this, hlc_indices, temp_indices](auto&& conditions, auto&& params)
+          [this, mean_free_path_indices, hlc_rt_indices, cond_rate_kernel](auto&& conditions, auto&& params)
           {
-            for (std::size_t i = 0; i < hlc_indices.size(); ++i)
+            for (std::size_t i = 0; i < mean_free_path_indices.size(); ++i)
             {
               params.ForEachRow(
-                  [&](const micm::Conditions& cond, double& hlc, double& T)
+                  [&](const micm::Conditions& cond, double& mean_free_path, double& hlc_rt)
                   {
-                    hlc = henry_law_constant_(cond);
-                    T = cond.temperature_;
+                    const double T = cond.temperature_;
+                    mean_free_path = cond_rate_kernel.MeanFreePath(T);
+                    hlc_rt = henry_law_constant_(cond) * micm::constants::GAS_CONSTANT * T;
                   },
                   conditions,
-                  params.GetColumnView(hlc_indices[i]),
-                  params.GetColumnView(temp_indices[i]));
+                  params.GetColumnView(mean_free_path_indices[i]),
+                  params.GetColumnView(hlc_rt_indices[i]));
             }
           },
           dummy_conditions,
@@ -281,6 +318,9 @@ namespace miam
     }
 
     /// @brief Returns a function that calculates the forcing terms (common interface with providers)
+    /// @details Builds a private AerosolPropertyCache for this process' representation instances and
+    ///          refreshes it on every call. Models share one cache across processes via the
+    ///          cache-based overload instead.
     template<typename DenseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ForcingFunction(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
@@ -288,149 +328,116 @@ namespace miam
         const auto& state_variable_indices,
         std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> providers) const
     {
-      auto gas_idx = state_variable_indices.at(gas_species_.name_);
-
-      struct InstanceData
+      auto cache = MakePropertyCache<DenseMatrixPolicy>(phase_prefixes, providers);
+      auto forcing_fn =
+          ForcingFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices, cache);
+      return [cache, forcing_fn](
+                 const DenseMatrixPolicy& state_parameters,
+                 const DenseMatrixPolicy& state_variables,
+                 DenseMatrixPolicy& forcing_terms)
       {
-        std::size_t aq_species_idx;
-        std::size_t solvent_species_idx;
-        std::size_t hlc_param_idx;
-        std::size_t temperature_param_idx;
-        double molar_volume;  ///< Solvent molar volume [m³ mol⁻¹] = solvent_molecular_weight / solvent_density
-        AerosolPropertyProvider<DenseMatrixPolicy> r_eff_provider;
-        AerosolPropertyProvider<DenseMatrixPolicy> N_provider;
-        AerosolPropertyProvider<DenseMatrixPolicy> phi_provider;
-        CondensationRateProvider cond_rate_provider;
+        cache->Update(state_parameters, state_variables);
+        forcing_fn(state_parameters, state_variables, forcing_terms);
       };
+    }
 
-      std::vector<InstanceData> instances;
-      auto my_phase_it = phase_prefixes.find(condensed_phase_.name_);
-      if (my_phase_it != phase_prefixes.end())
-      {
-        for (const auto& prefix : my_phase_it->second)
-        {
-          auto prov_it = providers.find(prefix);
-          if (prov_it == providers.end())
-            continue;
-          const auto& prov_map = prov_it->second;
-          InstanceData inst;
-          inst.aq_species_idx =
-              state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + condensed_species_.name_);
-          inst.solvent_species_idx = state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + solvent_.name_);
-          inst.hlc_param_idx = state_parameter_indices.at(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".hlc");
-          inst.temperature_param_idx =
-              state_parameter_indices.at(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".temperature");
-          inst.molar_volume = solvent_molecular_weight_ / solvent_density_;
-          inst.r_eff_provider = prov_map.at(AerosolProperty::EffectiveRadius);
-          inst.N_provider = prov_map.at(AerosolProperty::NumberConcentration);
-          inst.phi_provider = prov_map.at(AerosolProperty::PhaseVolumeFraction);
-          inst.cond_rate_provider =
-              MakeCondensationRateProvider(diffusion_coefficient_, accommodation_coefficient_, gas_molecular_weight_);
-          instances.push_back(std::move(inst));
-        }
-      }
+    /// @brief Returns a function that calculates the forcing terms from a shared aerosol property cache
+    /// @details The caller is responsible for calling cache->Update() before each invocation.
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ForcingFunction(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const std::shared_ptr<AerosolPropertyCache<DenseMatrixPolicy>>& cache) const
+    {
+      auto gas_idx = state_variable_indices.at(gas_species_.name_);
+      auto instances = InstanceIndexTable(phase_prefixes, state_parameter_indices, state_variable_indices, *cache);
+      if (instances.NumRows() == 0)
+        return [](const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&) {};
+
+      // Process-level constants shared by all instances
+      const double molar_volume = solvent_molecular_weight_ / solvent_density_;
+      const FuchsSutuginKernel cond_rate_kernel =
+          MakeFuchsSutuginKernel(diffusion_coefficient_, accommodation_coefficient_, gas_molecular_weight_);
 
-      // Create Function-wrapped inner loops — one per instance, built at setup time.
       DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_buf{ 1, 1, 0.0 };
-
-      using InnerFuncType = std::function<void(
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&)>;
-      std::vector<InnerFuncType> inner_functions;
-
-      for (const auto& inst : instances)
-      {
-        auto inner = DenseMatrixPolicy::Function(
-            [inst, gas_idx](
-                auto&& state_parameters,
-                auto&& state_variables,
-                auto&& forcing_terms,
-                auto&& r_eff_view,
-                auto&& N_view,
-                auto&& phi_view)
+      DenseMatrixPolicy dummy_property_values{ 1, std::max(cache->Size(), std::size_t(1)), 0.0 };
+      DenseMatrixPolicy dummy_workspace{ 1, 1, 0.0 };
+
+      // One kernel walks all instances; the gas-phase tendency is accumulated in a workspace column and
+      // written to the forcing once, instead of once per instance. The workspace is owned by the returned
+      // function and sized on the first call, so steady-state calls do not allocate.
+      auto forcing_fn = DenseMatrixPolicy::Function(
+          [instances, gas_idx, molar_volume, cond_rate_kernel](
+              auto&& state_parameters,
+              auto&& state_variables,
+              auto&& forcing_terms,
+              auto&& property_values,
+              auto&& workspace)
+          {
+            auto gas_tendency = workspace.GetColumnView(0);
+            forcing_terms.ForEachRow([](double& tendency) { tendency = 0.0; }, gas_tendency);
+            for (std::size_t i = 0; i < instances.NumRows(); ++i)
             {
-              auto net = forcing_terms.GetRowVariable();
-
-              // Compute net transfer rate
+              // Compute the net transfer rate and apply it to the aq forcing and the gas accumulator
               state_parameters.ForEachRow(
-                  [&inst](
-                      const double& r_eff,
+                  [&](const double& r_eff,
                       const double& N,
                       const double& phi,
-                      const double& hlc,
-                      const double& T,
+                      const double& mean_free_path,
+                      const double& hlc_rt,
                       const double& gas,
                       const double& aq,
                       const double& solvent,
-                      double& net_val)
+                      double& f_aq,
+                      double& tendency)
                   {
-                    double kc = inst.cond_rate_provider.ComputeValue(r_eff, N, T);
+                    double kc = cond_rate_kernel.ComputeValueFromMeanFreePath(r_eff, N, mean_free_path);
                     double kc_eff = phi * kc;
-                    double ke_eff = kc_eff / (hlc * micm::constants::GAS_CONSTANT * T);
-                    double fv = solvent * inst.molar_volume;
-                    net_val = kc_eff * gas - ke_eff * aq / fv;
+                    double ke_eff = kc_eff / hlc_rt;
+                    double fv = solvent * molar_volume;
+                    double net = kc_eff * gas - ke_eff * aq / fv;
+                    tendency -= net;
+                    f_aq += net;
                   },
-                  r_eff_view.GetConstColumnView(0),
-                  N_view.GetConstColumnView(0),
-                  phi_view.GetConstColumnView(0),
-                  state_parameters.GetConstColumnView(inst.hlc_param_idx),
-                  state_parameters.GetConstColumnView(inst.temperature_param_idx),
+                  property_values.GetConstColumnView(instances[i][kEffectiveRadiusSlot]),
+                  property_values.GetConstColumnView(instances[i][kNumberConcentrationSlot]),
+                  property_values.GetConstColumnView(instances[i][kPhaseVolumeFractionSlot]),
+                  state_parameters.GetConstColumnView(instances[i][kMeanFreePathSlot]),
+                  state_parameters.GetConstColumnView(instances[i][kHlcRTSlot]),
                   state_variables.GetConstColumnView(gas_idx),
-                  state_variables.GetConstColumnView(inst.aq_species_idx),
-                  state_variables.GetConstColumnView(inst.solvent_species_idx),
-                  net);
-
-              // Apply to gas forcing (subtract)
-              state_parameters.ForEachRow(
-                  [](const double& net_val, double& f_gas) { f_gas -= net_val; }, net, forcing_terms.GetColumnView(gas_idx));
-
-              // Apply to aq forcing (add)
-              state_parameters.ForEachRow(
-                  [](const double& net_val, double& f_aq) { f_aq += net_val; },
-                  net,
-                  forcing_terms.GetColumnView(inst.aq_species_idx));
-            },
-            dummy_state_parameters,
-            dummy_state_variables,
-            dummy_state_variables,
-            dummy_buf,
-            dummy_buf,
-            dummy_buf);
-        inner_functions.push_back(std::move(inner));
-      }
-
-      return [instances = std::move(instances), inner_functions = std::move(inner_functions)](
+                  state_variables.GetConstColumnView(instances[i][kAqueousSlot]),
+                  state_variables.GetConstColumnView(instances[i][kSolventSlot]),
+                  forcing_terms.GetColumnView(instances[i][kAqueousSlot]),
+                  gas_tendency);
+            }
+            forcing_terms.ForEachRow(
+                [](const double& tendency, double& f_gas) { f_gas += tendency; },
+                gas_tendency,
+                forcing_terms.GetColumnView(gas_idx));
+          },
+          dummy_state_parameters,
+          dummy_state_variables,
+          dummy_state_variables,
+          dummy_property_values,
+          dummy_workspace);
+
+      auto workspace = std::make_shared<DenseMatrixPolicy>(dummy_workspace);
+      return [forcing_fn, cache, workspace](
                  const DenseMatrixPolicy& state_parameters,
                  const DenseMatrixPolicy& state_variables,
                  DenseMatrixPolicy& forcing_terms)
       {
-        std::size_t num_rows = state_parameters.NumRows();
-
-        for (std::size_t i = 0; i < instances.size(); ++i)
-        {
-          const auto& inst = instances[i];
-
-          // Pre-compute aerosol properties into temp buffers (full-matrix calls)
-          DenseMatrixPolicy r_eff_buf{ num_rows, 1, 0.0 };
-          DenseMatrixPolicy N_buf{ num_rows, 1, 0.0 };
-          DenseMatrixPolicy phi_buf{ num_rows, 1, 0.0 };
-          inst.r_eff_provider.ComputeValue(state_parameters, state_variables, r_eff_buf);
-          inst.N_provider.ComputeValue(state_parameters, state_variables, N_buf);
-          inst.phi_provider.ComputeValue(state_parameters, state_variables, phi_buf);
-
-          // Call the Function-wrapped inner loop with actual data
-          inner_functions[i](state_parameters, state_variables, forcing_terms, r_eff_buf, N_buf, phi_buf);
-        }
+        if (workspace->NumRows() != state_variables.NumRows())
+          *workspace = DenseMatrixPolicy{ state_variables.NumRows(), 1, 0.0 };
+        forcing_fn(state_parameters, state_variables, forcing_terms, cache->PackedValues(), *workspace);
       };
     }
 
     /// @brief Returns a function that calculates Jacobian contributions (common interface with providers)
+    /// @details Builds a private AerosolPropertyCache for this process' representation instances and
+    ///          refreshes it (values and partials) on every call.
     template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
         const std::map<std::string, std::set<std::string>>& phase_prefixes,
@@ -438,127 +445,128 @@ namespace miam
         const auto& state_variable_indices,
         const SparseMatrixPolicy& jacobian,
         std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> providers) const
+    {
+      auto cache = MakePropertyCache<DenseMatrixPolicy>(phase_prefixes, providers);
+      auto jacobian_fn = JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+          phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, cache);
+      return [cache, jacobian_fn](
+                 const DenseMatrixPolicy& state_parameters,
+                 const DenseMatrixPolicy& state_variables,
+                 SparseMatrixPolicy& jacobian_values)
+      {
+        cache->UpdateWithPartials(state_parameters, state_variables);
+        jacobian_fn(state_parameters, state_variables, jacobian_values);
+      };
+    }
+
+    /// @brief Returns a function that calculates Jacobian contributions from a shared aerosol property cache
+    /// @details The caller is responsible for calling cache->UpdateWithPartials() before each invocation.
+    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> JacobianFunction(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const SparseMatrixPolicy& jacobian,
+        const std::shared_ptr<AerosolPropertyCache<DenseMatrixPolicy>>& cache) const
     {
       auto gas_idx = state_variable_indices.at(gas_species_.name_);
+      auto instances = InstanceIndexTable(phase_prefixes, state_parameter_indices, state_variable_indices, *cache);
+      if (instances.NumRows() == 0)
+        return [](const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&) {};
 
-      struct InstanceData
+      // Process-level constants shared by all instances
+      const double molar_volume = solvent_molecular_weight_ / solvent_density_;
+      const FuchsSutuginKernel cond_rate_kernel =
+          MakeFuchsSutuginKernel(diffusion_coefficient_, accommodation_coefficient_, gas_molecular_weight_);
+
+      /// Partials layout of one cached property: general partials columns, then one factor column per scaled group
+      struct PropertyDependencies
+      {
+        std::size_t offset;                             ///< First packed partials column of the property
+        std::size_t n_general;                          ///< Number of general partials columns
+        std::vector<std::vector<double>> coefficients;  ///< Constant coefficients of each scaled group
+      };
+      struct InstanceDependencies
       {
-        std::size_t aq_species_idx;
-        std::size_t solvent_species_idx;
-        std::size_t hlc_param_idx;
-        std::size_t temperature_param_idx;
-        double molar_volume;  ///< Solvent molar volume [m³ mol⁻¹] = solvent_molecular_weight / solvent_density
-        AerosolPropertyProvider<DenseMatrixPolicy> r_eff_provider;
-        AerosolPropertyProvider<DenseMatrixPolicy> N_provider;
-        AerosolPropertyProvider<DenseMatrixPolicy> phi_provider;
-        CondensationRateProvider cond_rate_provider;
-        std::size_t n_r_eff_deps;
-        std::size_t n_N_deps;
-        std::size_t n_phi_deps;
-        // Jacobian indices stored in a flat Matrix<std::size_t> (1 x N) for use with GetBlockView via *jac_id++
-        // Layout: [6 direct] [2*n_r_eff_deps indirect_r_eff] [2*n_N_deps indirect_N] [2*n_phi_deps indirect_phi]
-        micm::Matrix<std::size_t> jac_indices;
+        PropertyDependencies r_eff;  ///< Effective radius
+        PropertyDependencies N;      ///< Number concentration
+        PropertyDependencies phi;    ///< Phase volume fraction
       };
 
-      std::vector<InstanceData> jac_instances;
-      auto my_jac_phase_it = phase_prefixes.find(condensed_phase_.name_);
-      if (my_jac_phase_it != phase_prefixes.end())
+      // Jacobian indices of all instances stored in one flat Matrix<std::size_t> (1 x N) and read in
+      // order via *jac_id++. Per instance: [6 direct] then, for r_eff, N and phi in turn, a (gas, aq) pair
+      // for each general dependent followed by a pair for each dependent of each scaled group
+      std::vector<InstanceDependencies> dependencies;
+      std::vector<std::size_t> flat_jac_indices;
+      for (std::size_t i = 0; i < instances.NumRows(); ++i)
       {
-        for (const auto& prefix : my_jac_phase_it->second)
+        const std::size_t aq_idx = instances[i][kAqueousSlot];
+        const std::size_t solvent_idx = instances[i][kSolventSlot];
+        auto property_dependencies = [&](std::size_t entry)
         {
-          auto prov_it = providers.find(prefix);
-          if (prov_it == providers.end())
-            continue;
-          const auto& prov_map = prov_it->second;
-          InstanceData inst;
-          inst.aq_species_idx =
-              state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + condensed_species_.name_);
-          inst.solvent_species_idx = state_variable_indices.at(prefix + "." + condensed_phase_.name_ + "." + solvent_.name_);
-          inst.hlc_param_idx = state_parameter_indices.at(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".hlc");
-          inst.temperature_param_idx =
-              state_parameter_indices.at(prefix + "." + condensed_phase_.name_ + "." + uuid_ + ".temperature");
-          inst.molar_volume = solvent_molecular_weight_ / solvent_density_;
-          inst.r_eff_provider = prov_map.at(AerosolProperty::EffectiveRadius);
-          inst.N_provider = prov_map.at(AerosolProperty::NumberConcentration);
-          inst.phi_provider = prov_map.at(AerosolProperty::PhaseVolumeFraction);
-          inst.cond_rate_provider =
-              MakeCondensationRateProvider(diffusion_coefficient_, accommodation_coefficient_, gas_molecular_weight_);
-          inst.n_r_eff_deps = prov_map.at(AerosolProperty::EffectiveRadius).dependent_variable_indices.size();
-          inst.n_N_deps = prov_map.at(AerosolProperty::NumberConcentration).dependent_variable_indices.size();
-          inst.n_phi_deps = prov_map.at(AerosolProperty::PhaseVolumeFraction).dependent_variable_indices.size();
-
-          std::size_t aq_idx = inst.aq_species_idx;
-          std::size_t solvent_idx = inst.solvent_species_idx;
-
-          // Build flat Jacobian index vector
-          std::size_t total_indices = 6 + 2 * inst.n_r_eff_deps + 2 * inst.n_N_deps + 2 * inst.n_phi_deps;
-          inst.jac_indices = micm::Matrix<std::size_t>(1, total_indices);
-          std::size_t idx = 0;
-
-          // Direct entries (6 total)
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, gas_idx);
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, aq_idx);
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, solvent_idx);
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, gas_idx);
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, aq_idx);
-          inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, solvent_idx);
-
-          // Indirect through r_eff
-          for (std::size_t var_j : prov_map.at(AerosolProperty::EffectiveRadius).dependent_variable_indices)
-          {
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, var_j);
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, var_j);
-          }
-          // Indirect through N
-          for (std::size_t var_j : prov_map.at(AerosolProperty::NumberConcentration).dependent_variable_indices)
-          {
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, var_j);
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, var_j);
-          }
-          // Indirect through phi
-          for (std::size_t var_j : prov_map.at(AerosolProperty::PhaseVolumeFraction).dependent_variable_indices)
+          PropertyDependencies property{ cache->PartialsOffset(entry), cache->GeneralDependents(entry).size(), {} };
+          for (const auto& group : cache->ScaledPartialGroups(entry))
+            property.coefficients.push_back(group.coefficients_);
+          return property;
+        };
+        dependencies.push_back(InstanceDependencies{ property_dependencies(instances[i][kEffectiveRadiusSlot]),
+                                                     property_dependencies(instances[i][kNumberConcentrationSlot]),
+                                                     property_dependencies(instances[i][kPhaseVolumeFractionSlot]) });
+
+        // Direct entries (6 total)
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, gas_idx, gas_idx));
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, gas_idx, aq_idx));
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, gas_idx, solvent_idx));
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, aq_idx, gas_idx));
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, aq_idx, aq_idx));
+        flat_jac_indices.push_back(jacobian.VectorIndex(0, aq_idx, solvent_idx));
+
+        // Indirect through r_eff, N and phi, in the order of their partials columns
+        for (auto slot : { kEffectiveRadiusSlot, kNumberConcentrationSlot, kPhaseVolumeFractionSlot })
+        {
+          const std::size_t entry = instances[i][slot];
+          const auto& deps = cache->DependentVariableIndices(entry);
+          auto add_pair = [&](std::size_t dependent)
           {
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, gas_idx, var_j);
-            inst.jac_indices[0][idx++] = jacobian.VectorIndex(0, aq_idx, var_j);
-          }
-
-          jac_instances.push_back(std::move(inst));
+            flat_jac_indices.push_back(jacobian.VectorIndex(0, gas_idx, deps[dependent]));
+            flat_jac_indices.push_back(jacobian.VectorIndex(0, aq_idx, deps[dependent]));
+          };
+          for (std::size_t dependent : cache->GeneralDependents(entry))
+            add_pair(dependent);
+          for (const auto& group : cache->ScaledPartialGroups(entry))
+            for (std::size_t dependent : group.dependents_)
+              add_pair(dependent);
         }
       }
+      micm::Matrix<std::size_t> jac_indices(1, flat_jac_indices.size());
+      std::copy(flat_jac_indices.begin(), flat_jac_indices.end(), jac_indices.AsVector().begin());
 
-      // Build Function-wrapped inner loops per instance
       DenseMatrixPolicy dummy_state_parameters{ 1, state_parameter_indices.size(), 0.0 };
       DenseMatrixPolicy dummy_state_variables{ 1, state_variable_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_buf{ 1, 1, 0.0 };
-      DenseMatrixPolicy dummy_partials{ 1, 1, 0.0 };
-
-      using InnerJacFuncType = std::function<void(
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          SparseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&,
-          const DenseMatrixPolicy&)>;
-      std::vector<InnerJacFuncType> inner_jac_functions;
-
-      for (const auto& inst : jac_instances)
-      {
-        inner_jac_functions.push_back(SparseMatrixPolicy::Function(
-            [inst, gas_idx](
-                auto&& state_parameters,
-                auto&& state_variables,
-                auto&& jacobian_values,
-                auto&& r_eff_view,
-                auto&& N_view,
-                auto&& phi_view,
-                auto&& r_eff_partials_view,
-                auto&& N_partials_view,
-                auto&& phi_partials_view)
+      DenseMatrixPolicy dummy_property_values{ 1, std::max(cache->Size(), std::size_t(1)), 0.0 };
+      DenseMatrixPolicy dummy_property_partials{ 1, std::max(cache->NumberOfPackedPartials(), std::size_t(1)), 0.0 };
+
+      // One kernel walks all instances, reading every property from the packed cache matrices
+      auto jacobian_fn = SparseMatrixPolicy::Function(
+          [instances, dependencies, jac_indices, gas_idx, molar_volume, cond_rate_kernel](
+              auto&& state_parameters,
+              auto&& state_variables,
+              auto&& jacobian_values,
+              auto&& property_values,
+              auto&& property_partials)
+          {
+            auto jac_id = jac_indices.AsVector().begin();
+            for (std::size_t i = 0; i < instances.NumRows(); ++i)
             {
-              auto jac_id = inst.jac_indices.AsVector().begin();
+              const auto& deps = dependencies[i];
+              auto r_eff_view = property_values.GetConstColumnView(instances[i][kEffectiveRadiusSlot]);
+              auto N_view = property_values.GetConstColumnView(instances[i][kNumberConcentrationSlot]);
+              auto phi_view = property_values.GetConstColumnView(instances[i][kPhaseVolumeFractionSlot]);
+              auto mean_free_path_view = state_parameters.GetConstColumnView(instances[i][kMeanFreePathSlot]);
+              auto hlc_rt_view = state_parameters.GetConstColumnView(instances[i][kHlcRTSlot]);
+              auto gas_view = state_variables.GetConstColumnView(gas_idx);
+              auto aq_view = state_variables.GetConstColumnView(instances[i][kAqueousSlot]);
+              auto solvent_view = state_variables.GetConstColumnView(instances[i][kSolventSlot]);
 
               // Pre-extract BlockViews sequentially to avoid unspecified argument evaluation order
               auto bv_gg = jacobian_values.GetBlockView(*jac_id++);
@@ -568,14 +576,20 @@ namespace miam
               auto bv_aa = jacobian_values.GetBlockView(*jac_id++);
               auto bv_as = jacobian_values.GetBlockView(*jac_id++);
 
-              // Read inputs and compute direct Jacobian entries
+              // Coefficients of the indirect entries: ∂(rate)/∂r_eff, ∂(rate)/∂N and ∂(rate)/∂φ
+              auto c_r_eff = jacobian_values.GetBlockVariable();
+              auto c_N = jacobian_values.GetBlockVariable();
+              auto c_phi = jacobian_values.GetBlockVariable();
+              auto c_scaled = jacobian_values.GetBlockVariable();
+
+              // Read inputs, evaluate the condensation rate and its partials once per cell (fused), and
+              // compute the direct Jacobian entries and the indirect-entry coefficients
               jacobian_values.ForEachBlock(
-                  [&inst](
-                      const double& r_eff,
+                  [&](const double& r_eff,
                       const double& N,
                       const double& phi,
-                      const double& hlc,
-                      const double& T,
+                      const double& mean_free_path,
+                      const double& hlc_rt,
                       const double& gas,
                       const double& aq,
                       const double& solvent,
@@ -584,11 +598,17 @@ namespace miam
                       double& j_gs,
                       double& j_ag,
                       double& j_aa,
-                      double& j_as)
+                      double& j_as,
+                      double& dr,
+                      double& dN,
+                      double& dphi)
                   {
-                    double kc = inst.cond_rate_provider.ComputeValue(r_eff, N, T);
-                    double ke = kc / (hlc * micm::constants::GAS_CONSTANT * T);
-                    double fv = solvent * inst.molar_volume;
+                    double kc, dk_dr, dk_dN;
+                    cond_rate_kernel.ComputeValueAndDerivativesFromMeanFreePath(r_eff, N, mean_free_path, kc, dk_dr, dk_dN);
+                    double ke = kc / hlc_rt;
+                    double fv = solvent * molar_volume;
+                    // ∂(k_cond·[gas] - k_evap·[aq]/f_v)/∂k_cond, with k_evap = k_cond / (H·R·T)
+                    double dR_dk = gas - aq / (fv * hlc_rt);
                     // -J[gas, gas] = +φ · k_cond
                     j_gg += phi * kc;
                     // -J[gas, aq] = -φ · k_evap / f_v
@@ -601,197 +621,171 @@ namespace miam
                     j_aa += phi * ke / fv;
                     // -J[aq, solvent] = -φ · k_evap · [aq] / (f_v · [solvent])
                     j_as -= phi * ke * aq / (fv * solvent);
+                    dr = phi * dk_dr * dR_dk;
+                    dN = phi * dk_dN * dR_dk;
+                    dphi = kc * gas - ke * aq / fv;
                   },
-                  r_eff_view.GetConstColumnView(0),
-                  N_view.GetConstColumnView(0),
-                  phi_view.GetConstColumnView(0),
-                  state_parameters.GetConstColumnView(inst.hlc_param_idx),
-                  state_parameters.GetConstColumnView(inst.temperature_param_idx),
-                  state_variables.GetConstColumnView(gas_idx),
-                  state_variables.GetConstColumnView(inst.aq_species_idx),
-                  state_variables.GetConstColumnView(inst.solvent_species_idx),
+                  r_eff_view,
+                  N_view,
+                  phi_view,
+                  mean_free_path_view,
+                  hlc_rt_view,
+                  gas_view,
+                  aq_view,
+                  solvent_view,
                   bv_gg,
                   bv_ga,
                   bv_gs,
                   bv_ag,
                   bv_aa,
-                  bv_as);
-
-              // Indirect entries through r_eff
-              for (std::size_t k = 0; k < inst.n_r_eff_deps; ++k)
-              {
-                auto bv_r_gas = jacobian_values.GetBlockView(*jac_id++);
-                auto bv_r_aq = jacobian_values.GetBlockView(*jac_id++);
-                jacobian_values.ForEachBlock(
-                    [&inst](
-                        const double& r_eff,
-                        const double& N,
-                        const double& phi,
-                        const double& hlc,
-                        const double& T,
-                        const double& gas,
-                        const double& aq,
-                        const double& solvent,
-                        const double& dr_dvar,
-                        double& j_gas,
-                        double& j_aq)
-                    {
-                      double kc_dummy, dk_dr, dk_dN_unused;
-                      inst.cond_rate_provider.ComputeValueAndDerivatives(r_eff, N, T, kc_dummy, dk_dr, dk_dN_unused);
-                      double dke_dr = dk_dr / (hlc * micm::constants::GAS_CONSTANT * T);
-                      double fv = solvent * inst.molar_volume;
-                      double eff = phi * (dk_dr * dr_dvar * gas - dke_dr * dr_dvar * aq / fv);
-                      j_gas += eff;
-                      j_aq -= eff;
-                    },
-                    r_eff_view.GetConstColumnView(0),
-                    N_view.GetConstColumnView(0),
-                    phi_view.GetConstColumnView(0),
-                    state_parameters.GetConstColumnView(inst.hlc_param_idx),
-                    state_parameters.GetConstColumnView(inst.temperature_param_idx),
-                    state_variables.GetConstColumnView(gas_idx),
-                    state_variables.GetConstColumnView(inst.aq_species_idx),
-                    state_variables.GetConstColumnView(inst.solvent_species_idx),
-                    r_eff_partials_view.GetConstColumnView(k),
-                    bv_r_gas,
-                    bv_r_aq);
-              }
-
-              // Indirect entries through N
-              for (std::size_t k = 0; k < inst.n_N_deps; ++k)
-              {
-                auto bv_N_gas = jacobian_values.GetBlockView(*jac_id++);
-                auto bv_N_aq = jacobian_values.GetBlockView(*jac_id++);
-                jacobian_values.ForEachBlock(
-                    [&inst](
-                        const double& r_eff,
-                        const double& N,
-                        const double& phi,
-                        const double& hlc,
-                        const double& T,
-                        const double& gas,
-                        const double& aq,
-                        const double& solvent,
-                        const double& dN_dvar,
-                        double& j_gas,
-                        double& j_aq)
-                    {
-                      double kc_dummy, dk_dr_unused, dk_dN;
-                      inst.cond_rate_provider.ComputeValueAndDerivatives(r_eff, N, T, kc_dummy, dk_dr_unused, dk_dN);
-                      double dke_dN = dk_dN / (hlc * micm::constants::GAS_CONSTANT * T);
-                      double fv = solvent * inst.molar_volume;
-                      double eff = phi * (dk_dN * dN_dvar * gas - dke_dN * dN_dvar * aq / fv);
-                      j_gas += eff;
-                      j_aq -= eff;
-                    },
-                    r_eff_view.GetConstColumnView(0),
-                    N_view.GetConstColumnView(0),
-                    phi_view.GetConstColumnView(0),
-                    state_parameters.GetConstColumnView(inst.hlc_param_idx),
-                    state_parameters.GetConstColumnView(inst.temperature_param_idx),
-                    state_variables.GetConstColumnView(gas_idx),
-                    state_variables.GetConstColumnView(inst.aq_species_idx),
-                    state_variables.GetConstColumnView(inst.solvent_species_idx),
-                    N_partials_view.GetConstColumnView(k),
-                    bv_N_gas,
-                    bv_N_aq);
-              }
-
-              // Indirect entries through φ_p (negated: MICM solver expects -J)
-              for (std::size_t k = 0; k < inst.n_phi_deps; ++k)
+                  bv_as,
+                  c_r_eff,
+                  c_N,
+                  c_phi);
+
+              // Indirect entries: -J[gas, var] = +c · ∂p/∂var and -J[aq, var] = -c · ∂p/∂var for each
+              // property p (r_eff, N, φ_p) with coefficient c and each variable var that p depends on
+              auto add_indirect = [&](auto& coefficient, const PropertyDependencies& property)
               {
-                auto bv_phi_gas = jacobian_values.GetBlockView(*jac_id++);
-                auto bv_phi_aq = jacobian_values.GetBlockView(*jac_id++);
-                jacobian_values.ForEachBlock(
-                    [&inst](
-                        const double& r_eff,
-                        const double& N,
-                        const double& phi,
-                        const double& hlc,
-                        const double& T,
-                        const double& gas,
-                        const double& aq,
-                        const double& solvent,
-                        const double& dphi_dvar,
-                        double& j_gas,
-                        double& j_aq)
-                    {
-                      double kc = inst.cond_rate_provider.ComputeValue(r_eff, N, T);
-                      double ke = kc / (hlc * micm::constants::GAS_CONSTANT * T);
-                      double fv = solvent * inst.molar_volume;
-                      double R = kc * gas - ke * aq / fv;
-                      j_gas += R * dphi_dvar;
-                      j_aq -= R * dphi_dvar;
-                    },
-                    r_eff_view.GetConstColumnView(0),
-                    N_view.GetConstColumnView(0),
-                    phi_view.GetConstColumnView(0),
-                    state_parameters.GetConstColumnView(inst.hlc_param_idx),
-                    state_parameters.GetConstColumnView(inst.temperature_param_idx),
-                    state_variables.GetConstColumnView(gas_idx),
-                    state_variables.GetConstColumnView(inst.aq_species_idx),
-                    state_variables.GetConstColumnView(inst.solvent_species_idx),
-                    phi_partials_view.GetConstColumnView(k),
-                    bv_phi_gas,
-                    bv_phi_aq);
-              }
-            },
-            dummy_state_parameters,
-            dummy_state_variables,
-            jacobian,
-            dummy_buf,
-            dummy_buf,
-            dummy_buf,
-            dummy_partials,
-            dummy_partials,
-            dummy_partials));
-      }
+                for (std::size_t k = 0; k < property.n_general; ++k)
+                {
+                  auto bv_gas = jacobian_values.GetBlockView(*jac_id++);
+                  auto bv_aq = jacobian_values.GetBlockView(*jac_id++);
+                  jacobian_values.ForEachBlock(
+                      [](const double& c, const double& dp_dvar, double& j_gas, double& j_aq)
+                      {
+                        j_gas += c * dp_dvar;
+                        j_aq -= c * dp_dvar;
+                      },
+                      coefficient,
+                      property_partials.GetConstColumnView(property.offset + k),
+                      bv_gas,
+                      bv_aq);
+                }
+                // Scaled groups (∂p/∂var_k = a_k · factor): the factor column is read once, and each
+                // dependent adds its constant multiple a_k of c · factor
+                for (std::size_t g = 0; g < property.coefficients.size(); ++g)
+                {
+                  jacobian_values.ForEachBlock(
+                      [](const double& c, const double& factor, double& c_factor) { c_factor = c * factor; },
+                      coefficient,
+                      property_partials.GetConstColumnView(property.offset + property.n_general + g),
+                      c_scaled);
+                  for (double a : property.coefficients[g])
+                  {
+                    auto bv_gas = jacobian_values.GetBlockView(*jac_id++);
+                    auto bv_aq = jacobian_values.GetBlockView(*jac_id++);
+                    jacobian_values.ForEachBlock(
+                        [a](const double& c_factor, double& j_gas, double& j_aq)
+                        {
+                          j_gas += a * c_factor;
+                          j_aq -= a * c_factor;
+                        },
+                        c_scaled,
+                        bv_gas,
+                        bv_aq);
+                  }
+                }
+              };
+              add_indirect(c_r_eff, deps.r_eff);
+              add_indirect(c_N, deps.N);
+              add_indirect(c_phi, deps.phi);
+            }
+          },
+          dummy_state_parameters,
+          dummy_state_variables,
+          jacobian,
+          dummy_property_values,
+          dummy_property_partials);
 
-      return [jac_instances = std::move(jac_instances), inner_jac_functions = std::move(inner_jac_functions), gas_idx](
+      return [jacobian_fn, cache](
                  const DenseMatrixPolicy& state_parameters,
                  const DenseMatrixPolicy& state_variables,
                  SparseMatrixPolicy& jacobian_matrix)
       {
-        std::size_t num_blocks = jacobian_matrix.NumberOfBlocks();
-
-        for (std::size_t i = 0; i < jac_instances.size(); ++i)
-        {
-          const auto& inst = jac_instances[i];
-
-          // Pre-compute aerosol properties (full-matrix calls)
-          DenseMatrixPolicy r_eff_buf{ num_blocks, 1, 0.0 };
-          DenseMatrixPolicy N_buf{ num_blocks, 1, 0.0 };
-          DenseMatrixPolicy phi_buf{ num_blocks, 1, 0.0 };
-          inst.r_eff_provider.ComputeValue(state_parameters, state_variables, r_eff_buf);
-          inst.N_provider.ComputeValue(state_parameters, state_variables, N_buf);
-          inst.phi_provider.ComputeValue(state_parameters, state_variables, phi_buf);
-
-          // Pre-compute partials
-          DenseMatrixPolicy r_eff_partials{ num_blocks, std::max(inst.n_r_eff_deps, std::size_t(1)), 0.0 };
-          if (inst.n_r_eff_deps > 0)
-            inst.r_eff_provider.ComputeValueAndDerivatives(state_parameters, state_variables, r_eff_buf, r_eff_partials);
-
-          DenseMatrixPolicy N_partials{ num_blocks, std::max(inst.n_N_deps, std::size_t(1)), 0.0 };
-          if (inst.n_N_deps > 0)
-            inst.N_provider.ComputeValueAndDerivatives(state_parameters, state_variables, N_buf, N_partials);
-
-          DenseMatrixPolicy phi_partials{ num_blocks, std::max(inst.n_phi_deps, std::size_t(1)), 0.0 };
-          if (inst.n_phi_deps > 0)
-            inst.phi_provider.ComputeValueAndDerivatives(state_parameters, state_variables, phi_buf, phi_partials);
-
-          // Call the Function-wrapped inner loop
-          inner_jac_functions[i](
-              state_parameters,
-              state_variables,
-              jacobian_matrix,
-              r_eff_buf,
-              N_buf,
-              phi_buf,
-              r_eff_partials,
-              N_partials,
-              phi_partials);
-        }
+        jacobian_fn(
+            state_parameters, state_variables, jacobian_matrix, cache->PackedValues(), cache->PackedPartials());
       };
     }
+
+   private:
+    /// @brief Columns of the [instance][slot] index table used by the instance-batched kernels
+    enum InstanceSlot : std::size_t
+    {
+      kAqueousSlot,                ///< State variable index of the condensed-phase species
+      kSolventSlot,                ///< State variable index of the solvent
+      kMeanFreePathSlot,           ///< State parameter index of the mean free path
+      kHlcRTSlot,                  ///< State parameter index of HLC·R·T
+      kEffectiveRadiusSlot,        ///< Cache entry of the effective radius
+      kNumberConcentrationSlot,    ///< Cache entry of the number concentration
+      kPhaseVolumeFractionSlot,    ///< Cache entry of the phase volume fraction
+      kNumberOfInstanceSlots
+    };
+
+    /// @brief Returns the index of a state parameter of this process
+    /// @throws MiamException if the parameter is not in the map
+    static std::size_t
+    ParameterIndex(const auto& state_parameter_indices, const std::string& name, const std::string& description)
+    {
+      auto it = state_parameter_indices.find(name);
+      if (it == state_parameter_indices.end())
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_INTERNAL,
+            MIAM_INTERNAL_MISSING_STATE_PARAMETER,
+            "Internal Error: " + description + " parameter " + name + " not found");
+      return it->second;
+    }
+
+    /// @brief Builds the [instance][slot] index table for every phase instance with cached properties
+    template<typename DenseMatrixPolicy>
+    micm::Matrix<std::size_t> InstanceIndexTable(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const AerosolPropertyCache<DenseMatrixPolicy>& cache) const
+    {
+      std::vector<std::string> prefixes;
+      auto phase_it = phase_prefixes.find(condensed_phase_.name_);
+      if (phase_it != phase_prefixes.end())
+        for (const auto& prefix : phase_it->second)
+          if (cache.Contains(prefix, AerosolProperty::EffectiveRadius))
+            prefixes.push_back(prefix);
+
+      micm::Matrix<std::size_t> table(prefixes.size(), kNumberOfInstanceSlots, 0);
+      for (std::size_t i = 0; i < prefixes.size(); ++i)
+      {
+        const std::string phase_prefix = prefixes[i] + "." + condensed_phase_.name_ + ".";
+        table[i][kAqueousSlot] = state_variable_indices.at(phase_prefix + condensed_species_.name_);
+        table[i][kSolventSlot] = state_variable_indices.at(phase_prefix + solvent_.name_);
+        table[i][kMeanFreePathSlot] = state_parameter_indices.at(phase_prefix + uuid_ + ".mean_free_path");
+        table[i][kHlcRTSlot] = state_parameter_indices.at(phase_prefix + uuid_ + ".hlc_rt");
+        table[i][kEffectiveRadiusSlot] = cache.Index(prefixes[i], AerosolProperty::EffectiveRadius);
+        table[i][kNumberConcentrationSlot] = cache.Index(prefixes[i], AerosolProperty::NumberConcentration);
+        table[i][kPhaseVolumeFractionSlot] = cache.Index(prefixes[i], AerosolProperty::PhaseVolumeFraction);
+      }
+      return table;
+    }
+
+    /// @brief Builds a property cache holding only the providers of this process' phase instances
+    template<typename DenseMatrixPolicy>
+    std::shared_ptr<AerosolPropertyCache<DenseMatrixPolicy>> MakePropertyCache(
+        const std::map<std::string, std::set<std::string>>& phase_prefixes,
+        const std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>& providers)
+        const
+    {
+      auto cache = std::make_shared<AerosolPropertyCache<DenseMatrixPolicy>>();
+      auto phase_it = phase_prefixes.find(condensed_phase_.name_);
+      if (phase_it == phase_prefixes.end())
+        return cache;
+      for (const auto& prefix : phase_it->second)
+      {
+        auto prov_it = providers.find(prefix);
+        if (prov_it == providers.end())
+          continue;
+        for (const auto& [property, provider] : prov_it->second)
+          cache->Add(prefix, property, provider);
+      }
+      return cache;
+    }
   };
 }  // namespace miam
@@ -0,0 +1,146 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/math/reaction_order.hpp>
+#include <miam/model/cell_blocks.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Flattened index table for a group of solvent-normalized mass-action terms
+  /// @details Each term represents one directional reaction in one phase instance:
+  ///          \f[
+  ///            r = k \cdot \frac{[S]}{([S] + \delta)^{n}} \prod_i [R_i]
+  ///          \f]
+  ///          where \f$ n \f$ is the number of reactants of the term. The rate is subtracted from
+  ///          each reactant and added to each product. Irreversible dissolved reactions append
+  ///          one term per phase instance; reversible reactions append a forward and a reverse
+  ///          term per phase instance.
+  ///
+  ///          Reactant and product indices of all terms are stored back-to-back in contiguous
+  ///          arrays (CSR-style offsets), so the whole group is evaluated by one function without
+  ///          any per-process indirect calls, in one pass over the grid cells like LinearConstraintSystem.
+  struct MassActionTerms
+  {
+    std::vector<std::size_t> rate_constant_indices_;  ///< State parameter index of k for each term
+    std::vector<std::size_t> solvent_indices_;        ///< State variable index of the solvent for each term
+    std::vector<double> solvent_floors_;              ///< Solvent floor δ for each term
+    std::vector<std::size_t> reactant_offsets_{ 0 };  ///< Offsets into reactant_indices_ (size = terms + 1)
+    std::vector<std::size_t> reactant_indices_;       ///< Flattened reactant state variable indices
+    std::vector<std::size_t> product_offsets_{ 0 };   ///< Offsets into product_indices_ (size = terms + 1)
+    std::vector<std::size_t> product_indices_;        ///< Flattened product state variable indices
+
+    /// @brief Returns the number of terms in the table
+    std::size_t Size() const
+    {
+      return rate_constant_indices_.size();
+    }
+
+    /// @brief Appends a single mass-action term
+    /// @param rate_constant_index State parameter index of the rate constant
+    /// @param solvent_index State variable index of the solvent
+    /// @param solvent_floor Solvent floor δ [mol m⁻³]
+    /// @param reactant_indices State variable indices of the reactants (define the rate)
+    /// @param product_indices State variable indices of the products
+    void AddTerm(
+        std::size_t rate_constant_index,
+        std::size_t solvent_index,
+        double solvent_floor,
+        const std::vector<std::size_t>& reactant_indices,
+        const std::vector<std::size_t>& product_indices)
+    {
+      rate_constant_indices_.push_back(rate_constant_index);
+      solvent_indices_.push_back(solvent_index);
+      solvent_floors_.push_back(solvent_floor);
+      reactant_indices_.insert(reactant_indices_.end(), reactant_indices.begin(), reactant_indices.end());
+      reactant_offsets_.push_back(reactant_indices_.size());
+      product_indices_.insert(product_indices_.end(), product_indices.begin(), product_indices.end());
+      product_offsets_.push_back(product_indices_.size());
+    }
+
+    /// @brief Returns a function that adds the forcing contributions of all terms to the forcing matrix
+    /// @details The cell groups of the matrices are the outer loop and the terms the inner one, so the
+    ///          state and forcing values of a cell group are read and written once per call however many
+    ///          terms use them; the loop over the cells of a group is innermost and contiguous. The
+    ///          reaction order of each term is dispatched once per term and group; for orders 1-3 the
+    ///          solvent-normalization power unrolls into multiplies (see ReactionOrderPower).
+    template<typename DenseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ForcingFunction() const
+    {
+      static_assert(CellGroupStorage<DenseMatrixPolicy>, "MassActionTerms requires the CellGroupStorage matrix layout");
+      RequireCellGroupLayout<DenseMatrixPolicy>("MassActionTerms");
+      return [terms = *this](
+                 const DenseMatrixPolicy& state_parameters,
+                 const DenseMatrixPolicy& state_variables,
+                 DenseMatrixPolicy& forcing_terms)
+      {
+        constexpr std::size_t L = CellGroupSize<DenseMatrixPolicy>();
+        const std::size_t parameter_stride = L * state_parameters.NumColumns();
+        const std::size_t variable_stride = L * state_variables.NumColumns();
+        const std::size_t number_of_groups = (state_variables.NumRows() + L - 1) / L;
+        std::array<double, L> rate;
+        for (std::size_t group = 0; group < number_of_groups; ++group)
+        {
+          const double* parameters = state_parameters.AsVector().data() + group * parameter_stride;
+          const double* variables = state_variables.AsVector().data() + group * variable_stride;
+          double* forcing = forcing_terms.AsVector().data() + group * variable_stride;
+          for (std::size_t i_term = 0; i_term < terms.Size(); ++i_term)
+          {
+            DispatchReactionOrder(
+                terms.reactant_offsets_[i_term + 1] - terms.reactant_offsets_[i_term],
+                [&](auto order)
+                { terms.template AddTermForcing<decltype(order)::value>(i_term, parameters, variables, forcing, rate); });
+          }
+        }
+      };
+    }
+
+   private:
+    /// @brief Adds the forcing contributions of one term to the L cells of one group
+    /// @tparam Order Number of reactants of the term, or kGenericReactionOrder
+    /// @param parameters First state parameter value of the cell group (flat storage)
+    /// @param variables First state variable value of the cell group (flat storage)
+    /// @param forcing First forcing value of the cell group (flat storage)
+    template<int Order, std::size_t L>
+    void AddTermForcing(
+        std::size_t i_term,
+        const double* parameters,
+        const double* variables,
+        double* forcing,
+        std::array<double, L>& rate) const
+    {
+      const double eps = solvent_floors_[i_term];
+      const std::size_t r_begin = reactant_offsets_[i_term];
+      const std::size_t n_r = reactant_offsets_[i_term + 1] - r_begin;
+      const std::size_t* reactants = reactant_indices_.data() + r_begin;
+      const double* rate_constant = parameters + rate_constant_indices_[i_term] * L;
+      const double* solvent = variables + solvent_indices_[i_term] * L;
+      for (std::size_t cell = 0; cell < L; ++cell)
+        rate[cell] = rate_constant[cell] * solvent[cell] / ReactionOrderPower<Order>(solvent[cell] + eps, n_r);
+      for (std::size_t r = 0; r < n_r; ++r)
+      {
+        const double* reactant = variables + reactants[r] * L;
+        for (std::size_t cell = 0; cell < L; ++cell)
+          rate[cell] *= reactant[cell];
+      }
+      for (std::size_t r = 0; r < n_r; ++r)
+      {
+        double* reactant_forcing = forcing + reactants[r] * L;
+        for (std::size_t cell = 0; cell < L; ++cell)
+          reactant_forcing[cell] -= rate[cell];
+      }
+      for (std::size_t i = product_offsets_[i_term]; i < product_offsets_[i_term + 1]; ++i)
+      {
+        double* product_forcing = forcing + product_indices_[i] * L;
+        for (std::size_t cell = 0; cell < L; ++cell)
+          product_forcing[cell] += rate[cell];
+      }
+    }
+  };
+}  // namespace miam
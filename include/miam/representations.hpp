@@ -4,6 +4,8 @@
 #pragma once
 
 #include <miam/representations/aerosol_property.hpp>
+#include <miam/representations/aerosol_property_cache.hpp>
+#include <miam/representations/sectional_distribution.hpp>
 #include <miam/representations/single_moment_mode.hpp>
 #include <miam/representations/two_moment_mode.hpp>
 #include <miam/representations/uniform_section.hpp>
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace miam
@@ -19,10 +20,59 @@ namespace miam
     PhaseVolumeFraction   // [dimensionless, 0-1]
   };
 
+  /// @brief Returns the name of an aerosol property (e.g. "EFFECTIVE_RADIUS")
+  inline std::string ToString(AerosolProperty property)
+  {
+    switch (property)
+    {
+      case AerosolProperty::EffectiveRadius: return "EFFECTIVE_RADIUS";
+      case AerosolProperty::NumberConcentration: return "NUMBER_CONCENTRATION";
+      case AerosolProperty::PhaseVolumeFraction: return "PHASE_VOLUME_FRACTION";
+    }
+    return "UNKNOWN";
+  }
+
+  /// @brief Returns the name of the state parameter that holds a frozen property of a representation instance
+  /// @details Used when ModelOptions::frozen_aerosol_properties_ is set (e.g. "CLOUD.EFFECTIVE_RADIUS")
+  inline std::string FrozenPropertyParameterName(const std::string& prefix, AerosolProperty property)
+  {
+    return prefix + "." + ToString(property);
+  }
+
+  /// @brief Dependent variables of a property whose partials are constant coefficients times one per-cell factor
+  /// @details ∂p/∂var[dependent_variable_indices[dependents_[k]]] = coefficients_[k] · factor, and the provider
+  ///          writes only the factor. Volume-based properties use this with the species molar volumes as
+  ///          coefficients, so a mode with many species writes one partials column instead of one per species.
+  struct ScaledPartials
+  {
+    std::vector<std::size_t> dependents_;  ///< Positions in dependent_variable_indices
+    std::vector<double> coefficients_;     ///< Constant coefficient of each dependent
+
+    /// @brief Creates a group of consecutive dependents starting at position `first`
+    static ScaledPartials Consecutive(std::size_t first, std::vector<double> coefficients)
+    {
+      ScaledPartials group;
+      for (std::size_t k = 0; k < coefficients.size(); ++k)
+        group.dependents_.push_back(first + k);
+      group.coefficients_ = std::move(coefficients);
+      return group;
+    }
+  };
+
+  /// @brief Columns of the value and partials matrices that a provider's functions write
+  struct PropertyColumns
+  {
+    std::size_t value_{ 0 };     ///< Column of the property value
+    std::size_t partials_{ 0 };  ///< First of the NumberOfPartialsColumns() partials columns
+  };
+
   /// @brief A provider for a single aerosol property, created at setup time by a representation instance
   /// @details Captures all needed parameter/variable column indices internally. Operates on
   ///          ForEachRow-compatible column views — no per-cell indexing. Partial derivatives are
-  ///          written into columns of a pre-allocated DenseMatrixPolicy, one column per dependent variable.
+  ///          written into columns of a pre-allocated DenseMatrixPolicy: one column for each dependent
+  ///          variable with a general partial, followed by one factor column for each ScaledPartials group.
+  ///          The value and partials columns default to 0 and are moved with WriteTo(), so that
+  ///          AerosolPropertyCache can have every provider write straight into its packed matrices.
   /// @tparam DenseMatrixPolicy The dense matrix type used for state data
   template<typename DenseMatrixPolicy>
   struct AerosolPropertyProvider
@@ -34,6 +84,11 @@ namespace miam
     ///   3. Map partials columns back to state variable indices
     std::vector<std::size_t> dependent_variable_indices;
 
+    /// @brief Groups of dependent variables whose partials share one per-cell factor
+    /// @details Empty for a provider with one partials column per dependent variable. A dependent variable
+    ///          belongs to at most one group; the others are listed by GeneralDependents().
+    std::vector<ScaledPartials> scaled_partials;
+
     /// @brief Compute the property value for all grid cells in the current group
     /// @details Called inside a ForEachRow loop — receives column views and writes into a RowVariable.
     ///   The provider internally calls params_view.GetConstColumnView(...) and
@@ -46,16 +101,177 @@ namespace miam
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> ComputeValue;
 
     /// @brief Compute the property value AND partial derivatives for all grid cells in the current group
-    /// @details Called inside a ForEachRow loop.
+    /// @details Called inside a ForEachRow loop. This is a fused evaluation: it must write the value as well
+    ///   as the partials, so the Jacobian path calls it alone, without a preceding ComputeValue, and
+    ///   subexpressions shared by the value and the partials are evaluated once per cell.
     ///
     ///   Parameters:
     ///     params_view:      const GroupView of state parameters
     ///     vars_view:        const GroupView of state variables
     ///     result:           mutable RowVariable for the property value
     ///     partials_matrix:  mutable GroupView of the partials DenseMatrix
-    ///                       (num_cells x num_dependent_variables)
-    ///                       Column k corresponds to d(property)/d(var[dependent_variable_indices[k]])
+    ///                       (num_cells x NumberOfPartialsColumns())
+    ///                       Column k < GeneralDependents().size() is
+    ///                       d(property)/d(var[dependent_variable_indices[GeneralDependents()[k]]]);
+    ///                       the following columns hold the factor of each scaled_partials group
     std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&, DenseMatrixPolicy&)>
         ComputeValueAndDerivatives;
+
+    /// @brief Builds ComputeValue and ComputeValueAndDerivatives to write into the given columns
+    /// @details Set with SetPropertyFunctions() by whoever creates the provider; called by WriteTo()
+    std::function<void(AerosolPropertyProvider&, const PropertyColumns&)> BuildFunctions;
+
+    /// @brief Rebuilds the compute functions to write the value and partials into `columns`
+    /// @details The matrices the functions are then called with must have at least columns.value_ + 1 and
+    ///          columns.partials_ + NumberOfPartialsColumns() columns; other columns are left untouched.
+    void WriteTo(const PropertyColumns& columns)
+    {
+      BuildFunctions(*this, columns);
+    }
+
+    /// @brief Returns the positions in dependent_variable_indices that are in no scaled_partials group
+    std::vector<std::size_t> GeneralDependents() const
+    {
+      std::vector<bool> scaled(dependent_variable_indices.size(), false);
+      for (const auto& group : scaled_partials)
+        for (std::size_t dependent : group.dependents_)
+          scaled[dependent] = true;
+      std::vector<std::size_t> general;
+      for (std::size_t k = 0; k < scaled.size(); ++k)
+        if (!scaled[k])
+          general.push_back(k);
+      return general;
+    }
+
+    /// @brief Returns the number of partials columns ComputeValueAndDerivatives writes
+    std::size_t NumberOfPartialsColumns() const
+    {
+      return GeneralDependents().size() + scaled_partials.size();
+    }
+
+    /// @brief Returns d(property)/d(var[dependent_variable_indices[k]]) in one grid cell of a partials matrix
+    /// @details Expands the structured layout for checks and diagnostics; kernels read the columns directly.
+    double PartialDerivative(const DenseMatrixPolicy& partials, std::size_t row, std::size_t k) const
+    {
+      const auto general = GeneralDependents();
+      for (std::size_t column = 0; column < general.size(); ++column)
+        if (general[column] == k)
+          return partials[row][column];
+      for (std::size_t g = 0; g < scaled_partials.size(); ++g)
+        for (std::size_t m = 0; m < scaled_partials[g].dependents_.size(); ++m)
+          if (scaled_partials[g].dependents_[m] == k)
+            return scaled_partials[g].coefficients_[m] * partials[row][general.size() + g];
+      return 0.0;
+    }
   };
+
+  /// @brief Sets the functions of a provider from kernels that take the target columns as first argument
+  /// @details The kernels are the bodies of the DenseMatrixPolicy::Function calls, with a leading
+  ///          `const PropertyColumns&` argument naming the value column and the first partials column:
+  ///            value_kernel(columns, params, vars, result)
+  ///            value_and_derivatives_kernel(columns, params, vars, result, partials)
+  ///          The provider's dependents and scaled_partials must be set first. The functions are built
+  ///          for the default columns, and again by every WriteTo().
+  /// @param number_of_parameters Number of state parameters
+  /// @param number_of_variables Number of state variables
+  template<typename DenseMatrixPolicy, typename ValueKernel, typename ValueAndDerivativesKernel>
+  void SetPropertyFunctions(
+      AerosolPropertyProvider<DenseMatrixPolicy>& provider,
+      std::size_t number_of_parameters,
+      std::size_t number_of_variables,
+      ValueKernel value_kernel,
+      ValueAndDerivativesKernel value_and_derivatives_kernel)
+  {
+    provider.BuildFunctions =
+        [number_of_parameters, number_of_variables, value_kernel, value_and_derivatives_kernel](
+            AerosolPropertyProvider<DenseMatrixPolicy>& built, const PropertyColumns& columns)
+    {
+      DenseMatrixPolicy dummy_params{ 1, number_of_parameters, 0.0 };
+      DenseMatrixPolicy dummy_vars{ 1, number_of_variables, 0.0 };
+      DenseMatrixPolicy dummy_result{ 1, columns.value_ + 1, 0.0 };
+      DenseMatrixPolicy dummy_partials{ 1, columns.partials_ + built.NumberOfPartialsColumns(), 0.0 };
+      built.ComputeValue = DenseMatrixPolicy::Function(
+          [value_kernel, columns](auto&& params, auto&& vars, auto&& result)
+          { value_kernel(columns, params, vars, result); },
+          dummy_params,
+          dummy_vars,
+          dummy_result);
+      built.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
+          [value_and_derivatives_kernel, columns](auto&& params, auto&& vars, auto&& result, auto&& partials)
+          { value_and_derivatives_kernel(columns, params, vars, result, partials); },
+          dummy_params,
+          dummy_vars,
+          dummy_result,
+          dummy_partials);
+    };
+    provider.WriteTo({});
+  }
+
+  /// @brief Creates a provider that reads a property from a state parameter column
+  /// @details The provider has no dependent variables, so processes that use it add no Jacobian
+  ///          contributions through the property.
+  /// @param parameter_index State parameter column holding the property value
+  /// @param number_of_parameters Number of state parameters
+  /// @param number_of_variables Number of state variables
+  template<typename DenseMatrixPolicy>
+  AerosolPropertyProvider<DenseMatrixPolicy>
+  ParameterPropertyProvider(std::size_t parameter_index, std::size_t number_of_parameters, std::size_t number_of_variables)
+  {
+    AerosolPropertyProvider<DenseMatrixPolicy> provider;
+    auto copy_parameter = [parameter_index](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
+    {
+      params.ForEachRow(
+          [](const double& frozen, double& value) { value = frozen; },
+          params.GetConstColumnView(parameter_index),
+          result.GetColumnView(columns.value_));
+    };
+    SetPropertyFunctions(
+        provider,
+        number_of_parameters,
+        number_of_variables,
+        copy_parameter,
+        [copy_parameter](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
+        { copy_parameter(columns, params, vars, result); });
+    return provider;
+  }
+
+  /// @brief Returns a provider whose partials matrix has one column per dependent variable
+  /// @details Column k of the partials is d(property)/d(var[dependent_variable_indices[k]]), as for providers
+  ///          without scaled_partials, so code written for that layout can read any provider. A provider
+  ///          without groups is returned as is. Otherwise ComputeValueAndDerivatives evaluates the wrapped
+  ///          provider into a partials matrix of its own layout and expands the groups into their dependents'
+  ///          columns. The returned provider has no BuildFunctions, so AerosolPropertyCache copies its results.
+  template<typename DenseMatrixPolicy>
+  AerosolPropertyProvider<DenseMatrixPolicy> DensePartialsProvider(AerosolPropertyProvider<DenseMatrixPolicy> provider)
+  {
+    if (provider.scaled_partials.empty())
+      return provider;
+    // Column of the wrapped provider's partials and coefficient of each dependent variable
+    std::vector<std::pair<std::size_t, double>> sources(provider.dependent_variable_indices.size());
+    const auto general = provider.GeneralDependents();
+    for (std::size_t column = 0; column < general.size(); ++column)
+      sources[general[column]] = { column, 1.0 };
+    for (std::size_t g = 0; g < provider.scaled_partials.size(); ++g)
+      for (std::size_t m = 0; m < provider.scaled_partials[g].dependents_.size(); ++m)
+        sources[provider.scaled_partials[g].dependents_[m]] = { general.size() + g,
+                                                                provider.scaled_partials[g].coefficients_[m] };
+
+    AerosolPropertyProvider<DenseMatrixPolicy> dense;
+    dense.dependent_variable_indices = provider.dependent_variable_indices;
+    dense.ComputeValue = provider.ComputeValue;
+    dense.ComputeValueAndDerivatives =
+        [compute = provider.ComputeValueAndDerivatives, number_of_columns = provider.NumberOfPartialsColumns(), sources](
+            const DenseMatrixPolicy& params,
+            const DenseMatrixPolicy& vars,
+            DenseMatrixPolicy& result,
+            DenseMatrixPolicy& partials)
+    {
+      DenseMatrixPolicy structured{ partials.NumRows(), number_of_columns, 0.0 };
+      compute(params, vars, result, structured);
+      for (std::size_t row = 0; row < partials.NumRows(); ++row)
+        for (std::size_t k = 0; k < sources.size(); ++k)
+          partials[row][k] = sources[k].second * structured[row][sources[k].first];
+    };
+    return dense;
+  }
 }  // namespace miam
@@ -0,0 +1,306 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/representations/aerosol_property.hpp>
+#include <miam/util/error.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Per-evaluation cache of aerosol property values and partial derivatives
+  /// @details Holds one entry per (representation prefix, property) pair. The owner of a forcing or
+  ///          Jacobian function fills the cache once per evaluation (Update or UpdateWithPartials),
+  ///          and every process that needs a property reads the cached columns by entry index.
+  ///          The cost of property evaluation therefore scales with the number of representation
+  ///          instances, not with the number of processes that use them.
+  ///
+  ///          Entry indices are resolved at setup time with Index(). The values of all entries share one
+  ///          matrix (column = entry index) and the partials another (columns PartialsOffset(i) onwards);
+  ///          each provider is moved with WriteTo() to write straight into its own columns, so a process
+  ///          spanning many representation instances reads all of them from a single kernel without a
+  ///          copy. The instances registered together with AddFused() get consecutive entries and are
+  ///          evaluated by one fused provider. Both matrices are reallocated only when the number of grid
+  ///          cells changes.
+  /// @tparam DenseMatrixPolicy The dense matrix type used for state data
+  template<typename DenseMatrixPolicy>
+  class AerosolPropertyCache
+  {
+   public:
+    using ProviderMap = std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>>;
+
+    AerosolPropertyCache() = default;
+
+    /// @brief Creates one cache entry for every provider in the map
+    /// @param providers Providers keyed by representation prefix and property
+    explicit AerosolPropertyCache(const ProviderMap& providers)
+    {
+      for (const auto& [prefix, prov_map] : providers)
+        for (const auto& [property, provider] : prov_map)
+          Add(prefix, property, provider);
+    }
+
+    /// @brief Adds an entry for a (prefix, property) pair if it is not already cached
+    /// @details The cache keeps a copy of the provider, rebuilt to write into the entry's packed columns.
+    ///          A provider without BuildFunctions (built by hand rather than with SetPropertyFunctions())
+    ///          writes into column 0 of its own matrices, which are copied into the packed ones.
+    /// @return Index of the entry
+    std::size_t Add(
+        const std::string& prefix,
+        AerosolProperty property,
+        const AerosolPropertyProvider<DenseMatrixPolicy>& provider)
+    {
+      auto it = lookup_.find(std::make_pair(prefix, property));
+      if (it != lookup_.end())
+        return it->second;
+      if (!provider.BuildFunctions)
+        return AddUnpacked(prefix, property, provider);
+      const std::size_t index = AddEntry(prefix, property, provider);
+      auto& cached = entries_.back().provider;
+      cached.WriteTo(PropertyColumns{ index, partials_offsets_.back() });
+      evaluators_.push_back(Evaluator{ std::move(cached.ComputeValue), std::move(cached.ComputeValueAndDerivatives) });
+      return index;
+    }
+
+    /// @brief Adds entries for one property of several representation instances, evaluated in one pass
+    /// @details The instances get consecutive entries in the order of `prefixes`. `fused` computes all of them:
+    ///          after WriteTo(columns) it writes the value of instance k into column columns.value_ + k and its
+    ///          partials right after those of the instances before it, each laid out as `providers[k]` describes.
+    ///          If any of the instances is already cached, or `fused` has no BuildFunctions, the instances are
+    ///          added one by one with Add().
+    /// @param prefixes Representation prefixes of the instances
+    /// @param property The property computed for every instance
+    /// @param providers Single-instance providers, describing the dependents of each instance
+    /// @param fused Provider computing the property of all instances
+    void AddFused(
+        const std::vector<std::string>& prefixes,
+        AerosolProperty property,
+        const std::vector<AerosolPropertyProvider<DenseMatrixPolicy>>& providers,
+        const AerosolPropertyProvider<DenseMatrixPolicy>& fused)
+    {
+      const bool any_cached = std::any_of(
+          prefixes.begin(), prefixes.end(), [&](const std::string& prefix) { return Contains(prefix, property); });
+      if (any_cached || !fused.BuildFunctions)
+      {
+        for (std::size_t i = 0; i < prefixes.size(); ++i)
+          Add(prefixes[i], property, providers[i]);
+        return;
+      }
+      const PropertyColumns columns{ entries_.size(), number_of_packed_partials_ };
+      for (std::size_t i = 0; i < prefixes.size(); ++i)
+        AddEntry(prefixes[i], property, providers[i]);
+      auto built = fused;
+      built.WriteTo(columns);
+      evaluators_.push_back(Evaluator{ std::move(built.ComputeValue), std::move(built.ComputeValueAndDerivatives) });
+    }
+
+    /// @brief Returns true if the cache holds an entry for the (prefix, property) pair
+    bool Contains(const std::string& prefix, AerosolProperty property) const
+    {
+      return lookup_.find(std::make_pair(prefix, property)) != lookup_.end();
+    }
+
+    /// @brief Returns the entry index for a (prefix, property) pair
+    std::size_t Index(const std::string& prefix, AerosolProperty property) const
+    {
+      auto it = lookup_.find(std::make_pair(prefix, property));
+      if (it == lookup_.end())
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_INTERNAL,
+            MIAM_INTERNAL_MISSING_PHASE_PREFIX,
+            "Internal Error: AerosolPropertyCache: no cached property for prefix '" + prefix + "'");
+      return it->second;
+    }
+
+    /// @brief Returns the number of cached (prefix, property) entries
+    std::size_t Size() const
+    {
+      return entries_.size();
+    }
+
+    /// @brief Returns true if no properties are cached
+    bool Empty() const
+    {
+      return entries_.empty();
+    }
+
+    /// @brief Returns the state variable indices the property of an entry depends on
+    const std::vector<std::size_t>& DependentVariableIndices(std::size_t index) const
+    {
+      return entries_[index].provider.dependent_variable_indices;
+    }
+
+    /// @brief Returns the positions in DependentVariableIndices(index) with their own partials column
+    /// @details Column PartialsOffset(index) + k of PackedPartials() is the partial w.r.t. dependent
+    ///          GeneralDependents(index)[k].
+    const std::vector<std::size_t>& GeneralDependents(std::size_t index) const
+    {
+      return entries_[index].general_dependents;
+    }
+
+    /// @brief Returns the groups of dependents whose partials are a constant coefficient times a shared factor
+    /// @details The factor of group g is column PartialsOffset(index) + GeneralDependents(index).size() + g of
+    ///          PackedPartials().
+    const std::vector<ScaledPartials>& ScaledPartialGroups(std::size_t index) const
+    {
+      return entries_[index].provider.scaled_partials;
+    }
+
+    /// @brief Returns the cached values of all entries (num_cells x max(1, Size())); column i is entry i
+    const DenseMatrixPolicy& PackedValues() const
+    {
+      return packed_values_;
+    }
+
+    /// @brief Returns the cached partials of all entries (num_cells x max(1, NumberOfPackedPartials()))
+    /// @details Entry i owns columns PartialsOffset(i) onwards, laid out as its provider writes them: general
+    ///          partials, then one factor per scaled group (see AerosolPropertyProvider::NumberOfPartialsColumns()).
+    ///          Only valid after UpdateWithPartials.
+    const DenseMatrixPolicy& PackedPartials() const
+    {
+      return packed_partials_;
+    }
+
+    /// @brief Returns the first column of an entry's partials in PackedPartials()
+    std::size_t PartialsOffset(std::size_t index) const
+    {
+      return partials_offsets_[index];
+    }
+
+    /// @brief Returns the total number of partials columns over all entries
+    std::size_t NumberOfPackedPartials() const
+    {
+      return number_of_packed_partials_;
+    }
+
+    /// @brief Allocates value and partials storage for a number of grid cells
+    /// @details Called automatically by Update and UpdateWithPartials; storage is reallocated only
+    ///          when the number of grid cells changes, so steady-state updates do not allocate.
+    void Resize(std::size_t number_of_rows)
+    {
+      if (number_of_rows == number_of_rows_)
+        return;
+      packed_values_ = DenseMatrixPolicy{ number_of_rows, std::max(entries_.size(), std::size_t(1)), 0.0 };
+      packed_partials_ = DenseMatrixPolicy{ number_of_rows, std::max(number_of_packed_partials_, std::size_t(1)), 0.0 };
+      number_of_rows_ = number_of_rows;
+    }
+
+    /// @brief Computes property values for all entries
+    void Update(const DenseMatrixPolicy& state_parameters, const DenseMatrixPolicy& state_variables)
+    {
+      Resize(state_parameters.NumRows());
+      for (auto& evaluator : evaluators_)
+        evaluator.compute_value_(state_parameters, state_variables, packed_values_);
+    }
+
+    /// @brief Computes property values and partial derivatives for all entries
+    /// @details Each provider or fused provider is evaluated by a single fused ComputeValueAndDerivatives
+    ///          call, which writes the values together with the partials; ComputeValue is not called on this path.
+    void UpdateWithPartials(const DenseMatrixPolicy& state_parameters, const DenseMatrixPolicy& state_variables)
+    {
+      Resize(state_parameters.NumRows());
+      for (auto& evaluator : evaluators_)
+        evaluator.compute_value_and_derivatives_(state_parameters, state_variables, packed_values_, packed_partials_);
+    }
+
+   private:
+    /// @brief A cached property
+    struct Entry
+    {
+      AerosolPropertyProvider<DenseMatrixPolicy> provider;  ///< Provider describing the entry's dependents
+      std::vector<std::size_t> general_dependents;          ///< Dependents with their own partials column
+    };
+
+    /// @brief Functions that fill the packed columns of one provider or of the instances of a fused provider
+    struct Evaluator
+    {
+      std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&)> compute_value_;
+      std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy&, DenseMatrixPolicy&)>
+          compute_value_and_derivatives_;
+    };
+
+    std::map<std::pair<std::string, AerosolProperty>, std::size_t> lookup_;  ///< (prefix, property) → entry index
+    std::vector<Entry> entries_;                                             ///< Cached entries
+    std::vector<Evaluator> evaluators_;                                      ///< Evaluated in order by each update
+    std::vector<std::size_t> partials_offsets_;                              ///< First packed partials column per entry
+    std::size_t number_of_packed_partials_{ 0 };                             ///< Total partials columns of all entries
+    DenseMatrixPolicy packed_values_{ 1, 1, 0.0 };                           ///< Values of all entries (num_cells x entries)
+    DenseMatrixPolicy packed_partials_{ 1, 1, 0.0 };                         ///< Partials of all entries
+    std::size_t number_of_rows_{ 0 };                                        ///< Number of grid cells currently allocated
+
+    /// @brief Appends an entry without an evaluator and reserves its partials columns
+    std::size_t AddEntry(
+        const std::string& prefix,
+        AerosolProperty property,
+        const AerosolPropertyProvider<DenseMatrixPolicy>& provider)
+    {
+      const std::size_t index = entries_.size();
+      entries_.push_back(Entry{ provider, provider.GeneralDependents() });
+      lookup_[std::make_pair(prefix, property)] = index;
+      partials_offsets_.push_back(number_of_packed_partials_);
+      number_of_packed_partials_ += provider.NumberOfPartialsColumns();
+      number_of_rows_ = 0;  // force (re)allocation on the next update
+      return index;
+    }
+
+    /// @brief Adds an entry for a provider that cannot be moved, evaluated into its own matrices and copied
+    /// @details The provider writes its value into column 0 and its partials into columns
+    ///          0..NumberOfPartialsColumns()-1 of matrices owned by the evaluator, which are reallocated only
+    ///          when the number of grid cells changes.
+    std::size_t AddUnpacked(
+        const std::string& prefix,
+        AerosolProperty property,
+        const AerosolPropertyProvider<DenseMatrixPolicy>& provider)
+    {
+      const std::size_t index = AddEntry(prefix, property, provider);
+      const std::size_t partials_offset = partials_offsets_.back();
+      const std::size_t number_of_partials = provider.NumberOfPartialsColumns();
+      evaluators_.push_back(Evaluator{
+          [provider, index, value = DenseMatrixPolicy{ 1, 1, 0.0 }](
+              const DenseMatrixPolicy& state_parameters,
+              const DenseMatrixPolicy& state_variables,
+              DenseMatrixPolicy& packed_values) mutable
+          {
+            if (value.NumRows() != state_parameters.NumRows())
+              value = DenseMatrixPolicy{ state_parameters.NumRows(), 1, 0.0 };
+            provider.ComputeValue(state_parameters, state_variables, value);
+            for (std::size_t cell = 0; cell < value.NumRows(); ++cell)
+              packed_values[cell][index] = value[cell][0];
+          },
+          [provider,
+           index,
+           partials_offset,
+           number_of_partials,
+           value = DenseMatrixPolicy{ 1, 1, 0.0 },
+           partials = DenseMatrixPolicy{ 1, std::max(number_of_partials, std::size_t(1)), 0.0 }](
+              const DenseMatrixPolicy& state_parameters,
+              const DenseMatrixPolicy& state_variables,
+              DenseMatrixPolicy& packed_values,
+              DenseMatrixPolicy& packed_partials) mutable
+          {
+            if (value.NumRows() != state_parameters.NumRows())
+            {
+              value = DenseMatrixPolicy{ state_parameters.NumRows(), 1, 0.0 };
+              partials = DenseMatrixPolicy{ state_parameters.NumRows(), std::max(number_of_partials, std::size_t(1)), 0.0 };
+            }
+            provider.ComputeValueAndDerivatives(state_parameters, state_variables, value, partials);
+            for (std::size_t cell = 0; cell < value.NumRows(); ++cell)
+            {
+              packed_values[cell][index] = value[cell][0];
+              for (std::size_t k = 0; k < number_of_partials; ++k)
+                packed_partials[cell][partials_offset + k] = partials[cell][k];
+            }
+          } });
+      return index;
+    }
+  };
+}  // namespace miam
@@ -0,0 +1,461 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/cell_blocks.hpp>
+#include <miam/representations/aerosol_property.hpp>
+#include <miam/representations/uniform_section.hpp>
+#include <miam/util/error.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <micm/system/phase.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <numbers>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Sectional particle size distribution of N bins owned by one representation
+  /// @details Builds N contiguous size bins from log-spaced or user-given edges. Bin i spans the radius range
+  ///          [bin_edges[i], bin_edges[i+1]] and has the prefix BinPrefix(i), its own MIN_RADIUS/MAX_RADIUS
+  ///          parameters and one phase instance per phase, with the state names and formulas of a
+  ///          UniformSection.
+  ///
+  ///          GetPropertyProviders() returns one independent provider per bin. GetFusedPropertyProvider()
+  ///          computes a property of all bins in one pass over the grid cells: the cell groups are the outer
+  ///          loop and the bins the inner one, as in MassActionTerms, with the species columns of all bins
+  ///          gathered into one index table at setup. The state layout is that of N UniformSection bins.
+  ///
+  ///          Bin prefixes are `<prefix>.BIN_<i>` with i zero-padded, so state names sort in bin order.
+  class SectionalDistribution
+  {
+   public:
+    SectionalDistribution() = delete;
+
+    /// @brief Creates a distribution with user-given bin edges
+    /// @param prefix State name prefix of the distribution
+    /// @param phases Phases present in every bin
+    /// @param bin_edges Radius bin edges [m]; N+1 strictly increasing, non-negative values for N bins
+    SectionalDistribution(
+        const std::string& prefix,
+        const std::vector<micm::Phase>& phases,
+        const std::vector<double>& bin_edges)
+        : prefix_(prefix),
+          phases_(phases),
+          bin_edges_(bin_edges)
+    {
+      if (bin_edges_.size() < 2)
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "SectionalDistribution: at least two bin edges are required for " + prefix_);
+      if (bin_edges_.front() < 0.0)
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "SectionalDistribution: bin edges must be non-negative for " + prefix_);
+      for (std::size_t i = 1; i < bin_edges_.size(); ++i)
+        if (!(bin_edges_[i] > bin_edges_[i - 1]))
+          throw MiamException(
+              MIAM_ERROR_CATEGORY_CONFIGURATION,
+              MIAM_CONFIGURATION_INVALID_PARAMETER,
+              "SectionalDistribution: bin edges must be strictly increasing for " + prefix_);
+      bins_.reserve(NumberOfBins());
+      for (std::size_t bin = 0; bin < NumberOfBins(); ++bin)
+        bins_.emplace_back(BinPrefix(bin), phases_, bin_edges_[bin], bin_edges_[bin + 1]);
+    }
+
+    /// @brief Creates a distribution with logarithmically spaced bin edges
+    /// @param prefix State name prefix of the distribution
+    /// @param phases Phases present in every bin
+    /// @param number_of_bins Number of bins (at least 1)
+    /// @param minimum_radius Lower edge of the first bin [m] (> 0)
+    /// @param maximum_radius Upper edge of the last bin [m] (> minimum_radius)
+    SectionalDistribution(
+        const std::string& prefix,
+        const std::vector<micm::Phase>& phases,
+        std::size_t number_of_bins,
+        double minimum_radius,
+        double maximum_radius)
+        : SectionalDistribution(prefix, phases, LogSpacedEdges(prefix, number_of_bins, minimum_radius, maximum_radius))
+    {
+    }
+
+    /// @brief Returns the number of bins
+    std::size_t NumberOfBins() const
+    {
+      return bin_edges_.size() - 1;
+    }
+
+    /// @brief Returns the N+1 radius bin edges [m]
+    const std::vector<double>& BinEdges() const
+    {
+      return bin_edges_;
+    }
+
+    /// @brief Returns the state prefix of a bin
+    std::string BinPrefix(std::size_t bin) const
+    {
+      std::string index = std::to_string(bin);
+      std::size_t width = std::to_string(NumberOfBins() - 1).size();
+      return prefix_ + ".BIN_" + std::string(width - std::min(width, index.size()), '0') + index;
+    }
+
+    /// @brief Returns the state name prefix of the representation
+    const std::string& Prefix() const
+    {
+      return prefix_;
+    }
+
+    std::tuple<std::size_t, std::size_t> StateSize() const
+    {
+      std::size_t size = 0;
+      for (const auto& phase : phases_)
+      {
+        size += phase.StateSize();
+      }
+      return { size * NumberOfBins(), 2 * NumberOfBins() };  // Two parameters per bin: min and max radius
+    }
+
+    std::set<std::string> StateVariableNames() const
+    {
+      std::set<std::string> names;
+      for (const auto& bin : bins_)
+        names.merge(bin.StateVariableNames());
+      return names;
+    }
+
+    std::set<std::string> StateParameterNames() const
+    {
+      std::set<std::string> names;
+      for (const auto& bin : bins_)
+        names.merge(bin.StateParameterNames());
+      return names;
+    }
+
+    std::string Species(std::size_t bin, const micm::Phase& phase, const micm::Species& species) const
+    {
+      return bins_[bin].Species(phase, species);
+    }
+
+    std::map<std::string, double> DefaultParameters() const
+    {
+      std::map<std::string, double> parameters;
+      for (const auto& bin : bins_)
+        parameters.merge(bin.DefaultParameters());
+      return parameters;
+    }
+
+    std::string MinRadius(std::size_t bin) const
+    {
+      return bins_[bin].MinRadius();
+    }
+
+    std::string MaxRadius(std::size_t bin) const
+    {
+      return bins_[bin].MaxRadius();
+    }
+
+    void SetDefaultParameters(auto& state) const
+    {
+      for (const auto& bin : bins_)
+        bin.SetDefaultParameters(state);
+    }
+
+    std::map<std::string, std::size_t> NumPhaseInstances() const
+    {
+      std::map<std::string, std::size_t> num_instances;
+      for (const auto& phase : phases_)
+      {
+        num_instances[phase.name_] = NumberOfBins();  // One instance per phase per bin
+      }
+      return num_instances;
+    }
+
+    /// @brief Returns a map of phase names to sets of state variable prefixes associated with that phase
+    ///        Every phase has one prefix per bin (see BinPrefix).
+    /// @return Map of phase names to sets of state variable prefixes
+    std::map<std::string, std::set<std::string>> PhaseStatePrefixes() const
+    {
+      std::map<std::string, std::set<std::string>> phase_prefixes;
+      for (const auto& phase : phases_)
+      {
+        for (std::size_t bin = 0; bin < NumberOfBins(); ++bin)
+          phase_prefixes[phase.name_].insert(BinPrefix(bin));
+      }
+      return phase_prefixes;
+    }
+
+    /// @brief Returns a provider for the requested aerosol property of one bin
+    /// @param bin_prefix Prefix of the bin (see BinPrefix)
+    template<typename DenseMatrixPolicy>
+    AerosolPropertyProvider<DenseMatrixPolicy> GetPropertyProvider(
+        AerosolProperty property,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const std::string& target_phase_name,
+        const std::string& bin_prefix) const
+    {
+      for (const auto& bin : bins_)
+        if (bin.Prefix() == bin_prefix)
+          return bin.template GetPropertyProvider<DenseMatrixPolicy>(
+              property, state_parameter_indices, state_variable_indices, target_phase_name);
+      throw MiamException(
+          MIAM_ERROR_CATEGORY_INTERNAL,
+          MIAM_INTERNAL_MISSING_PHASE_PREFIX,
+          "SectionalDistribution: no bin with prefix " + bin_prefix + " in " + prefix_);
+    }
+
+    /// @brief Returns providers for the requested aerosol property of every bin, keyed by bin prefix
+    /// @details One independent provider per bin, identical to those of the corresponding UniformSection
+    template<typename DenseMatrixPolicy>
+    std::map<std::string, AerosolPropertyProvider<DenseMatrixPolicy>> GetPropertyProviders(
+        AerosolProperty property,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const std::string& target_phase_name = "") const
+    {
+      std::map<std::string, AerosolPropertyProvider<DenseMatrixPolicy>> providers;
+      for (const auto& bin : bins_)
+        providers.emplace(
+            bin.Prefix(),
+            bin.template GetPropertyProvider<DenseMatrixPolicy>(
+                property, state_parameter_indices, state_variable_indices, target_phase_name));
+      return providers;
+    }
+
+    /// @brief Returns a provider that computes the requested aerosol property of every bin in one pass
+    /// @details For AerosolPropertyCache::AddFused() with the bin prefixes in bin order and the providers of
+    ///          GetPropertyProviders(). After WriteTo(columns), bin b writes value column columns.value_ + b and
+    ///          its partials from column columns.partials_ + b * (partials columns of one bin) on, laid out as
+    ///          its GetPropertyProviders() provider writes them. The provider itself lists no dependents.
+    template<typename DenseMatrixPolicy>
+    AerosolPropertyProvider<DenseMatrixPolicy> GetFusedPropertyProvider(
+        AerosolProperty property,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const std::string& target_phase_name = "") const
+    {
+      static_assert(
+          CellGroupStorage<DenseMatrixPolicy>, "SectionalDistribution requires the CellGroupStorage matrix layout");
+      RequireCellGroupLayout<DenseMatrixPolicy>("SectionalDistribution");
+      auto tables = BuildBinTables(property, state_parameter_indices, state_variable_indices, target_phase_name);
+      tables.partials_per_bin_ =
+          bins_.front()
+              .template GetPropertyProvider<DenseMatrixPolicy>(
+                  property, state_parameter_indices, state_variable_indices, target_phase_name)
+              .NumberOfPartialsColumns();
+      AerosolPropertyProvider<DenseMatrixPolicy> provider;
+      provider.BuildFunctions =
+          [tables](AerosolPropertyProvider<DenseMatrixPolicy>& built, const PropertyColumns& columns)
+      {
+        built.ComputeValue =
+            [tables, columns](const DenseMatrixPolicy& params, const DenseMatrixPolicy& vars, DenseMatrixPolicy& result)
+        { EvaluateBins<DenseMatrixPolicy>(tables, columns, params, vars, result, nullptr); };
+        built.ComputeValueAndDerivatives = [tables, columns](
+                                               const DenseMatrixPolicy& params,
+                                               const DenseMatrixPolicy& vars,
+                                               DenseMatrixPolicy& result,
+                                               DenseMatrixPolicy& partials)
+        { EvaluateBins<DenseMatrixPolicy>(tables, columns, params, vars, result, &partials); };
+      };
+      provider.WriteTo({});
+      return provider;
+    }
+
+   private:
+    /// @brief Column indices of one property of all bins
+    struct BinTables
+    {
+      AerosolProperty property_;               ///< Property the tables are built for
+      std::vector<std::size_t> min_radius_;    ///< MIN_RADIUS state parameter of each bin
+      std::vector<std::size_t> max_radius_;    ///< MAX_RADIUS state parameter of each bin
+      std::vector<std::size_t> species_;       ///< Species state variables, bin-major (bin * species per bin + k)
+      std::vector<double> molar_volumes_;      ///< Molar volume of species k of a bin [m3 mol-1]
+      std::size_t target_phase_species_{ 0 };  ///< Leading species of a bin in the target phase (PhaseVolumeFraction)
+      std::size_t partials_per_bin_{ 0 };      ///< Partials columns of each bin, as its own provider writes them
+      bool single_phase_{ false };             ///< True if the bins have one phase (PhaseVolumeFraction = 1)
+    };
+
+    std::string prefix_;                // State name prefix of the distribution
+    std::vector<micm::Phase> phases_;   // Phases present in every bin
+    std::vector<double> bin_edges_;     // Radius bin edges [m] (number of bins + 1)
+    std::vector<UniformSection> bins_;  // One section per bin, built from the edges
+
+    /// @brief Gathers the parameter and species columns a property reads for all bins
+    /// @details Species are listed in the order the UniformSection provider of a bin uses, so each bin's
+    ///          partials columns match its GetPropertyProviders() provider: all phases for NumberConcentration,
+    ///          the target phase first for PhaseVolumeFraction.
+    BinTables BuildBinTables(
+        AerosolProperty property,
+        const auto& state_parameter_indices,
+        const auto& state_variable_indices,
+        const std::string& target_phase_name) const
+    {
+      BinTables tables{ property };
+      tables.single_phase_ = phases_.size() == 1;
+      std::vector<const micm::Phase*> phases;
+      if (property == AerosolProperty::NumberConcentration)
+        for (const auto& phase : phases_)
+          phases.push_back(&phase);
+      if (property == AerosolProperty::PhaseVolumeFraction && !tables.single_phase_)
+      {
+        for (const auto& phase : phases_)
+          if (phase.name_ == target_phase_name)
+            phases.push_back(&phase);
+        for (const auto& phase : phases_)
+          if (phase.name_ != target_phase_name)
+            phases.push_back(&phase);
+      }
+      for (const auto& bin : bins_)
+      {
+        tables.min_radius_.push_back(state_parameter_indices.at(bin.MinRadius()));
+        tables.max_radius_.push_back(state_parameter_indices.at(bin.MaxRadius()));
+        for (const auto* phase : phases)
+          for (const auto& ps : phase->phase_species_)
+            if (!ps.species_.IsParameterized())
+              tables.species_.push_back(state_variable_indices.at(bin.Species(*phase, ps.species_)));
+      }
+      for (const auto* phase : phases)
+        for (const auto& ps : phase->phase_species_)
+          if (!ps.species_.IsParameterized())
+          {
+            tables.molar_volumes_.push_back(
+                ps.species_.GetProperty<double>("molecular weight [kg mol-1]") /
+                ps.species_.GetProperty<double>("density [kg m-3]"));
+            if (phase->name_ == target_phase_name)
+              ++tables.target_phase_species_;
+          }
+      return tables;
+    }
+
+    /// @brief Computes a property, and optionally its partials, of every bin in one pass over the grid cells
+    /// @details The cell groups of the matrices are the outer loop and the bins the inner one; the loop over
+    ///          the cells of a group is innermost and contiguous. Bin b writes value column columns.value_ + b
+    ///          and its partials from column columns.partials_ + b * partials_per_bin_ on, with the arithmetic of
+    ///          the UniformSection provider.
+    /// @param partials Partials matrix, or nullptr to compute the values only
+    template<typename DenseMatrixPolicy>
+    static void EvaluateBins(
+        const BinTables& tables,
+        const PropertyColumns& columns,
+        const DenseMatrixPolicy& state_parameters,
+        const DenseMatrixPolicy& state_variables,
+        DenseMatrixPolicy& values,
+        DenseMatrixPolicy* partials)
+    {
+      constexpr std::size_t L = CellGroupSize<DenseMatrixPolicy>();
+      const std::size_t number_of_bins = tables.min_radius_.size();
+      const std::size_t species_per_bin = tables.molar_volumes_.size();
+      const std::size_t number_of_groups = (state_parameters.NumRows() + L - 1) / L;
+      std::array<double, L> total_volume;
+      std::array<double, L> phase_volume;
+      for (std::size_t group = 0; group < number_of_groups; ++group)
+      {
+        const double* parameters = state_parameters.AsVector().data() + group * L * state_parameters.NumColumns();
+        const double* variables = state_variables.AsVector().data() + group * L * state_variables.NumColumns();
+        double* group_values = values.AsVector().data() + group * L * values.NumColumns();
+        double* group_partials = partials ? partials->AsVector().data() + group * L * partials->NumColumns() : nullptr;
+        for (std::size_t bin = 0; bin < number_of_bins; ++bin)
+        {
+          const double* r_min = parameters + tables.min_radius_[bin] * L;
+          const double* r_max = parameters + tables.max_radius_[bin] * L;
+          const std::size_t* species = tables.species_.data() + bin * species_per_bin;
+          double* value = group_values + (columns.value_ + bin) * L;
+          double* partial =
+              group_partials ? group_partials + (columns.partials_ + bin * tables.partials_per_bin_) * L : nullptr;
+          switch (tables.property_)
+          {
+            case AerosolProperty::EffectiveRadius:
+              for (std::size_t cell = 0; cell < L; ++cell)
+                value[cell] = 0.5 * (r_min[cell] + r_max[cell]);
+              break;
+            case AerosolProperty::NumberConcentration:
+              // N = V_total / V_single, V_single = (4/3)π·r_eff³; ∂N/∂[species_k] = molar_volume_k / V_single
+              for (std::size_t cell = 0; cell < L; ++cell)
+                value[cell] = 0.0;
+              for (std::size_t k = 0; k < species_per_bin; ++k)
+              {
+                const double* concentration = variables + species[k] * L;
+                const double molar_volume = tables.molar_volumes_[k];
+                for (std::size_t cell = 0; cell < L; ++cell)
+                  value[cell] += concentration[cell] * molar_volume;
+              }
+              for (std::size_t cell = 0; cell < L; ++cell)
+              {
+                double r_eff = 0.5 * (r_min[cell] + r_max[cell]);
+                double V_s = (4.0 / 3.0) * std::numbers::pi * r_eff * r_eff * r_eff;
+                value[cell] /= V_s;
+                if (partial && species_per_bin > 0)
+                  partial[cell] = 1.0 / V_s;
+              }
+              break;
+            case AerosolProperty::PhaseVolumeFraction:
+              if (tables.single_phase_)
+              {
+                for (std::size_t cell = 0; cell < L; ++cell)
+                  value[cell] = 1.0;
+                break;
+              }
+              total_volume.fill(0.0);
+              phase_volume.fill(0.0);
+              for (std::size_t k = 0; k < species_per_bin; ++k)
+              {
+                const double* concentration = variables + species[k] * L;
+                const double molar_volume = tables.molar_volumes_[k];
+                for (std::size_t cell = 0; cell < L; ++cell)
+                {
+                  double volume = concentration[cell] * molar_volume;
+                  total_volume[cell] += volume;
+                  if (k < tables.target_phase_species_)
+                    phase_volume[cell] += volume;
+                }
+              }
+              for (std::size_t cell = 0; cell < L; ++cell)
+                value[cell] = (total_volume[cell] > 0.0) ? phase_volume[cell] / total_volume[cell] : 1.0;
+              if (!partial)
+                break;
+              // ∂φ/∂[species_k] = molar_volume_k · (1 - φ) / V_total in the target phase and
+              // -molar_volume_k · φ / V_total in the others
+              if (tables.target_phase_species_ > 0)
+              {
+                for (std::size_t cell = 0; cell < L; ++cell)
+                  partial[cell] = (total_volume[cell] > 0.0) ? (1.0 - value[cell]) / total_volume[cell] : 0.0;
+                partial += L;
+              }
+              if (species_per_bin > tables.target_phase_species_)
+                for (std::size_t cell = 0; cell < L; ++cell)
+                  partial[cell] = (total_volume[cell] > 0.0) ? -value[cell] / total_volume[cell] : 0.0;
+              break;
+          }
+        }
+      }
+    }
+
+    static std::vector<double>
+    LogSpacedEdges(const std::string& prefix, std::size_t number_of_bins, double minimum_radius, double maximum_radius)
+    {
+      if (number_of_bins == 0 || !(minimum_radius > 0.0) || !(maximum_radius > minimum_radius))
+        throw MiamException(
+            MIAM_ERROR_CATEGORY_CONFIGURATION,
+            MIAM_CONFIGURATION_INVALID_PARAMETER,
+            "SectionalDistribution: log-spaced bins need at least one bin and 0 < minimum radius < maximum radius for " +
+                prefix);
+      std::vector<double> edges(number_of_bins + 1);
+      const double log_ratio = std::log(maximum_radius / minimum_radius);
+      for (std::size_t i = 0; i < number_of_bins; ++i)
+        edges[i] = minimum_radius * std::exp(log_ratio * static_cast<double>(i) / static_cast<double>(number_of_bins));
+      edges[number_of_bins] = maximum_radius;
+      return edges;
+    }
+  };
+}  // namespace miam
@@ -48,6 +48,12 @@ namespace miam
     {
     }
 
+    /// @brief Returns the state name prefix of the representation
+    const std::string& Prefix() const
+    {
+      return prefix_;
+    }
+
     std::tuple<std::size_t, std::size_t> StateSize() const
     {
       std::size_t size = 0;
@@ -164,9 +170,6 @@ namespace miam
         const std::string& target_phase_name = "") const
     {
       AerosolPropertyProvider<DenseMatrixPolicy> provider;
-      DenseMatrixPolicy dummy_params{ 1, state_parameter_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_vars{ 1, state_variable_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_result{ 1, 1, 0.0 };
 
       switch (property)
       {
@@ -175,9 +178,11 @@ namespace miam
           std::size_t gmd_idx = state_parameter_indices.at(GeometricMeanRadius());
           std::size_t gsd_idx = state_parameter_indices.at(GeometricStandardDeviation());
           provider.dependent_variable_indices = {};
-          DenseMatrixPolicy dummy_partials{ 1, 0, 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [gmd_idx, gsd_idx](auto&& params, auto&& vars, auto&& result)
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [gmd_idx, gsd_idx](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
                 params.ForEachRow(
                     [](const double& gmd, const double& gsd, double& r_eff)
@@ -187,13 +192,9 @@ namespace miam
                     },
                     params.GetConstColumnView(gmd_idx),
                     params.GetConstColumnView(gsd_idx),
-                    result.GetColumnView(0));
+                    result.GetColumnView(columns.value_));
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-              [gmd_idx, gsd_idx](auto&& params, auto&& vars, auto&& result, auto&& partials)
+              [gmd_idx, gsd_idx](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
                 params.ForEachRow(
                     [](const double& gmd, const double& gsd, double& r_eff)
@@ -203,12 +204,8 @@ namespace miam
                     },
                     params.GetConstColumnView(gmd_idx),
                     params.GetConstColumnView(gsd_idx),
-                    result.GetColumnView(0));
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                    result.GetColumnView(columns.value_));
+              });
           break;
         }
         case AerosolProperty::NumberConcentration:
@@ -227,11 +224,17 @@ namespace miam
                     ps.species_.GetProperty<double>("density [kg m-3]"));
               }
           provider.dependent_variable_indices = species_indices;
-          DenseMatrixPolicy dummy_partials{ 1, species_indices.size(), 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [gmd_idx, gsd_idx, species_indices, molar_volumes](auto&& params, auto&& vars, auto&& result)
+          // ∂N/∂[species_k] = molar_volume_k / V_s: one factor 1/V_s per cell, scaled by each molar volume
+          if (!species_indices.empty())
+            provider.scaled_partials.push_back(ScaledPartials::Consecutive(0, molar_volumes));
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [gmd_idx, gsd_idx, species_indices, molar_volumes](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
-                auto N = result.GetColumnView(0);
+                auto N = result.GetColumnView(columns.value_);
                 params.ForEachRow([](double& v) { v = 0.0; }, N);
                 for (std::size_t k = 0; k < species_indices.size(); ++k)
                   params.ForEachRow(
@@ -249,45 +252,43 @@ namespace miam
                     params.GetConstColumnView(gsd_idx),
                     N);
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-              [gmd_idx, gsd_idx, species_indices, molar_volumes](auto&& params, auto&& vars, auto&& result, auto&& partials)
+              [gmd_idx, gsd_idx, species_indices, molar_volumes](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
-                auto N = result.GetColumnView(0);
-                params.ForEachRow([](double& v) { v = 0.0; }, N);
+                // V_s is evaluated once per cell and shared by the value and the partials factor
+                auto N = result.GetColumnView(columns.value_);
+                auto V_s = result.GetRowVariable();
+                params.ForEachRow(
+                    [](const double& gmd, const double& gsd, double& N, double& V_s)
+                    {
+                      double ln_gsd = std::log(gsd);
+                      V_s = (4.0 / 3.0) * std::numbers::pi * gmd * gmd * gmd * std::exp(4.5 * ln_gsd * ln_gsd);
+                      N = 0.0;
+                    },
+                    params.GetConstColumnView(gmd_idx),
+                    params.GetConstColumnView(gsd_idx),
+                    N,
+                    V_s);
                 for (std::size_t k = 0; k < species_indices.size(); ++k)
                   params.ForEachRow(
                       [molar_vol = molar_volumes[k]](const double& c, double& V) { V += c * molar_vol; },
                       vars.GetConstColumnView(species_indices[k]),
                       N);
+                if (species_indices.empty())
+                {
+                  params.ForEachRow([](const double& V_s, double& N) { N /= V_s; }, V_s, N);
+                  return;
+                }
                 params.ForEachRow(
-                    [](const double& gmd, const double& gsd, double& N)
+                    [](const double& V_s, double& N, double& dN_factor)
                     {
-                      double ln_gsd = std::log(gsd);
-                      double V_s = (4.0 / 3.0) * std::numbers::pi * gmd * gmd * gmd * std::exp(4.5 * ln_gsd * ln_gsd);
                       N /= V_s;
+                      dN_factor = 1.0 / V_s;
                     },
-                    params.GetConstColumnView(gmd_idx),
-                    params.GetConstColumnView(gsd_idx),
-                    N);
-                for (std::size_t k = 0; k < species_indices.size(); ++k)
-                  params.ForEachRow(
-                      [molar_vol = molar_volumes[k]](const double& gmd, const double& gsd, double& dN)
-                      {
-                        double ln_gsd = std::log(gsd);
-                        double V_s = (4.0 / 3.0) * std::numbers::pi * gmd * gmd * gmd * std::exp(4.5 * ln_gsd * ln_gsd);
-                        dN = molar_vol / V_s;
-                      },
-                      params.GetConstColumnView(gmd_idx),
-                      params.GetConstColumnView(gsd_idx),
-                      partials.GetColumnView(k));
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                    V_s,
+                    N,
+                    partials.GetColumnView(columns.partials_));
+              });
           break;
         }
         case AerosolProperty::PhaseVolumeFraction:
@@ -295,20 +296,14 @@ namespace miam
           if (phases_.size() == 1)
           {
             provider.dependent_variable_indices = {};
-            DenseMatrixPolicy dummy_partials{ 1, 0, 0.0 };
-            provider.ComputeValue = DenseMatrixPolicy::Function(
-                [](auto&& params, auto&& vars, auto&& result)
-                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(0)); },
-                dummy_params,
-                dummy_vars,
-                dummy_result);
-            provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-                [](auto&& params, auto&& vars, auto&& result, auto&& partials)
-                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(0)); },
-                dummy_params,
-                dummy_vars,
-                dummy_result,
-                dummy_partials);
+            SetPropertyFunctions(
+                provider,
+                state_parameter_indices.size(),
+                state_variable_indices.size(),
+                [](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
+                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(columns.value_)); },
+                [](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
+                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(columns.value_)); });
             break;
           }
           if (target_phase_name.empty())
@@ -348,11 +343,22 @@ namespace miam
               }
           }
           provider.dependent_variable_indices = all_species;
-          DenseMatrixPolicy dummy_partials{ 1, all_species.size(), 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [all_species, all_mw_over_rho, phase_count](auto&& params, auto&& vars, auto&& result)
+          // ∂φ/∂[species_k] = molar_volume_k · (1 - φ) / V_total in the target phase and
+          // -molar_volume_k · φ / V_total in the others: one scaled group per side, one factor per cell
+          if (phase_count > 0)
+            provider.scaled_partials.push_back(
+                ScaledPartials::Consecutive(0, { all_mw_over_rho.begin(), all_mw_over_rho.begin() + phase_count }));
+          if (all_species.size() > phase_count)
+            provider.scaled_partials.push_back(
+                ScaledPartials::Consecutive(phase_count, { all_mw_over_rho.begin() + phase_count, all_mw_over_rho.end() }));
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [all_species, all_mw_over_rho, phase_count](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
-                auto phi = result.GetColumnView(0);
+                auto phi = result.GetColumnView(columns.value_);
                 auto V_phase = result.GetRowVariable();
                 params.ForEachRow(
                     [](double& vt, double& vp)
@@ -383,13 +389,10 @@ namespace miam
                 }
                 params.ForEachRow([](double& phi, const double& vp) { phi = (phi > 0.0) ? vp / phi : 1.0; }, phi, V_phase);
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-              [all_species, all_mw_over_rho, phase_count](auto&& params, auto&& vars, auto&& result, auto&& partials)
+              [all_species, all_mw_over_rho, phase_count](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
-                auto result_col = result.GetColumnView(0);
+                auto result_col = result.GetColumnView(columns.value_);
                 auto V_phase = result.GetRowVariable();
                 auto V_total = result.GetRowVariable();
                 params.ForEachRow(
@@ -424,28 +427,21 @@ namespace miam
                     V_phase,
                     V_total,
                     result_col);
-                for (std::size_t k = 0; k < all_species.size(); ++k)
-                {
-                  if (k < phase_count)
-                    params.ForEachRow(
-                        [molar_vol = all_mw_over_rho[k]](const double& phi, const double& vt, double& dphi)
-                        { dphi = (vt > 0.0) ? molar_vol * (1.0 - phi) / vt : 0.0; },
-                        result_col,
-                        V_total,
-                        partials.GetColumnView(k));
-                  else
-                    params.ForEachRow(
-                        [molar_vol = all_mw_over_rho[k]](const double& phi, const double& vt, double& dphi)
-                        { dphi = (vt > 0.0) ? -molar_vol * phi / vt : 0.0; },
-                        result_col,
-                        V_total,
-                        partials.GetColumnView(k));
-                }
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                std::size_t factor_column = 0;
+                if (phase_count > 0)
+                  params.ForEachRow(
+                      [](const double& phi, const double& vt, double& factor)
+                      { factor = (vt > 0.0) ? (1.0 - phi) / vt : 0.0; },
+                      result_col,
+                      V_total,
+                      partials.GetColumnView(columns.partials_ + factor_column++));
+                if (all_species.size() > phase_count)
+                  params.ForEachRow(
+                      [](const double& phi, const double& vt, double& factor) { factor = (vt > 0.0) ? -phi / vt : 0.0; },
+                      result_col,
+                      V_total,
+                      partials.GetColumnView(columns.partials_ + factor_column));
+              });
           break;
         }
         default:
@@ -45,6 +45,12 @@ namespace miam
     {
     }
 
+    /// @brief Returns the state name prefix of the representation
+    const std::string& Prefix() const
+    {
+      return prefix_;
+    }
+
     std::tuple<std::size_t, std::size_t> StateSize() const
     {
       std::size_t size = 0;
@@ -146,9 +152,6 @@ namespace miam
         const std::string& target_phase_name = "") const
     {
       AerosolPropertyProvider<DenseMatrixPolicy> provider;
-      DenseMatrixPolicy dummy_params{ 1, state_parameter_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_vars{ 1, state_variable_indices.size(), 0.0 };
-      DenseMatrixPolicy dummy_result{ 1, 1, 0.0 };
 
       switch (property)
       {
@@ -169,14 +172,20 @@ namespace miam
                     ps.species_.GetProperty<double>("molecular weight [kg mol-1]") /
                     ps.species_.GetProperty<double>("density [kg m-3]"));
               }
-          // dependent_variable_indices: species first, N last
+          // dependent_variable_indices: species first, N last. ∂r_eff/∂N has its own partials column (0);
+          // ∂r_eff/∂[species_k] = molar_volume_k · r_eff / (3·V_total) is one scaled group (column 1)
           provider.dependent_variable_indices = species_indices;
           provider.dependent_variable_indices.push_back(nc_var_idx);
-          DenseMatrixPolicy dummy_partials{ 1, provider.dependent_variable_indices.size(), 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [gsd_idx, nc_var_idx, species_indices, molar_volumes](auto&& params, auto&& vars, auto&& result)
+          if (!species_indices.empty())
+            provider.scaled_partials.push_back(ScaledPartials::Consecutive(0, molar_volumes));
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [gsd_idx, nc_var_idx, species_indices, molar_volumes](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
-                auto r = result.GetColumnView(0);
+                auto r = result.GetColumnView(columns.value_);
                 params.ForEachRow([](double& v) { v = 0.0; }, r);
                 for (std::size_t k = 0; k < species_indices.size(); ++k)
                   params.ForEachRow(
@@ -195,69 +204,42 @@ namespace miam
                     vars.GetConstColumnView(nc_var_idx),
                     r);
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
               [gsd_idx, nc_var_idx, species_indices, molar_volumes](
-                  auto&& params, auto&& vars, auto&& result, auto&& partials)
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
-                auto r = result.GetColumnView(0);
-                // Accumulate V_total into result
-                params.ForEachRow([](double& v) { v = 0.0; }, r);
+                // r_eff is evaluated once per cell and shared by the partials
+                auto r = result.GetColumnView(columns.value_);
+                auto V_total = result.GetRowVariable();
+                params.ForEachRow([](double& v) { v = 0.0; }, V_total);
                 for (std::size_t k = 0; k < species_indices.size(); ++k)
                   params.ForEachRow(
                       [molar_vol = molar_volumes[k]](const double& c, double& V) { V += c * molar_vol; },
                       vars.GetConstColumnView(species_indices[k]),
-                      r);
-                // Partials w.r.t. species (while r still holds V_total)
-                // ∂r_eff/∂[species_k] = r_eff / (3·V_total) · molar_volume_k [m³ mol⁻¹]
-                for (std::size_t k = 0; k < species_indices.size(); ++k)
-                  params.ForEachRow(
-                      [molar_vol = molar_volumes[k]](const double& gsd, const double& nc, const double& V_total, double& dr)
-                      {
-                        double ln_gsd = std::log(gsd);
-                        double V_mean = V_total / nc;
-                        double r_mean = std::cbrt(3.0 * V_mean / (4.0 * std::numbers::pi));
-                        double r_eff = r_mean * std::exp(2.5 * ln_gsd * ln_gsd);
-                        dr = r_eff * molar_vol / (3.0 * V_total);
-                      },
-                      params.GetConstColumnView(gsd_idx),
-                      vars.GetConstColumnView(nc_var_idx),
-                      r,
-                      partials.GetColumnView(k));
+                      V_total);
                 // Partial w.r.t. N: ∂r_eff/∂N = -r_eff / (3·N)
-                std::size_t N_col = species_indices.size();
                 params.ForEachRow(
-                    [](const double& gsd, const double& nc, const double& V_total, double& dr_dN)
+                    [](const double& gsd, const double& nc, const double& V_total, double& r_eff, double& dr_dN)
                     {
                       double ln_gsd = std::log(gsd);
                       double V_mean = V_total / nc;
                       double r_mean = std::cbrt(3.0 * V_mean / (4.0 * std::numbers::pi));
-                      double r_eff = r_mean * std::exp(2.5 * ln_gsd * ln_gsd);
+                      r_eff = r_mean * std::exp(2.5 * ln_gsd * ln_gsd);
                       dr_dN = -r_eff / (3.0 * nc);
                     },
                     params.GetConstColumnView(gsd_idx),
                     vars.GetConstColumnView(nc_var_idx),
+                    V_total,
                     r,
-                    partials.GetColumnView(N_col));
-                // Now overwrite result with r_eff
-                params.ForEachRow(
-                    [](const double& gsd, const double& nc, double& r_eff)
-                    {
-                      double ln_gsd = std::log(gsd);
-                      double V_mean = r_eff / nc;  // r_eff still holds V_total
-                      double r_mean = std::cbrt(3.0 * V_mean / (4.0 * std::numbers::pi));
-                      r_eff = r_mean * std::exp(2.5 * ln_gsd * ln_gsd);
-                    },
-                    params.GetConstColumnView(gsd_idx),
-                    vars.GetConstColumnView(nc_var_idx),
-                    r);
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                    partials.GetColumnView(columns.partials_));
+                // ∂r_eff/∂[species_k] = molar_volume_k [m³ mol⁻¹] · r_eff / (3·V_total)
+                if (!species_indices.empty())
+                  params.ForEachRow(
+                      [](const double& r_eff, const double& V_total, double& dr_factor)
+                      { dr_factor = r_eff / (3.0 * V_total); },
+                      r,
+                      V_total,
+                      partials.GetColumnView(columns.partials_ + 1));
+              });
           break;
         }
         case AerosolProperty::NumberConcentration:
@@ -265,20 +247,18 @@ namespace miam
           // N = state_variables[NUMBER_CONCENTRATION], d(N)/d(N) = 1
           std::size_t nc_var_idx = state_variable_indices.at(NumberConcentration());
           provider.dependent_variable_indices = { nc_var_idx };
-          DenseMatrixPolicy dummy_partials{ 1, 1, 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [nc_var_idx](auto&& params, auto&& vars, auto&& result)
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [nc_var_idx](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
                 vars.ForEachRow(
                     [](const double& nc, double& N) { N = nc; },
                     vars.GetConstColumnView(nc_var_idx),
-                    result.GetColumnView(0));
+                    result.GetColumnView(columns.value_));
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-              [nc_var_idx](auto&& params, auto&& vars, auto&& result, auto&& partials)
+              [nc_var_idx](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
                 vars.ForEachRow(
                     [](const double& nc, double& N, double& dN_dN)
@@ -287,13 +267,9 @@ namespace miam
                       dN_dN = 1.0;
                     },
                     vars.GetConstColumnView(nc_var_idx),
-                    result.GetColumnView(0),
-                    partials.GetColumnView(0));
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                    result.GetColumnView(columns.value_),
+                    partials.GetColumnView(columns.partials_));
+              });
           break;
         }
         case AerosolProperty::PhaseVolumeFraction:
@@ -301,20 +277,14 @@ namespace miam
           if (phases_.size() == 1)
           {
             provider.dependent_variable_indices = {};
-            DenseMatrixPolicy dummy_partials{ 1, 0, 0.0 };
-            provider.ComputeValue = DenseMatrixPolicy::Function(
-                [](auto&& params, auto&& vars, auto&& result)
-                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(0)); },
-                dummy_params,
-                dummy_vars,
-                dummy_result);
-            provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-                [](auto&& params, auto&& vars, auto&& result, auto&& partials)
-                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(0)); },
-                dummy_params,
-                dummy_vars,
-                dummy_result,
-                dummy_partials);
+            SetPropertyFunctions(
+                provider,
+                state_parameter_indices.size(),
+                state_variable_indices.size(),
+                [](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
+                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(columns.value_)); },
+                [](const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
+                { params.ForEachRow([](double& phi) { phi = 1.0; }, result.GetColumnView(columns.value_)); });
             break;
           }
           if (target_phase_name.empty())
@@ -354,11 +324,23 @@ namespace miam
               }
           }
           provider.dependent_variable_indices = all_species;
-          DenseMatrixPolicy dummy_partials{ 1, all_species.size(), 0.0 };
-          provider.ComputeValue = DenseMatrixPolicy::Function(
-              [all_species, all_molar_volumes, phase_count](auto&& params, auto&& vars, auto&& result)
+          // ∂φ/∂[species_k] = molar_volume_k · (1 - φ) / V_total in the target phase and
+          // -molar_volume_k · φ / V_total in the others: one scaled group per side, one factor per cell
+          if (phase_count > 0)
+            provider.scaled_partials.push_back(
+                ScaledPartials::Consecutive(0, { all_molar_volumes.begin(), all_molar_volumes.begin() + phase_count }));
+          if (all_species.size() > phase_count)
+            provider.scaled_partials.push_back(
+                ScaledPartials::Consecutive(
+                    phase_count, { all_molar_volumes.begin() + phase_count, all_molar_volumes.end() }));
+          SetPropertyFunctions(
+              provider,
+              state_parameter_indices.size(),
+              state_variable_indices.size(),
+              [all_species, all_molar_volumes, phase_count](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result)
               {
-                auto phi = result.GetColumnView(0);
+                auto phi = result.GetColumnView(columns.value_);
                 auto V_phase = result.GetRowVariable();
                 params.ForEachRow(
                     [](double& vt, double& vp)
@@ -389,13 +371,10 @@ namespace miam
                 }
                 params.ForEachRow([](double& phi, const double& vp) { phi = (phi > 0.0) ? vp / phi : 1.0; }, phi, V_phase);
               },
-              dummy_params,
-              dummy_vars,
-              dummy_result);
-          provider.ComputeValueAndDerivatives = DenseMatrixPolicy::Function(
-              [all_species, all_molar_volumes, phase_count](auto&& params, auto&& vars, auto&& result, auto&& partials)
+              [all_species, all_molar_volumes, phase_count](
+                  const PropertyColumns& columns, auto&& params, auto&& vars, auto&& result, auto&& partials)
               {
-                auto result_col = result.GetColumnView(0);
+                auto result_col = result.GetColumnView(columns.value_);
                 auto V_phase = result.GetRowVariable();
                 auto V_total = result.GetRowVariable();
                 params.ForEachRow(
@@ -430,28 +409,21 @@ namespace miam
                     V_phase,
                     V_total,
                     result_col);
-                for (std::size_t k = 0; k < all_species.size(); ++k)
-                {
-                  if (k < phase_count)
-                    params.ForEachRow(
-                        [molar_vol = all_molar_volumes[k]](const double& phi, const double& vt, double& dphi)
-                        { dphi = (vt > 0.0) ? molar_vol * (1.0 - phi) / vt : 0.0; },
-                        result_col,
-                        V_total,
-                        partials.GetColumnView(k));
-                  else
-                    params.ForEachRow(
-                        [molar_vol = all_molar_volumes[k]](const double& phi, const double& vt, double& dphi)
-                        { dphi = (vt > 0.0) ? -molar_vol * phi / vt : 0.0; },
-                        result_col,
-                        V_total,
-                        partials.GetColumnView(k));
-                }
-              },
-              dummy_params,
-              dummy_vars,
-              dummy_result,
-              dummy_partials);
+                std::size_t factor_column = 0;
+                if (phase_count > 0)
+                  params.ForEachRow(
+                      [](const double& phi, const double& vt, double& factor)
+                      { factor = (vt > 0.0) ? (1.0 - phi) / vt : 0.0; },
+                      result_col,
+                      V_total,
+                      partials.GetColumnView(columns.partials_ + factor_column++));
+                if (all_species.size() > phase_count)
+                  params.ForEachRow(
+                      [](const double& phi, const double& vt, double& factor) { factor = (vt > 0.0) ? -phi / vt : 0.0; },
+                      result_col,
+                      V_total,
+                      partials.GetColumnView(columns.partials_ + factor_column));
+              });
           break;
         }
         default:
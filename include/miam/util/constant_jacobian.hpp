@@ -0,0 +1,123 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <miam/model/cell_blocks.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Jacobian contributions that do not depend on the state, assembled once at solver setup
+  /// @details Linear constraints contribute dG/dy = c_i, the same values in every grid cell on every call.
+  ///          Their elements are collected here, duplicates are summed, and Function() lays the values out
+  ///          in the flat storage order of one group of grid cells of the Jacobian. Elements that are
+  ///          adjacent in that storage (e.g. the row of a linear constraint) form one run, so each call adds
+  ///          every run of precomputed values to every cell group with a single contiguous loop.
+  class ConstantJacobian
+  {
+   public:
+    /// @brief A constant element and the value added to it
+    struct Element
+    {
+      std::size_t dependent_;    ///< Row index
+      std::size_t independent_;  ///< Column index
+      double value_;             ///< Value added to the stored Jacobian (which holds -J, see micm)
+    };
+
+    /// @brief Appends a constant element; duplicates are summed by Function()
+    /// @param dependent Row index (the forcing or residual being differentiated)
+    /// @param independent Column index (the state variable differentiated with respect to)
+    /// @param value Value added to the stored Jacobian element on every call
+    void Add(std::size_t dependent, std::size_t independent, double value)
+    {
+      elements_.push_back(Element{ dependent, independent, value });
+    }
+
+    /// @brief Appends all elements of another set of constant contributions
+    void Append(const ConstantJacobian& other)
+    {
+      elements_.insert(elements_.end(), other.elements_.begin(), other.elements_.end());
+    }
+
+    /// @brief Returns true if no element has been added
+    bool Empty() const
+    {
+      return elements_.empty();
+    }
+
+    /// @brief Returns the appended elements
+    const std::vector<Element>& Elements() const
+    {
+      return elements_;
+    }
+
+    /// @brief Returns a function that adds the constant contributions to a Jacobian
+    /// @param jacobian Jacobian with the sparsity pattern of the matrices the function will be called on
+    template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+    std::function<void(const DenseMatrixPolicy&, const DenseMatrixPolicy&, SparseMatrixPolicy&)> Function(
+        const SparseMatrixPolicy& jacobian) const
+    {
+      constexpr std::size_t L = CellGroupSize<SparseMatrixPolicy>();
+
+      // Flat offsets in the first cell group; block 0 of element k starts at k * L
+      std::vector<std::pair<std::size_t, double>> offsets;
+      offsets.reserve(elements_.size());
+      for (const auto& element : elements_)
+        offsets.emplace_back(jacobian.VectorIndex(0, element.dependent_, element.independent_), element.value_);
+      std::sort(offsets.begin(), offsets.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+      std::vector<Run> runs;
+      std::vector<double> values;
+      for (std::size_t i = 0; i < offsets.size();)
+      {
+        double value = 0.0;
+        const std::size_t offset = offsets[i].first;
+        for (; i < offsets.size() && offsets[i].first == offset; ++i)
+          value += offsets[i].second;
+        if (runs.empty() || runs.back().offset_ + runs.back().size_ != offset)
+          runs.push_back(Run{ offset, values.size(), 0 });
+        values.insert(values.end(), L, value);
+        runs.back().size_ += L;
+      }
+
+      return [runs = std::move(runs), values = std::move(values)](
+                 const DenseMatrixPolicy& /*state_variables*/,
+                 const DenseMatrixPolicy& /*state_parameters*/,
+                 SparseMatrixPolicy& jacobian_values)
+      {
+        auto& data = jacobian_values.AsVector();
+        const std::size_t group_stride = L * ValuesPerCell(jacobian_values);
+        const std::size_t number_of_groups = (jacobian_values.NumberOfBlocks() + L - 1) / L;
+        const double* source = values.data();
+        for (std::size_t group = 0; group < number_of_groups; ++group)
+        {
+          double* group_data = data.data() + group * group_stride;
+          for (const auto& run : runs)
+          {
+            double* destination = group_data + run.offset_;
+            const double* run_values = source + run.first_value_;
+            for (std::size_t i = 0; i < run.size_; ++i)
+              destination[i] += run_values[i];
+          }
+        }
+      };
+    }
+
+   private:
+    /// @brief Elements that are contiguous in the flat storage of a cell group
+    struct Run
+    {
+      std::size_t offset_;       ///< Flat offset of the first element in the cell group
+      std::size_t first_value_;  ///< Position of the run's values in the precomputed values
+      std::size_t size_;         ///< Number of stored values (elements x cells per group)
+    };
+
+    std::vector<Element> elements_;  ///< Appended elements, possibly with duplicates
+  };
+}  // namespace miam
@@ -20,3 +20,5 @@
 #define MIAM_INTERNAL_MISSING_STATE_PARAMETER 101
 #define MIAM_INTERNAL_MISSING_STATE_VARIABLE  102
 #define MIAM_INTERNAL_DUPLICATE_STATE_PREFIX  103
+#define MIAM_INTERNAL_UNMOVABLE_PROVIDER      104
+#define MIAM_INTERNAL_UNSUPPORTED_MATRIX      105
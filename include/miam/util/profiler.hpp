@@ -0,0 +1,157 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Model function a profile entry is recorded for
+  enum class ProfiledFunction
+  {
+    UpdateStateParameters,  ///< Process and constraint state parameter updates
+    Forcing,                ///< Process forcing
+    Jacobian,               ///< Process Jacobian
+    ConstraintResidual,     ///< Constraint residual
+    ConstraintJacobian      ///< Constraint Jacobian
+  };
+
+  /// @brief Returns the name of a profiled function
+  inline std::string ToString(ProfiledFunction function)
+  {
+    switch (function)
+    {
+      case ProfiledFunction::UpdateStateParameters: return "UpdateStateParameters";
+      case ProfiledFunction::Forcing: return "Forcing";
+      case ProfiledFunction::Jacobian: return "Jacobian";
+      case ProfiledFunction::ConstraintResidual: return "ConstraintResidual";
+      case ProfiledFunction::ConstraintJacobian: return "ConstraintJacobian";
+    }
+    return "Unknown";
+  }
+
+  /// @brief Accumulated statistics of one profiled function of one process or constraint
+  struct ProfileEntry
+  {
+    std::string type_;            ///< Process or constraint type (e.g. "HenryLawPhaseTransfer"), or "Model"
+    std::string uuid_;            ///< UUID of the process or constraint, or the Model name
+    ProfiledFunction function_;   ///< Model function the statistics belong to
+    std::uint64_t calls_{ 0 };    ///< Number of calls
+    std::uint64_t cells_{ 0 };    ///< Number of grid cells processed, summed over calls
+    double seconds_{ 0.0 };       ///< Wall time, summed over calls (and over threads for parallel evaluation)
+  };
+
+  /// @brief Thread-safe collection of per-process and per-constraint call statistics
+  /// @details Counters are registered once, when a Model function is built, and updated with relaxed
+  ///          atomic additions on every call, so functions evaluated on a ThreadPool can share them.
+  ///          Registering the same type, UUID and function again returns the existing counter, so the
+  ///          function copies of a parallel evaluation accumulate into one entry.
+  class Profiler
+  {
+   public:
+    /// @brief Lock-free accumulator of one profile entry
+    class Counter
+    {
+     public:
+      /// @brief Records one call
+      void Add(std::size_t number_of_cells, std::chrono::steady_clock::duration elapsed)
+      {
+        calls_.fetch_add(1, std::memory_order_relaxed);
+        cells_.fetch_add(number_of_cells, std::memory_order_relaxed);
+        nanoseconds_.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), std::memory_order_relaxed);
+      }
+
+     private:
+      friend class Profiler;
+      std::atomic<std::uint64_t> calls_{ 0 };
+      std::atomic<std::uint64_t> cells_{ 0 };
+      std::atomic<std::int64_t> nanoseconds_{ 0 };
+    };
+
+    /// @brief Returns the counter of a profile entry, creating it if needed
+    std::shared_ptr<Counter> Register(const std::string& type, const std::string& uuid, ProfiledFunction function)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& counter = counters_[std::make_tuple(type, uuid, function)];
+      if (!counter)
+        counter = std::make_shared<Counter>();
+      return counter;
+    }
+
+    /// @brief Returns the statistics of every registered entry, ordered by type, UUID and function
+    std::vector<ProfileEntry> Report() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<ProfileEntry> entries;
+      entries.reserve(counters_.size());
+      for (const auto& [key, counter] : counters_)
+      {
+        const auto nanoseconds = counter->nanoseconds_.load(std::memory_order_relaxed);
+        entries.push_back(ProfileEntry{ std::get<0>(key),
+                                        std::get<1>(key),
+                                        std::get<2>(key),
+                                        counter->calls_.load(std::memory_order_relaxed),
+                                        counter->cells_.load(std::memory_order_relaxed),
+                                        1.0e-9 * static_cast<double>(nanoseconds) });
+      }
+      return entries;
+    }
+
+    /// @brief Zeroes every counter; registered entries are kept
+    void Reset()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto& [key, counter] : counters_)
+      {
+        counter->calls_.store(0, std::memory_order_relaxed);
+        counter->cells_.store(0, std::memory_order_relaxed);
+        counter->nanoseconds_.store(0, std::memory_order_relaxed);
+      }
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::map<std::tuple<std::string, std::string, ProfiledFunction>, std::shared_ptr<Counter>> counters_;
+  };
+
+  /// @brief Returns the number of grid cells of a dense or sparse matrix, or of a vector of conditions
+  template<typename T>
+  std::size_t ProfiledCells(const T& values)
+  {
+    if constexpr (requires { values.NumberOfBlocks(); })
+      return values.NumberOfBlocks();
+    else if constexpr (requires { values.NumRows(); })
+      return values.NumRows();
+    else
+      return values.size();
+  }
+
+  /// @brief Wraps a Model function so that every call is recorded in a profile counter
+  /// @details The number of cells is taken from the last argument, which is the output of every Model function.
+  template<typename... Args>
+  std::function<void(Args...)> ProfileFunction(
+      std::function<void(Args...)> function,
+      std::shared_ptr<Profiler::Counter> counter)
+  {
+    return [function = std::move(function), counter = std::move(counter)](Args... args)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      function(args...);
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      counter->Add(ProfiledCells(std::get<sizeof...(Args) - 1>(std::forward_as_tuple(args...))), elapsed);
+    };
+  }
+}  // namespace miam
@@ -0,0 +1,114 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Flat builder for the non-zero (dependent, independent) positions of a Jacobian
+  /// @details Processes and constraints append their elements without checking for duplicates; the
+  ///          pattern is sorted and deduplicated once by Finalize(). This keeps solver setup linear in
+  ///          the number of appended elements up to a single sort, instead of one tree-node allocation
+  ///          and merge per element as with std::set.
+  ///
+  ///          A finalized pattern lists its elements in the same (row-major) order as
+  ///          std::set<std::pair<std::size_t, std::size_t>>, so ToSet() and iteration are interchangeable.
+  class SparsityPattern
+  {
+   public:
+    using Element = std::pair<std::size_t, std::size_t>;
+
+    /// @brief Reserves space for at least `number_of_elements` appended elements
+    void Reserve(std::size_t number_of_elements)
+    {
+      elements_.reserve(number_of_elements);
+    }
+
+    /// @brief Appends one element; duplicates are removed by Finalize()
+    /// @param dependent Row index (the forcing or residual being differentiated)
+    /// @param independent Column index (the state variable differentiated with respect to)
+    void Add(std::size_t dependent, std::size_t independent)
+    {
+      elements_.emplace_back(dependent, independent);
+      is_finalized_ = false;
+    }
+
+    /// @brief Appends all elements of another pattern
+    void Append(const SparsityPattern& other)
+    {
+      if (other.elements_.empty())
+        return;
+      elements_.insert(elements_.end(), other.elements_.begin(), other.elements_.end());
+      is_finalized_ = false;
+    }
+
+    /// @brief Sorts the elements and removes duplicates
+    /// @return The sorted, unique elements
+    const std::vector<Element>& Finalize()
+    {
+      if (!is_finalized_)
+      {
+        std::sort(elements_.begin(), elements_.end());
+        elements_.erase(std::unique(elements_.begin(), elements_.end()), elements_.end());
+        is_finalized_ = true;
+      }
+      return elements_;
+    }
+
+    /// @brief Returns true if the pattern has been finalized since the last append
+    bool IsFinalized() const
+    {
+      return is_finalized_;
+    }
+
+    /// @brief Returns the elements (sorted and unique only once finalized)
+    const std::vector<Element>& Elements() const
+    {
+      return elements_;
+    }
+
+    /// @brief Returns the number of elements (unique only once finalized)
+    std::size_t Size() const
+    {
+      return elements_.size();
+    }
+
+    /// @brief Returns true if a finalized pattern contains the element
+    bool Contains(std::size_t dependent, std::size_t independent) const
+    {
+      return std::binary_search(elements_.begin(), elements_.end(), Element{ dependent, independent });
+    }
+
+    /// @brief Returns the finalized elements as a std::set
+    /// @details The elements are already sorted, so each insertion is hinted at the end of the set
+    ///          and the conversion is linear in the number of unique elements.
+    std::set<Element> ToSet()
+    {
+      Finalize();
+      std::set<Element> set;
+      for (const auto& element : elements_)
+        set.emplace_hint(set.end(), element);
+      return set;
+    }
+
+    std::vector<Element>::const_iterator begin() const
+    {
+      return elements_.begin();
+    }
+
+    std::vector<Element>::const_iterator end() const
+    {
+      return elements_.end();
+    }
+
+   private:
+    std::vector<Element> elements_;
+    bool is_finalized_{ true };
+  };
+}  // namespace miam
@@ -0,0 +1,148 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Fixed-size pool of worker threads for data-parallel loops
+  /// @details The pool starts its workers once and reuses them for every ParallelFor() call, so a
+  ///          parallel evaluation costs two condition-variable handshakes rather than thread creation.
+  ///          The calling thread takes part in the work, so a pool of N threads starts N - 1 workers
+  ///          and a pool of one thread runs every loop inline.
+  ///
+  ///          ParallelFor() calls from different threads are serialized. A ParallelFor() task must not
+  ///          call ParallelFor() on the same pool.
+  class ThreadPool
+  {
+   public:
+    /// @brief Creates a pool
+    /// @param number_of_threads Total number of threads, including the caller of ParallelFor();
+    ///        0 selects std::thread::hardware_concurrency()
+    explicit ThreadPool(std::size_t number_of_threads = 0)
+    {
+      if (number_of_threads == 0)
+        number_of_threads = std::max(1u, std::thread::hardware_concurrency());
+      workers_.reserve(number_of_threads - 1);
+      for (std::size_t i = 1; i < number_of_threads; ++i)
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      start_.notify_all();
+      for (auto& worker : workers_)
+        worker.join();
+    }
+
+    /// @brief Returns the total number of threads, including the calling thread
+    std::size_t NumberOfThreads() const
+    {
+      return workers_.size() + 1;
+    }
+
+    /// @brief Runs task(i) for every i in [0, number_of_tasks) and waits for all of them
+    /// @details Tasks are handed out dynamically, so which thread runs a task is unspecified.
+    ///          If any task throws, the remaining tasks still run and the first exception is
+    ///          rethrown to the caller.
+    void ParallelFor(std::size_t number_of_tasks, const std::function<void(std::size_t)>& task)
+    {
+      if (workers_.empty() || number_of_tasks <= 1)
+      {
+        for (std::size_t i = 0; i < number_of_tasks; ++i)
+          task(i);
+        return;
+      }
+      std::lock_guard<std::mutex> call_lock(call_mutex_);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        number_of_tasks_ = number_of_tasks;
+        next_task_.store(0, std::memory_order_relaxed);
+        busy_workers_ = workers_.size();
+        error_ = nullptr;
+        ++generation_;
+      }
+      start_.notify_all();
+      RunTasks();
+      std::exception_ptr error;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return busy_workers_ == 0; });
+        task_ = nullptr;
+        error = error_;
+      }
+      if (error)
+        std::rethrow_exception(error);
+    }
+
+   private:
+    std::vector<std::thread> workers_;                         ///< Worker threads (the caller is the extra thread)
+    std::mutex call_mutex_;                                    ///< Serializes ParallelFor() calls
+    std::mutex mutex_;                                         ///< Guards the loop state below
+    std::condition_variable start_;                            ///< Signals a new loop (or shutdown) to the workers
+    std::condition_variable done_;                             ///< Signals the caller that all workers finished
+    const std::function<void(std::size_t)>* task_{ nullptr };  ///< Task of the current loop
+    std::size_t number_of_tasks_{ 0 };                         ///< Number of tasks in the current loop
+    std::atomic<std::size_t> next_task_{ 0 };                  ///< Next task index to hand out
+    std::size_t busy_workers_{ 0 };                            ///< Workers still running the current loop
+    std::size_t generation_{ 0 };                              ///< Loop counter; workers wake when it changes
+    std::exception_ptr error_;                                 ///< First exception thrown by a task
+    bool stop_{ false };                                       ///< Set when the pool is destroyed
+
+    void WorkerLoop()
+    {
+      std::size_t seen_generation = 0;
+      while (true)
+      {
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          start_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+          if (stop_)
+            return;
+          seen_generation = generation_;
+        }
+        RunTasks();
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (--busy_workers_ == 0)
+            done_.notify_one();
+        }
+      }
+    }
+
+    void RunTasks()
+    {
+      for (std::size_t i = next_task_.fetch_add(1); i < number_of_tasks_; i = next_task_.fetch_add(1))
+      {
+        try
+        {
+          (*task_)(i);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (!error_)
+            error_ = std::current_exception();
+        }
+      }
+    }
+  };
+}  // namespace miam
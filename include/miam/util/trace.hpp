@@ -0,0 +1,224 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace miam
+{
+  /// @brief Bounded in-memory buffer of timed spans, written out as Chrome trace-event JSON
+  /// @details Span kinds (a name, a category and an optional UUID) are registered once, when a Model
+  ///          function is built, and every span records only the kind index, the calling thread and its
+  ///          start and end times. Spans are kept in a ring buffer of fixed capacity: once it is full, each
+  ///          new span overwrites the oldest one, so tracing a long run keeps only its most recent spans.
+  ///
+  ///          The JSON written by WriteChromeTrace() opens in chrome://tracing and ui.perfetto.dev. Each
+  ///          thread that recorded a span appears as its own track.
+  class TraceSink
+  {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Creates a sink
+    /// @param capacity Maximum number of buffered spans (at least 1)
+    explicit TraceSink(std::size_t capacity = 1 << 20)
+        : events_(std::max(capacity, std::size_t(1))),
+          origin_(Clock::now())
+    {
+    }
+
+    TraceSink(const TraceSink&) = delete;
+    TraceSink& operator=(const TraceSink&) = delete;
+
+    /// @brief Returns the index of a span kind, registering it if needed
+    /// @param name Span name (e.g. "DissolvedReaction::Forcing")
+    /// @param category Span category (e.g. "process")
+    /// @param uuid UUID of the process or constraint, written as a span argument when not empty
+    std::size_t RegisterEvent(const std::string& name, const std::string& category, const std::string& uuid = "")
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto [it, inserted] = event_indices_.try_emplace(std::make_tuple(name, category, uuid), kinds_.size());
+      if (inserted)
+        kinds_.push_back(EventKind{ name, category, uuid });
+      return it->second;
+    }
+
+    /// @brief Records a span of a registered kind on the calling thread
+    void Record(std::size_t event, Clock::time_point start, Clock::time_point end)
+    {
+      const Event recorded{ event, ThreadIndex(), start, end };
+      std::lock_guard<std::mutex> lock(mutex_);
+      events_[number_of_recorded_events_ % events_.size()] = recorded;
+      ++number_of_recorded_events_;
+    }
+
+    /// @brief Returns the maximum number of buffered spans
+    std::size_t Capacity() const
+    {
+      return events_.size();
+    }
+
+    /// @brief Returns the number of buffered spans
+    std::size_t NumberOfEvents() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return std::min(number_of_recorded_events_, events_.size());
+    }
+
+    /// @brief Returns the number of spans overwritten because the buffer was full
+    std::size_t NumberOfDroppedEvents() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return number_of_recorded_events_ - std::min(number_of_recorded_events_, events_.size());
+    }
+
+    /// @brief Discards the buffered spans; registered span kinds are kept
+    void Clear()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      number_of_recorded_events_ = 0;
+    }
+
+    /// @brief Writes the buffered spans, oldest first, as a Chrome trace-event JSON object
+    /// @details Spans are complete ("X") events with microsecond timestamps relative to the creation of
+    ///          the sink, process id 1, and thread ids numbered in order of each thread's first span.
+    void WriteChromeTrace(std::ostream& os) const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const std::size_t count = std::min(number_of_recorded_events_, events_.size());
+      const std::size_t first = number_of_recorded_events_ - count;
+      os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const auto& event = events_[(first + i) % events_.size()];
+        const auto& kind = kinds_[event.kind_];
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << Escape(kind.name_) << "\",\"cat\":\""
+           << Escape(kind.category_) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread_
+           << ",\"ts\":" << Microseconds(event.start_ - origin_)
+           << ",\"dur\":" << Microseconds(event.end_ - event.start_);
+        if (!kind.uuid_.empty())
+          os << ",\"args\":{\"uuid\":\"" << Escape(kind.uuid_) << "\"}";
+        os << "}";
+      }
+      os << "\n]}\n";
+    }
+
+   private:
+    /// @brief A registered span kind
+    struct EventKind
+    {
+      std::string name_;
+      std::string category_;
+      std::string uuid_;
+    };
+
+    /// @brief A recorded span
+    struct Event
+    {
+      std::size_t kind_{ 0 };
+      std::uint32_t thread_{ 0 };
+      Clock::time_point start_{};
+      Clock::time_point end_{};
+    };
+
+    mutable std::mutex mutex_;                                                          ///< Guards the members below
+    std::vector<EventKind> kinds_;                                                      ///< Registered span kinds
+    std::map<std::tuple<std::string, std::string, std::string>, std::size_t> event_indices_;  ///< Kind lookup
+    std::vector<Event> events_;                                                         ///< Ring buffer of spans
+    std::size_t number_of_recorded_events_{ 0 };                                        ///< Spans recorded since Clear()
+    Clock::time_point origin_;                                                          ///< Time zero of the trace
+
+    /// @brief Returns a small, process-wide index of the calling thread
+    static std::uint32_t ThreadIndex()
+    {
+      static std::atomic<std::uint32_t> next_index{ 0 };
+      thread_local const std::uint32_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+      return index;
+    }
+
+    static double Microseconds(Clock::duration duration)
+    {
+      return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    static std::string Escape(const std::string& text)
+    {
+      std::string escaped;
+      escaped.reserve(text.size());
+      for (const char c : text)
+      {
+        if (c == '"' || c == '\\')
+        {
+          escaped += '\\';
+          escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char code[8];
+          std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+          escaped += code;
+        }
+        else
+        {
+          escaped += c;
+        }
+      }
+      return escaped;
+    }
+  };
+
+  /// @brief Records a span in a TraceSink for the lifetime of the object
+  /// @details Does nothing when constructed with a null sink.
+  class TraceSpan
+  {
+   public:
+    TraceSpan(TraceSink* sink, std::size_t event)
+        : sink_(sink),
+          event_(event)
+    {
+      if (sink_)
+        start_ = TraceSink::Clock::now();
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    ~TraceSpan()
+    {
+      if (sink_)
+        sink_->Record(event_, start_, TraceSink::Clock::now());
+    }
+
+   private:
+    TraceSink* sink_;
+    std::size_t event_;
+    TraceSink::Clock::time_point start_{};
+  };
+
+  /// @brief Wraps a Model function so that every call is recorded as a span
+  template<typename... Args>
+  std::function<void(Args...)>
+  TraceFunction(std::function<void(Args...)> function, std::shared_ptr<TraceSink> sink, std::size_t event)
+  {
+    return [function = std::move(function), sink = std::move(sink), event](Args... args)
+    {
+      TraceSpan span(sink.get(), event);
+      function(args...);
+    };
+  }
+}  // namespace miam
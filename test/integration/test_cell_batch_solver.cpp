@@ -0,0 +1,115 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/miam.hpp>
+#include <miam/model/cell_batch_solver.hpp>
+
+#include <micm/CPU.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace micm;
+using namespace miam;
+
+// ============================================================================
+// Cloudy and clear cells solved in batches
+// A cloud section (A -> B in water) is present only where its water exceeds a
+// threshold; an aerosol section (C -> D in an organic solvent) is present in
+// every cell. Clear cells are solved with the aerosol-only Model variant.
+// ============================================================================
+TEST(CellBatchSolverIntegration, CloudyAndClearCells)
+{
+  constexpr std::size_t number_of_cells = 4;
+  auto A = Species{ "A" };
+  auto B = Species{ "B" };
+  auto C = Species{ "C" };
+  auto D = Species{ "D" };
+  auto H2O = Species{ "H2O" };
+  auto ORG = Species{ "ORG" };
+
+  auto aqueous_phase = Phase{ "AQUEOUS", { { A }, { B }, { H2O } } };
+  auto organic_phase = Phase{ "ORGANIC", { { C }, { D }, { ORG } } };
+  auto cloud = UniformSection{ "CLOUD", { aqueous_phase } };
+  auto aerosol = UniformSection{ "AEROSOL", { organic_phase } };
+
+  const double k_cloud = 0.1;
+  const double k_aerosol = 0.02;
+  auto cloud_rate = [k_cloud](const Conditions& conditions) { return k_cloud; };
+  auto aerosol_rate = [k_aerosol](const Conditions& conditions) { return k_aerosol; };
+
+  auto model = Model{ .name_ = "AEROSOL", .representations_ = { cloud, aerosol } };
+  model.AddProcesses(
+      { DissolvedReactionBuilder{}
+            .SetPhase(aqueous_phase)
+            .SetReactants({ A })
+            .SetProducts({ B })
+            .SetSolvent(H2O)
+            .AddRateConstant("CLOUD", cloud_rate)
+            .Build(),
+        DissolvedReactionBuilder{}
+            .SetPhase(organic_phase)
+            .SetReactants({ C })
+            .SetProducts({ D })
+            .SetSolvent(ORG)
+            .AddRateConstant("AEROSOL", aerosol_rate)
+            .Build() });
+  model.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 1.0e-8 };
+
+  auto system = System(Phase{ "GAS", {} });
+  auto make_solver = [&system](const Model& variant)
+  {
+    return CpuSolverBuilder<RosenbrockSolverParameters>(RosenbrockSolverParameters::ThreeStageRosenbrockParameters())
+        .SetSystem(system)
+        .AddExternalModel(variant)
+        .SetIgnoreUnusedSpecies(true)
+        .Build();
+  };
+  auto full_solver = make_solver(model);
+  State state = full_solver.GetState(number_of_cells);
+
+  const std::size_t i_A = state.variable_map_.at("CLOUD.AQUEOUS.A");
+  const std::size_t i_B = state.variable_map_.at("CLOUD.AQUEOUS.B");
+  const std::size_t i_water = state.variable_map_.at("CLOUD.AQUEOUS.H2O");
+  const std::size_t i_C = state.variable_map_.at("AEROSOL.ORGANIC.C");
+  const std::size_t i_D = state.variable_map_.at("AEROSOL.ORGANIC.D");
+  const std::size_t i_org = state.variable_map_.at("AEROSOL.ORGANIC.ORG");
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+  {
+    const bool cloudy = cell % 2 == 0;
+    state.variables_[cell][i_A] = 1.0;
+    state.variables_[cell][i_B] = 0.0;
+    state.variables_[cell][i_water] = cloudy ? 1.0e-4 : 0.0;
+    state.variables_[cell][i_C] = 1.0;
+    state.variables_[cell][i_D] = 0.0;
+    state.variables_[cell][i_org] = 1.0e-6;
+    state.conditions_[cell].temperature_ = 298.15;
+    state.conditions_[cell].pressure_ = 101325.0;
+  }
+  cloud.SetDefaultParameters(state);
+  aerosol.SetDefaultParameters(state);
+
+  CellBatchSolver batch_solver(model, make_solver);
+  const double time_step = 0.01;
+  double time = 0.0;
+  for (std::size_t step = 0; step < 1000; ++step)
+  {
+    for (const auto& batch : batch_solver.Solve(time_step, state))
+      ASSERT_EQ(batch.result_.state_, SolverState::Converged) << "Solver failed at t = " << time << " s";
+    time += time_step;
+  }
+  EXPECT_EQ(batch_solver.NumberOfVariants(), 2);
+
+  const double tolerance = 2.0e-4;
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+  {
+    const bool cloudy = cell % 2 == 0;
+    const double A_expected = cloudy ? std::exp(-k_cloud * time) : 1.0;
+    EXPECT_NEAR(state.variables_[cell][i_A], A_expected, tolerance) << "cell " << cell;
+    EXPECT_NEAR(state.variables_[cell][i_B], 1.0 - A_expected, tolerance) << "cell " << cell;
+    EXPECT_EQ(state.variables_[cell][i_water], cloudy ? 1.0e-4 : 0.0) << "cell " << cell;
+    EXPECT_NEAR(state.variables_[cell][i_C], std::exp(-k_aerosol * time), tolerance) << "cell " << cell;
+    EXPECT_NEAR(state.variables_[cell][i_D], 1.0 - std::exp(-k_aerosol * time), tolerance) << "cell " << cell;
+  }
+}
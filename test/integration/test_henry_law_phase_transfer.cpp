@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 using namespace micm;
 using namespace miam;
@@ -514,3 +515,98 @@ TEST(HenryLawPhaseTransferIntegration, SmallVsLargeParticleRate)
   EXPECT_GT(transfer_small, 0.0);
   EXPECT_GT(transfer_large, 0.0);
 }
+
+// ============================================================================
+// Test 5: Frozen aerosol properties through a real Solve
+// ============================================================================
+TEST(HenryLawPhaseTransferIntegration, FrozenAerosolProperties)
+{
+  // Same system as Test 2, solved with the aerosol properties held fixed for each Solve
+  auto A_g = MakeGasSpecies("A_g", 0.030);
+  auto A_aq = MakeCondensedSpecies("A_aq", 0.030, 1200.0);
+  auto H2O = MakeCondensedSpecies("H2O", 0.018, 1000.0);
+
+  Phase gas_phase{ "GAS", { { A_g } } };
+  Phase aqueous_phase{ "AQUEOUS", { { A_aq }, { H2O } } };
+
+  auto small_drop = SingleMomentMode{ "SMALL", { aqueous_phase }, 1.0e-6, 1.2 };
+  auto large_drop = SingleMomentMode{ "LARGE", { aqueous_phase }, 1.0e-5, 1.4 };
+
+  auto transfer = HenryLawPhaseTransferBuilder()
+                      .SetCondensedPhase(aqueous_phase)
+                      .SetGasSpecies(A_g)
+                      .SetCondensedSpecies(A_aq)
+                      .SetSolvent(H2O)
+                      .SetHenryLawConstant(HenryLawConstant(HenryLawConstantParameters{ .HLC_ref_ = 3.2e3 }))
+                      .SetDiffusionCoefficient(1.8e-5)
+                      .SetAccommodationCoefficient(0.1)
+                      .Build();
+
+  auto live = Model{ .name_ = "CLOUD", .representations_ = { small_drop, large_drop } };
+  live.AddProcesses({ transfer });
+  auto frozen = live;
+  frozen.options_.frozen_aerosol_properties_ = true;
+
+  double gas_0 = 1.0e-2;
+  double solvent = 0.017;
+  auto run = [&](const Model& model)
+  {
+    auto solver =
+        CpuSolverBuilder<RosenbrockSolverParameters>(RosenbrockSolverParameters::ThreeStageRosenbrockParameters())
+            .SetSystem(System(gas_phase))
+            .AddExternalModel(model)
+            .SetIgnoreUnusedSpecies(true)
+            .Build();
+    State state = solver.GetState();
+    state.variables_[0][state.variable_map_.at("A_g")] = gas_0;
+    state.variables_[0][state.variable_map_.at("SMALL.AQUEOUS.A_aq")] = 0.0;
+    state.variables_[0][state.variable_map_.at("SMALL.AQUEOUS.H2O")] = solvent;
+    state.variables_[0][state.variable_map_.at("LARGE.AQUEOUS.A_aq")] = 0.0;
+    state.variables_[0][state.variable_map_.at("LARGE.AQUEOUS.H2O")] = solvent;
+    state.conditions_[0].temperature_ = 298.15;
+    state.conditions_[0].pressure_ = 101325.0;
+    small_drop.SetDefaultParameters(state);
+    large_drop.SetDefaultParameters(state);
+
+    // The frozen properties have state parameter columns, and each Solve computes them from its initial state
+    using DenseMatrixPolicy = decltype(state.variables_);
+    auto expected_parameters = state.custom_rate_parameters_;
+    auto update_frozen_properties =
+        model.UpdateFrozenPropertiesFunction<DenseMatrixPolicy>(state.custom_rate_parameter_map_, state.variable_map_);
+    for (const auto& name : model.FrozenPropertyParameterNames())
+      EXPECT_TRUE(state.custom_rate_parameter_map_.contains(name)) << name;
+
+    double time = 0.0;
+    double total_time = 0.1;
+    double dt = 0.001;
+    while (time < total_time - 1.0e-15)
+    {
+      double step = std::min(dt, total_time - time);
+      solver.UpdateStateParameters(state);
+      expected_parameters = state.custom_rate_parameters_;
+      update_frozen_properties(state.variables_, expected_parameters);
+      auto result = solver.Solve(step, state);
+      EXPECT_EQ(result.state_, SolverState::Converged) << "Solver failed at t = " << time;
+      for (const auto& name : model.FrozenPropertyParameterNames())
+      {
+        std::size_t i_param = state.custom_rate_parameter_map_.at(name);
+        EXPECT_EQ(state.custom_rate_parameters_[0][i_param], expected_parameters[0][i_param]) << name;
+        EXPECT_GT(state.custom_rate_parameters_[0][i_param], 0.0) << name;
+      }
+      time += step;
+    }
+    return std::vector<double>{ state.variables_[0][state.variable_map_.at("A_g")],
+                                state.variables_[0][state.variable_map_.at("SMALL.AQUEOUS.A_aq")],
+                                state.variables_[0][state.variable_map_.at("LARGE.AQUEOUS.A_aq")] };
+  };
+
+  auto live_final = run(live);
+  auto frozen_final = run(frozen);
+  ASSERT_FALSE(frozen.FrozenPropertyParameterNames().empty());
+
+  // Mass is conserved and the result follows the live-property solution
+  EXPECT_NEAR(frozen_final[0] + frozen_final[1] + frozen_final[2], gas_0, gas_0 * 1e-4);
+  EXPECT_LT(frozen_final[0], gas_0);
+  for (std::size_t i = 0; i < live_final.size(); ++i)
+    EXPECT_NEAR(frozen_final[i], live_final[i], std::abs(live_final[i]) * 5.0e-2) << i;
+}
@@ -0,0 +1,370 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/constraints/linear_constraint_builder.hpp>
+#include <miam/model/active_cells.hpp>
+#include <miam/model/cell_batch_solver.hpp>
+#include <miam/model/model.hpp>
+#include <miam/processes/dissolved_reaction.hpp>
+#include <miam/processes/henry_law_phase_transfer.hpp>
+#include <miam/representations/single_moment_mode.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  using DenseMatrix = micm::Matrix<double>;
+  using SparseMatrix = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+
+  template<typename DenseMatrixPolicy>
+  void CheckGatherAndScatter()
+  {
+    DenseMatrixPolicy matrix(7, 3, 0.0);
+    for (std::size_t i = 0; i < 7; ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+        matrix[i][j] = 10.0 * i + j;
+    const std::vector<std::size_t> cells{ 1, 4, 5, 6 };
+    DenseMatrixPolicy compact(cells.size(), 3, 0.0);
+    GatherCells(matrix, cells, compact);
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+        EXPECT_EQ(compact[i][j], 10.0 * cells[i] + j);
+
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+        compact[i][j] = -1.0;
+    ScatterCells(compact, cells, matrix);
+    for (std::size_t i = 0; i < 7; ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+        EXPECT_EQ(matrix[i][j], (i == 0 || i == 2 || i == 3) ? 10.0 * i + j : -1.0) << i << " " << j;
+  }
+
+  /// A cloud mode (aqueous phase) and an aerosol mode (organic phase), each with its own reaction
+  Model MakeTwoModeModel()
+  {
+    auto h2o = micm::Species{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    auto a_g = micm::Species{ "A_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+    auto a_aq = micm::Species{ "A_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } };
+    auto b_aq = micm::Species{ "B_aq", { { "molecular weight [kg mol-1]", 0.062 }, { "density [kg m-3]", 1500.0 } } };
+    auto org = micm::Species{ "ORG", { { "molecular weight [kg mol-1]", 0.2 }, { "density [kg m-3]", 1400.0 } } };
+    auto c_org = micm::Species{ "C_org", { { "molecular weight [kg mol-1]", 0.1 }, { "density [kg m-3]", 1300.0 } } };
+    auto d_org = micm::Species{ "D_org", { { "molecular weight [kg mol-1]", 0.1 }, { "density [kg m-3]", 1300.0 } } };
+    auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a_aq }, { b_aq } } };
+    auto organic_phase = micm::Phase{ "ORGANIC", { { org }, { c_org }, { d_org } } };
+
+    auto hlc = [](const micm::Conditions& conditions) { return 3.4e-2; };
+    auto k = [](const micm::Conditions& conditions) { return 4.0e-3; };
+
+    Model model;
+    model.name_ = "MASKED";
+    model.representations_.push_back(SingleMomentMode{ "CLOUD", { aqueous_phase } });
+    model.representations_.push_back(SingleMomentMode{ "AEROSOL", { organic_phase } });
+    model.AddProcesses(
+        HenryLawPhaseTransfer{ hlc, a_g, a_aq, h2o, aqueous_phase, 1.5e-5, 0.05, 0.044, 0.018, 1000.0 },
+        DissolvedReaction{ { { "CLOUD", k } }, { a_aq }, { b_aq }, h2o, aqueous_phase },
+        DissolvedReaction{ { { "AEROSOL", k } }, { c_org }, { d_org }, org, organic_phase });
+    return model;
+  }
+
+  struct Indices
+  {
+    std::unordered_map<std::string, std::size_t> variables_;
+    std::unordered_map<std::string, std::size_t> parameters_;
+  };
+
+  Indices MakeIndices(const Model& model)
+  {
+    Indices indices;
+    indices.variables_["A_g"] = 0;
+    for (const auto& name : model.StateVariableNames())
+      indices.variables_[name] = indices.variables_.size();
+    for (const auto& name : model.StateParameterNames())
+      indices.parameters_[name] = indices.parameters_.size();
+    return indices;
+  }
+}  // namespace
+
+TEST(ActiveCells, GatherAndScatterCells)
+{
+  CheckGatherAndScatter<DenseMatrix>();
+}
+
+TEST(ActiveCells, GatherAndScatterCellsVectorMatrix)
+{
+  CheckGatherAndScatter<micm::VectorMatrix<double, 4>>();
+}
+
+TEST(ActiveCells, EvaluatorOnlyTouchesActiveCells)
+{
+  std::size_t evaluated_cells = 0;
+  auto function = [&](const DenseMatrix& parameters, const DenseMatrix& variables, DenseMatrix& output)
+  {
+    evaluated_cells = variables.NumRows();
+    for (std::size_t i = 0; i < variables.NumRows(); ++i)
+      output[i][0] += parameters[i][0] * variables[i][1];
+  };
+  ActiveCellEvaluator<DenseMatrix, DenseMatrix> evaluator(function, { { 0, 0.5 } });
+
+  DenseMatrix parameters(5, 1, 2.0);
+  DenseMatrix variables(5, 2, 0.0);
+  DenseMatrix output(5, 1, 1.0);
+  for (std::size_t i = 0; i < 5; ++i)
+    variables[i][1] = i + 1.0;
+  variables[1][0] = 1.0;
+  variables[3][0] = 0.7;
+
+  evaluator(parameters, variables, output);
+  EXPECT_EQ(evaluated_cells, 2);
+  EXPECT_EQ(evaluator.ActiveCells(), (std::vector<std::size_t>{ 1, 3 }));
+  EXPECT_EQ(output[0][0], 1.0);
+  EXPECT_EQ(output[1][0], 1.0 + 2.0 * 2.0);
+  EXPECT_EQ(output[2][0], 1.0);
+  EXPECT_EQ(output[3][0], 1.0 + 2.0 * 4.0);
+  EXPECT_EQ(output[4][0], 1.0);
+
+  // No active cells: nothing is evaluated; all active: the function sees the full matrices
+  evaluated_cells = 0;
+  DenseMatrix inactive(5, 2, 0.0);
+  evaluator(parameters, inactive, output);
+  EXPECT_EQ(evaluated_cells, 0);
+  DenseMatrix active(5, 2, 1.0);
+  evaluator(parameters, active, output);
+  EXPECT_EQ(evaluated_cells, 5);
+}
+
+TEST(ActiveCells, EvaluatorGrowsCapacityGeometrically)
+{
+  std::size_t evaluated_cells = 0;
+  auto function = [&](const DenseMatrix& parameters, const DenseMatrix& variables, DenseMatrix& output)
+  {
+    evaluated_cells = variables.NumRows();
+    for (std::size_t i = 0; i < variables.NumRows(); ++i)
+      output[i][0] += variables[i][1];
+  };
+  ActiveCellEvaluator<DenseMatrix, DenseMatrix> evaluator(function, { { 0, 0.5 } });
+
+  DenseMatrix parameters(8, 1, 0.0);
+  DenseMatrix variables(8, 2, 0.0);
+  DenseMatrix output(8, 1, 0.0);
+  for (std::size_t i = 0; i < 8; ++i)
+    variables[i][1] = i + 1.0;
+  auto set_active = [&](const std::vector<std::size_t>& cells)
+  {
+    for (std::size_t i = 0; i < 8; ++i)
+      variables[i][0] = 0.0;
+    for (const auto cell : cells)
+      variables[cell][0] = 1.0;
+  };
+
+  set_active({ 2, 5 });
+  evaluator(parameters, variables, output);
+  EXPECT_EQ(evaluator.Capacity(), 2);
+  set_active({ 1, 2, 7 });
+  evaluator(parameters, variables, output);
+  EXPECT_EQ(evaluator.Capacity(), 4);
+  EXPECT_EQ(evaluated_cells, 4);
+
+  // Fewer active cells reuse the compact matrices; the padding rows are not scattered back
+  set_active({ 6 });
+  evaluator(parameters, variables, output);
+  EXPECT_EQ(evaluator.Capacity(), 4);
+  const std::vector<double> expected{ 0.0, 2.0, 6.0, 0.0, 0.0, 6.0, 7.0, 8.0 };
+  for (std::size_t i = 0; i < 8; ++i)
+    EXPECT_EQ(output[i][0], expected[i]) << "cell " << i;
+}
+
+TEST(ActiveCells, EvaluatorMovesOnlyUsedValues)
+{
+  // Reads parameter column 1 and variable column 2, writes output column 1
+  auto function = [](const DenseMatrix& parameters, const DenseMatrix& variables, DenseMatrix& output)
+  {
+    for (std::size_t i = 0; i < variables.NumRows(); ++i)
+      output[i][1] += parameters[i][1] * variables[i][2];
+  };
+  ActiveCellEvaluator<DenseMatrix, DenseMatrix> evaluator(function, { { 0, 0.5 } }, { { 1 }, { 2 }, { 1 } });
+
+  DenseMatrix parameters(4, 2, 3.0);
+  DenseMatrix variables(4, 3, 0.0);
+  DenseMatrix output(4, 2, 1.0);
+  for (std::size_t i = 0; i < 4; ++i)
+    variables[i][2] = i + 1.0;
+  variables[1][0] = variables[2][0] = 1.0;
+
+  evaluator(parameters, variables, output);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(output[i][0], 1.0);
+    EXPECT_EQ(output[i][1], (i == 1 || i == 2) ? 1.0 + 3.0 * (i + 1.0) : 1.0) << "cell " << i;
+  }
+}
+
+TEST(ActiveCells, MaskedModelMatchesFullEvaluationInActiveCells)
+{
+  constexpr std::size_t number_of_cells = 4;
+  Model full = MakeTwoModeModel();
+  Model masked = full;
+  masked.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 1.0e-3 };
+  auto indices = MakeIndices(full);
+
+  DenseMatrix parameters(number_of_cells, indices.parameters_.size(), 1.0e-2);
+  DenseMatrix variables(number_of_cells, indices.variables_.size(), 0.5);
+  const std::size_t water = indices.variables_.at("CLOUD.AQUEOUS.H2O");
+  variables[1][water] = 0.0;  // cloud-free
+  variables[3][water] = 1.0e-6;
+
+  auto builder = SparseMatrix::Create(indices.variables_.size()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+  for (const auto& element : full.NonZeroJacobianElements(indices.variables_))
+    builder = builder.WithElement(element.first, element.second);
+  SparseMatrix full_jacobian(builder);
+  SparseMatrix masked_jacobian(builder);
+  DenseMatrix full_forcing(number_of_cells, indices.variables_.size(), 0.0);
+  DenseMatrix masked_forcing(number_of_cells, indices.variables_.size(), 0.0);
+
+  full.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_)(parameters, variables, full_forcing);
+  masked.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_)(parameters, variables, masked_forcing);
+  full.JacobianFunction<DenseMatrix, SparseMatrix>(indices.parameters_, indices.variables_, full_jacobian)(
+      parameters, variables, full_jacobian);
+  masked.JacobianFunction<DenseMatrix, SparseMatrix>(indices.parameters_, indices.variables_, masked_jacobian)(
+      parameters, variables, masked_jacobian);
+
+  const std::size_t cloud_solute = indices.variables_.at("CLOUD.AQUEOUS.A_aq");
+  const std::size_t aerosol_solute = indices.variables_.at("AEROSOL.ORGANIC.C_org");
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+  {
+    const bool active = cell == 0 || cell == 2;
+    for (const auto& [name, column] : indices.variables_)
+      if (active || name.starts_with("AEROSOL"))
+        EXPECT_EQ(masked_forcing[cell][column], full_forcing[cell][column]) << cell << " " << name;
+      else
+        EXPECT_EQ(masked_forcing[cell][column], 0.0) << cell << " " << name;
+    if (active)
+      EXPECT_EQ(masked_jacobian[cell][cloud_solute][cloud_solute], full_jacobian[cell][cloud_solute][cloud_solute]);
+    else
+      EXPECT_EQ(masked_jacobian[cell][cloud_solute][cloud_solute], 0.0);
+    EXPECT_EQ(masked_jacobian[cell][aerosol_solute][aerosol_solute], full_jacobian[cell][aerosol_solute][aerosol_solute]);
+    EXPECT_NE(full_jacobian[cell][aerosol_solute][aerosol_solute], 0.0);
+  }
+  EXPECT_NE(full_jacobian[0][cloud_solute][cloud_solute], 0.0);
+}
+
+TEST(ActiveCells, CellParallelMaskedModelMatchesSerial)
+{
+  constexpr std::size_t number_of_cells = 9;
+  Model serial = MakeTwoModeModel();
+  serial.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 1.0e-3 };
+  Model parallel = serial;
+  parallel.options_.thread_pool_ = std::make_shared<ThreadPool>(3);
+  auto indices = MakeIndices(serial);
+
+  DenseMatrix parameters(number_of_cells, indices.parameters_.size(), 1.0e-2);
+  DenseMatrix variables(number_of_cells, indices.variables_.size(), 0.5);
+  const std::size_t water = indices.variables_.at("CLOUD.AQUEOUS.H2O");
+  for (std::size_t cell = 0; cell < number_of_cells; cell += 2)
+    variables[cell][water] = 0.0;
+  DenseMatrix serial_forcing(number_of_cells, indices.variables_.size(), 0.0);
+  DenseMatrix parallel_forcing(number_of_cells, indices.variables_.size(), 0.0);
+
+  serial.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_)(parameters, variables, serial_forcing);
+  parallel.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_)(parameters, variables, parallel_forcing);
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    for (std::size_t column = 0; column < indices.variables_.size(); ++column)
+      EXPECT_EQ(parallel_forcing[cell][column], serial_forcing[cell][column]);
+}
+
+TEST(ActiveCells, UnknownRepresentationOrVariableThrows)
+{
+  auto indices = MakeIndices(MakeTwoModeModel());
+  Model unknown_representation = MakeTwoModeModel();
+  unknown_representation.options_.active_cell_thresholds_["RAIN"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 0.0 };
+  EXPECT_THROW(
+      unknown_representation.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_), MiamException);
+  Model unknown_variable = MakeTwoModeModel();
+  unknown_variable.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.XYZ", 0.0 };
+  EXPECT_THROW(unknown_variable.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_), MiamException);
+}
+
+TEST(ActiveCells, PartitionCellsByActivity)
+{
+  const std::set<std::string> representations{ "AEROSOL", "CLOUD", "DUST" };
+  const std::map<std::string, ActivityThreshold> thresholds{ { "AEROSOL", { "AEROSOL.N", 1.0 } },
+                                                             { "CLOUD", { "CLOUD.H2O", 1.0e-3 } } };
+  const std::unordered_map<std::string, std::size_t> indices{ { "AEROSOL.N", 0 }, { "CLOUD.H2O", 1 } };
+  DenseMatrix variables(5, 2, 0.0);
+  variables[0][0] = 10.0;  // aerosol
+  variables[1][1] = 0.1;   // cloud
+  variables[2][0] = 10.0;  // aerosol + cloud
+  variables[2][1] = 0.1;
+  variables[4][0] = 10.0;  // aerosol
+
+  auto batches = PartitionCellsByActivity(representations, thresholds, indices, variables);
+  ASSERT_EQ(batches.size(), 4);
+  EXPECT_EQ(batches[0].active_representations_, (std::set<std::string>{ "AEROSOL", "CLOUD", "DUST" }));
+  EXPECT_EQ(batches[0].cells_, (std::vector<std::size_t>{ 2 }));
+  EXPECT_EQ(batches[1].active_representations_, (std::set<std::string>{ "AEROSOL", "DUST" }));
+  EXPECT_EQ(batches[1].cells_, (std::vector<std::size_t>{ 0, 4 }));
+  EXPECT_EQ(batches[2].active_representations_, (std::set<std::string>{ "CLOUD", "DUST" }));
+  EXPECT_EQ(batches[2].cells_, (std::vector<std::size_t>{ 1 }));
+  EXPECT_EQ(batches[3].active_representations_, (std::set<std::string>{ "DUST" }));
+  EXPECT_EQ(batches[3].cells_, (std::vector<std::size_t>{ 3 }));
+  // One bit per thresholded representation, in prefix order: AEROSOL = 1, CLOUD = 2
+  EXPECT_EQ(batches[0].activity_mask_, 3);
+  EXPECT_EQ(batches[1].activity_mask_, 1);
+  EXPECT_EQ(batches[2].activity_mask_, 2);
+  EXPECT_EQ(batches[3].activity_mask_, 0);
+
+  const std::map<std::string, ActivityThreshold> unknown{ { "CLOUD", { "CLOUD.XYZ", 0.0 } } };
+  EXPECT_THROW(PartitionCellsByActivity(representations, unknown, indices, variables), MiamException);
+}
+
+TEST(ActiveCells, MaskedConstraintsAndProcessParallelForcingThrow)
+{
+  auto aqueous_phase =
+      micm::Phase{ "AQUEOUS", { { micm::Species{ "H2O" } }, { micm::Species{ "A_aq" } }, { micm::Species{ "B_aq" } } } };
+  Model model = MakeTwoModeModel();
+  model.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 1.0e-3 };
+  auto indices = MakeIndices(model);
+
+  Model process_parallel = model;
+  process_parallel.options_.thread_pool_ = std::make_shared<ThreadPool>(2);
+  process_parallel.options_.process_parallel_forcing_ = true;
+  EXPECT_THROW(process_parallel.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_), MiamException);
+
+  model.AddConstraints(LinearConstraintBuilder()
+                           .SetAlgebraicSpecies(aqueous_phase, micm::Species{ "B_aq" })
+                           .AddTerm(aqueous_phase, micm::Species{ "A_aq" }, 1.0)
+                           .AddTerm(aqueous_phase, micm::Species{ "B_aq" }, 1.0)
+                           .SetConstant(1.0)
+                           .Build());
+  auto builder = SparseMatrix::Create(indices.variables_.size()).SetNumberOfBlocks(1).InitialValue(0.0);
+  for (const auto& element : model.NonZeroConstraintJacobianElements(indices.variables_))
+    builder = builder.WithElement(element.first, element.second);
+  SparseMatrix jacobian(builder);
+  EXPECT_THROW(
+      model.ConstraintResidualFunction<DenseMatrix>(indices.parameters_, indices.variables_), MiamException);
+  EXPECT_THROW(
+      (model.ConstraintJacobianFunction<DenseMatrix, SparseMatrix>(indices.parameters_, indices.variables_, jacobian)),
+      MiamException);
+
+  // Without the threshold on the constrained representation the constraint functions build
+  model.options_.active_cell_thresholds_.erase("CLOUD");
+  model.options_.active_cell_thresholds_["AEROSOL"] = ActivityThreshold{ "AEROSOL.ORGANIC.ORG", 1.0e-3 };
+  EXPECT_NO_THROW(model.ConstraintResidualFunction<DenseMatrix>(indices.parameters_, indices.variables_));
+}
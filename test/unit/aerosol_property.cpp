@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <vector>
 
 using namespace miam;
 
@@ -112,3 +113,136 @@ TEST(AerosolPropertyProvider, StorableInProviderMap)
   EXPECT_EQ(providers["DROPLET"][0].dependent_variable_indices.size(), 1);
   EXPECT_EQ(providers["DROPLET"][1].dependent_variable_indices.size(), 2);
 }
+
+TEST(AerosolProperty, FrozenPropertyParameterName)
+{
+  EXPECT_EQ(FrozenPropertyParameterName("CLOUD", AerosolProperty::EffectiveRadius), "CLOUD.EFFECTIVE_RADIUS");
+  EXPECT_EQ(
+      FrozenPropertyParameterName("CLOUD.BIN_0", AerosolProperty::NumberConcentration), "CLOUD.BIN_0.NUMBER_CONCENTRATION");
+  EXPECT_EQ(FrozenPropertyParameterName("MODE1", AerosolProperty::PhaseVolumeFraction), "MODE1.PHASE_VOLUME_FRACTION");
+}
+
+TEST(AerosolPropertyProvider, ParameterPropertyProviderReadsParameterColumn)
+{
+  using MatrixPolicy = micm::VectorMatrix<double>;
+  auto provider = ParameterPropertyProvider<MatrixPolicy>(1, 3, 2);
+  EXPECT_TRUE(provider.dependent_variable_indices.empty());
+
+  MatrixPolicy params(5, 3, 0.0);
+  MatrixPolicy vars(5, 2, 1.0);
+  for (std::size_t i = 0; i < 5; ++i)
+    params[i][1] = 1.0e-6 * (i + 1);
+  MatrixPolicy result(5, 1, 0.0);
+  MatrixPolicy partials(5, 0, 0.0);
+  provider.ComputeValue(params, vars, result);
+  for (std::size_t i = 0; i < 5; ++i)
+    EXPECT_EQ(result[i][0], 1.0e-6 * (i + 1));
+  MatrixPolicy fused(5, 1, 0.0);
+  provider.ComputeValueAndDerivatives(params, vars, fused, partials);
+  EXPECT_EQ(fused.AsVector(), result.AsVector());
+}
+
+TEST(AerosolPropertyProvider, ScaledPartialsLayout)
+{
+  using MatrixPolicy = micm::VectorMatrix<double>;
+  AerosolPropertyProvider<MatrixPolicy> provider;
+  provider.dependent_variable_indices = { 7, 3, 5, 9 };
+  provider.scaled_partials.push_back(ScaledPartials::Consecutive(0, { 2.0, 4.0 }));
+  provider.scaled_partials.push_back(ScaledPartials{ { 3 }, { -1.0 } });
+  ASSERT_EQ(provider.scaled_partials[0].dependents_.size(), 2);
+  EXPECT_EQ(provider.scaled_partials[0].dependents_[1], 1);
+
+  // Dependent 2 has its own column; each group then adds one factor column
+  EXPECT_EQ(provider.GeneralDependents(), std::vector<std::size_t>{ 2 });
+  EXPECT_EQ(provider.NumberOfPartialsColumns(), 3);
+
+  MatrixPolicy partials(2, 3, 0.0);
+  for (std::size_t row = 0; row < 2; ++row)
+  {
+    partials[row][0] = 10.0 + row;  // general partial of dependent 2
+    partials[row][1] = 0.5 * (row + 1);
+    partials[row][2] = 3.0;
+  }
+  for (std::size_t row = 0; row < 2; ++row)
+  {
+    EXPECT_EQ(provider.PartialDerivative(partials, row, 0), 2.0 * 0.5 * (row + 1));
+    EXPECT_EQ(provider.PartialDerivative(partials, row, 1), 4.0 * 0.5 * (row + 1));
+    EXPECT_EQ(provider.PartialDerivative(partials, row, 2), 10.0 + row);
+    EXPECT_EQ(provider.PartialDerivative(partials, row, 3), -3.0);
+  }
+
+  // Without groups there is one column per dependent variable
+  provider.scaled_partials.clear();
+  EXPECT_EQ(provider.NumberOfPartialsColumns(), 4);
+}
+
+TEST(AerosolPropertyProvider, WriteToMovesTheOutputColumns)
+{
+  using MatrixPolicy = micm::VectorMatrix<double>;
+  auto provider = ParameterPropertyProvider<MatrixPolicy>(0, 1, 1);
+  ASSERT_TRUE(provider.BuildFunctions);
+
+  MatrixPolicy params(3, 1, 2.5);
+  MatrixPolicy vars(3, 1, 0.0);
+  MatrixPolicy result(3, 4, -1.0);
+  MatrixPolicy partials(3, 1, 0.0);
+  provider.WriteTo(PropertyColumns{ 2, 0 });
+  provider.ComputeValue(params, vars, result);
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(result[i][2], 2.5);
+    // Only the target column is written
+    EXPECT_EQ(result[i][0], -1.0);
+    EXPECT_EQ(result[i][1], -1.0);
+    EXPECT_EQ(result[i][3], -1.0);
+  }
+  provider.WriteTo(PropertyColumns{ 3, 0 });
+  provider.ComputeValueAndDerivatives(params, vars, result, partials);
+  for (std::size_t i = 0; i < 3; ++i)
+    EXPECT_EQ(result[i][3], 2.5);
+}
+
+TEST(AerosolPropertyProvider, DensePartialsProviderExpandsScaledPartials)
+{
+  using MatrixPolicy = micm::VectorMatrix<double>;
+  AerosolPropertyProvider<MatrixPolicy> provider;
+  provider.dependent_variable_indices = { 7, 3, 5, 9 };
+  provider.scaled_partials.push_back(ScaledPartials::Consecutive(0, { 2.0, 4.0 }));
+  provider.scaled_partials.push_back(ScaledPartials{ { 3 }, { -1.0 } });
+  provider.ComputeValueAndDerivatives =
+      [](const MatrixPolicy&, const MatrixPolicy&, MatrixPolicy& result, MatrixPolicy& partials)
+  {
+    for (std::size_t row = 0; row < partials.NumRows(); ++row)
+    {
+      result[row][0] = 1.0 + row;
+      partials[row][0] = 10.0 + row;  // general partial of dependent 2
+      partials[row][1] = 0.5 * (row + 1);
+      partials[row][2] = 3.0;
+    }
+  };
+
+  // The old layout: one column per dependent variable, in dependent_variable_indices order
+  auto dense = DensePartialsProvider(provider);
+  EXPECT_EQ(dense.dependent_variable_indices, provider.dependent_variable_indices);
+  EXPECT_TRUE(dense.scaled_partials.empty());
+  EXPECT_EQ(dense.NumberOfPartialsColumns(), 4);
+
+  constexpr std::size_t number_of_cells = 5;
+  MatrixPolicy params(number_of_cells, 1, 0.0);
+  MatrixPolicy vars(number_of_cells, 10, 0.0);
+  MatrixPolicy result(number_of_cells, 1, 0.0);
+  MatrixPolicy partials(number_of_cells, 4, 0.0);
+  MatrixPolicy structured(number_of_cells, 3, 0.0);
+  dense.ComputeValueAndDerivatives(params, vars, result, partials);
+  provider.ComputeValueAndDerivatives(params, vars, result, structured);
+  for (std::size_t row = 0; row < number_of_cells; ++row)
+  {
+    EXPECT_EQ(result[row][0], 1.0 + row);
+    for (std::size_t k = 0; k < 4; ++k)
+      EXPECT_EQ(partials[row][k], provider.PartialDerivative(structured, row, k)) << row << " " << k;
+  }
+
+  // A provider without groups already has that layout
+  provider.scaled_partials.clear();
+  EXPECT_EQ(DensePartialsProvider(provider).NumberOfPartialsColumns(), 4);
+}
@@ -0,0 +1,346 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/representations/aerosol_property_cache.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  /// @brief Provider whose value is a scaled copy of one state variable; counts evaluations
+  template<typename MatrixPolicy>
+  AerosolPropertyProvider<MatrixPolicy> MakeScalingProvider(std::size_t var_index, double scale, int& value_calls)
+  {
+    AerosolPropertyProvider<MatrixPolicy> provider;
+    provider.dependent_variable_indices = { var_index };
+    provider.BuildFunctions =
+        [var_index, scale, &value_calls](AerosolPropertyProvider<MatrixPolicy>& built, const PropertyColumns& columns)
+    {
+      built.ComputeValue = [var_index, scale, &value_calls, columns](
+                               const MatrixPolicy& /* params */, const MatrixPolicy& vars, MatrixPolicy& result)
+      {
+        ++value_calls;
+        for (std::size_t i = 0; i < vars.NumRows(); ++i)
+          result[i][columns.value_] = scale * vars[i][var_index];
+      };
+      built.ComputeValueAndDerivatives = [var_index, scale, columns](
+                                             const MatrixPolicy& /* params */,
+                                             const MatrixPolicy& vars,
+                                             MatrixPolicy& result,
+                                             MatrixPolicy& partials)
+      {
+        for (std::size_t i = 0; i < vars.NumRows(); ++i)
+        {
+          result[i][columns.value_] = scale * vars[i][var_index];
+          partials[i][columns.partials_] = scale;
+        }
+      };
+    };
+    provider.WriteTo({});
+    return provider;
+  }
+
+  template<typename MatrixPolicy>
+  void TestCacheValues()
+  {
+    int calls_a = 0;
+    int calls_b = 0;
+    AerosolPropertyCache<MatrixPolicy> cache;
+    EXPECT_TRUE(cache.Empty());
+
+    auto a = cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(0, 2.0, calls_a));
+    auto b = cache.Add("MODE2", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(1, 3.0, calls_b));
+    // Adding an existing (prefix, property) pair returns the existing entry
+    auto a_again =
+        cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(1, 5.0, calls_b));
+    EXPECT_EQ(a, a_again);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_TRUE(cache.Contains("MODE1", AerosolProperty::EffectiveRadius));
+    EXPECT_FALSE(cache.Contains("MODE1", AerosolProperty::NumberConcentration));
+    EXPECT_EQ(cache.Index("MODE2", AerosolProperty::EffectiveRadius), b);
+    EXPECT_ANY_THROW(cache.Index("MODE3", AerosolProperty::EffectiveRadius));
+
+    const std::size_t num_cells = 5;
+    MatrixPolicy params(num_cells, 1, 0.0);
+    MatrixPolicy vars(num_cells, 2, 0.0);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      vars[i][0] = 1.0 + i;
+      vars[i][1] = 10.0 + i;
+    }
+
+    cache.Update(params, vars);
+    EXPECT_EQ(calls_a, 1);
+    EXPECT_EQ(calls_b, 1);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      // Packed values hold every entry in its own column
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][a], 2.0 * (1.0 + i));
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][b], 3.0 * (10.0 + i));
+    }
+
+    // Storage is reused across evaluations with the same number of cells
+    const double* storage = &cache.PackedValues().AsVector()[0];
+    for (std::size_t i = 0; i < num_cells; ++i)
+      vars[i][0] = 2.0 + i;
+    cache.UpdateWithPartials(params, vars);
+    EXPECT_EQ(storage, &cache.PackedValues().AsVector()[0]);
+    // The fused value-and-partials evaluation replaces the value-only pass
+    EXPECT_EQ(calls_a, 1);
+    EXPECT_EQ(calls_b, 1);
+    for (std::size_t i = 0; i < num_cells; ++i)
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][a], 2.0 * (2.0 + i));
+    ASSERT_EQ(cache.DependentVariableIndices(b).size(), 1);
+    EXPECT_EQ(cache.DependentVariableIndices(b)[0], 1);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(a)], 2.0);
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(b)], 3.0);
+    }
+    EXPECT_EQ(cache.NumberOfPackedPartials(), 2);
+    EXPECT_NE(cache.PartialsOffset(a), cache.PartialsOffset(b));
+  }
+}  // namespace
+
+TEST(AerosolPropertyCache, StandardMatrix)
+{
+  TestCacheValues<micm::Matrix<double>>();
+}
+
+TEST(AerosolPropertyCache, VectorMatrix)
+{
+  TestCacheValues<micm::VectorMatrix<double, 4>>();
+}
+
+TEST(AerosolPropertyCache, BuildsFromProviderMap)
+{
+  using MatrixPolicy = micm::Matrix<double>;
+  int calls = 0;
+  AerosolPropertyCache<MatrixPolicy>::ProviderMap providers;
+  providers["MODE1"][AerosolProperty::EffectiveRadius] = MakeScalingProvider<MatrixPolicy>(0, 1.0, calls);
+  providers["MODE1"][AerosolProperty::NumberConcentration] = MakeScalingProvider<MatrixPolicy>(0, 1.0, calls);
+  providers["MODE2"][AerosolProperty::EffectiveRadius] = MakeScalingProvider<MatrixPolicy>(0, 1.0, calls);
+
+  AerosolPropertyCache<MatrixPolicy> cache(providers);
+  EXPECT_EQ(cache.Size(), 3);
+  EXPECT_TRUE(cache.Contains("MODE1", AerosolProperty::NumberConcentration));
+  EXPECT_TRUE(cache.Contains("MODE2", AerosolProperty::EffectiveRadius));
+  EXPECT_FALSE(cache.Contains("MODE2", AerosolProperty::NumberConcentration));
+
+  // Each property is evaluated exactly once per update, however many processes read it
+  MatrixPolicy params(2, 1, 0.0);
+  MatrixPolicy vars(2, 1, 1.0);
+  cache.Update(params, vars);
+  EXPECT_EQ(calls, 3);
+}
+
+TEST(AerosolPropertyCache, PacksScaledPartialsFactorColumns)
+{
+  using MatrixPolicy = micm::Matrix<double>;
+  int calls = 0;
+  // Value = sum_k a_k · var_k, so every partial is a_k times the factor 1
+  AerosolPropertyProvider<MatrixPolicy> volume;
+  volume.dependent_variable_indices = { 0, 1, 2 };
+  volume.scaled_partials.push_back(ScaledPartials::Consecutive(0, { 1.0, 2.0, 3.0 }));
+  volume.BuildFunctions = [](AerosolPropertyProvider<MatrixPolicy>& built, const PropertyColumns& columns)
+  {
+    built.ComputeValueAndDerivatives =
+        [columns](const MatrixPolicy&, const MatrixPolicy& vars, MatrixPolicy& result, MatrixPolicy& partials)
+    {
+      for (std::size_t i = 0; i < vars.NumRows(); ++i)
+      {
+        result[i][columns.value_] = vars[i][0] + 2.0 * vars[i][1] + 3.0 * vars[i][2];
+        partials[i][columns.partials_] = 1.0;
+      }
+    };
+  };
+
+  AerosolPropertyCache<MatrixPolicy> cache;
+  auto a = cache.Add("MODE1", AerosolProperty::NumberConcentration, volume);
+  auto b = cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(1, 3.0, calls));
+  EXPECT_TRUE(cache.GeneralDependents(a).empty());
+  ASSERT_EQ(cache.ScaledPartialGroups(a).size(), 1);
+  EXPECT_EQ(cache.ScaledPartialGroups(a)[0].coefficients_, (std::vector<double>{ 1.0, 2.0, 3.0 }));
+  EXPECT_EQ(cache.GeneralDependents(b), std::vector<std::size_t>{ 0 });
+  // One factor column for the three scaled dependents plus one general column
+  EXPECT_EQ(cache.NumberOfPackedPartials(), 2);
+  EXPECT_EQ(cache.PartialsOffset(b), cache.PartialsOffset(a) + 1);
+
+  MatrixPolicy params(3, 1, 0.0);
+  MatrixPolicy vars(3, 3, 1.0);
+  cache.UpdateWithPartials(params, vars);
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    EXPECT_DOUBLE_EQ(cache.PackedValues()[i][a], 6.0);
+    EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(a)], 1.0);
+    EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(b)], 3.0);
+  }
+}
+
+TEST(AerosolPropertyCache, WritesProvidersIntoTheirPackedColumns)
+{
+  using MatrixPolicy = micm::Matrix<double>;
+  int calls = 0;
+  AerosolPropertyCache<MatrixPolicy> cache;
+  auto a = cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(0, 2.0, calls));
+  auto b = cache.Add("MODE2", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(1, 3.0, calls));
+
+  // Neither provider writes column 0 of the other: each fills only its own packed columns
+  MatrixPolicy params(2, 1, 0.0);
+  MatrixPolicy vars(2, 2, 1.0);
+  cache.UpdateWithPartials(params, vars);
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    EXPECT_DOUBLE_EQ(cache.PackedValues()[i][a], 2.0);
+    EXPECT_DOUBLE_EQ(cache.PackedValues()[i][b], 3.0);
+    EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(a)], 2.0);
+    EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(b)], 3.0);
+  }
+
+}
+
+TEST(AerosolPropertyCache, CopiesPlainLambdaProvidersIntoPackedColumns)
+{
+  using MatrixPolicy = micm::Matrix<double>;
+  int calls = 0;
+  // A hand-built provider without BuildFunctions always writes column 0 of the matrices it is given
+  AerosolPropertyProvider<MatrixPolicy> plain;
+  plain.dependent_variable_indices = { 0, 1 };
+  plain.ComputeValue = [](const MatrixPolicy&, const MatrixPolicy& vars, MatrixPolicy& result)
+  {
+    for (std::size_t i = 0; i < vars.NumRows(); ++i)
+      result[i][0] = vars[i][0] * vars[i][1];
+  };
+  plain.ComputeValueAndDerivatives =
+      [](const MatrixPolicy&, const MatrixPolicy& vars, MatrixPolicy& result, MatrixPolicy& partials)
+  {
+    for (std::size_t i = 0; i < vars.NumRows(); ++i)
+    {
+      result[i][0] = vars[i][0] * vars[i][1];
+      partials[i][0] = vars[i][1];
+      partials[i][1] = vars[i][0];
+    }
+  };
+
+  AerosolPropertyCache<MatrixPolicy> cache;
+  auto a = cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(0, 2.0, calls));
+  auto b = cache.Add("MODE2", AerosolProperty::EffectiveRadius, plain);
+  EXPECT_EQ(cache.NumberOfPackedPartials(), 3);
+
+  for (std::size_t num_cells : { 3, 5 })
+  {
+    MatrixPolicy params(num_cells, 1, 0.0);
+    MatrixPolicy vars(num_cells, 2, 0.0);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      vars[i][0] = 1.0 + i;
+      vars[i][1] = 10.0 + i;
+    }
+    cache.Update(params, vars);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][a], 2.0 * (1.0 + i));
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][b], (1.0 + i) * (10.0 + i));
+    }
+    cache.UpdateWithPartials(params, vars);
+    for (std::size_t i = 0; i < num_cells; ++i)
+    {
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][b], (1.0 + i) * (10.0 + i));
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(a)], 2.0);
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(b)], 10.0 + i);
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(b) + 1], 1.0 + i);
+    }
+  }
+}
+
+TEST(AerosolPropertyCache, EvaluatesFusedProvidersInOnePass)
+{
+  using MatrixPolicy = micm::Matrix<double>;
+  int instance_calls = 0;
+  int fused_calls = 0;
+  // Instance k scales variable k by k + 1, alone or through the fused provider
+  std::vector<std::string> prefixes;
+  std::vector<AerosolPropertyProvider<MatrixPolicy>> providers;
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    prefixes.push_back("BIN_" + std::to_string(k));
+    providers.push_back(MakeScalingProvider<MatrixPolicy>(k, k + 1.0, instance_calls));
+  }
+  AerosolPropertyProvider<MatrixPolicy> fused;
+  fused.BuildFunctions = [&fused_calls](AerosolPropertyProvider<MatrixPolicy>& built, const PropertyColumns& columns)
+  {
+    built.ComputeValue = [&fused_calls, columns](const MatrixPolicy&, const MatrixPolicy& vars, MatrixPolicy& result)
+    {
+      ++fused_calls;
+      for (std::size_t i = 0; i < vars.NumRows(); ++i)
+        for (std::size_t k = 0; k < 3; ++k)
+          result[i][columns.value_ + k] = (k + 1.0) * vars[i][k];
+    };
+    built.ComputeValueAndDerivatives =
+        [&fused_calls, columns](const MatrixPolicy&, const MatrixPolicy& vars, MatrixPolicy& result, MatrixPolicy& partials)
+    {
+      ++fused_calls;
+      for (std::size_t i = 0; i < vars.NumRows(); ++i)
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+          result[i][columns.value_ + k] = (k + 1.0) * vars[i][k];
+          partials[i][columns.partials_ + k] = k + 1.0;
+        }
+    };
+  };
+  fused.WriteTo({});
+
+  // The instances get consecutive entries, after those already cached
+  AerosolPropertyCache<MatrixPolicy> cache;
+  auto mode =
+      cache.Add("MODE1", AerosolProperty::EffectiveRadius, MakeScalingProvider<MatrixPolicy>(0, 5.0, instance_calls));
+  cache.AddFused(prefixes, AerosolProperty::EffectiveRadius, providers, fused);
+  EXPECT_EQ(cache.Size(), 4);
+  for (std::size_t k = 0; k < 3; ++k)
+    EXPECT_EQ(cache.Index(prefixes[k], AerosolProperty::EffectiveRadius), mode + 1 + k);
+  EXPECT_EQ(cache.DependentVariableIndices(mode + 2), std::vector<std::size_t>{ 1 });
+
+  MatrixPolicy params(2, 1, 0.0);
+  MatrixPolicy vars(2, 3, 0.0);
+  for (std::size_t i = 0; i < 2; ++i)
+    for (std::size_t k = 0; k < 3; ++k)
+      vars[i][k] = 10.0 * k + i;
+  cache.Update(params, vars);
+  EXPECT_EQ(fused_calls, 1);
+  EXPECT_EQ(instance_calls, 1);  // only MODE1
+  cache.UpdateWithPartials(params, vars);
+  EXPECT_EQ(fused_calls, 2);
+  for (std::size_t i = 0; i < 2; ++i)
+  {
+    EXPECT_DOUBLE_EQ(cache.PackedValues()[i][mode], 5.0 * vars[i][0]);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      std::size_t index = cache.Index(prefixes[k], AerosolProperty::EffectiveRadius);
+      EXPECT_DOUBLE_EQ(cache.PackedValues()[i][index], (k + 1.0) * vars[i][k]);
+      EXPECT_DOUBLE_EQ(cache.PackedPartials()[i][cache.PartialsOffset(index)], k + 1.0);
+    }
+  }
+
+  // If one instance is already cached, the instances are added one by one
+  AerosolPropertyCache<MatrixPolicy> partial_cache;
+  partial_cache.Add("BIN_0", AerosolProperty::EffectiveRadius, providers[0]);
+  partial_cache.AddFused(prefixes, AerosolProperty::EffectiveRadius, providers, fused);
+  EXPECT_EQ(partial_cache.Size(), 3);
+  partial_cache.Update(params, vars);
+  EXPECT_EQ(fused_calls, 2);
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    std::size_t index = partial_cache.Index(prefixes[k], AerosolProperty::EffectiveRadius);
+    for (std::size_t i = 0; i < 2; ++i)
+      EXPECT_DOUBLE_EQ(partial_cache.PackedValues()[i][index], (k + 1.0) * vars[i][k]);
+  }
+}
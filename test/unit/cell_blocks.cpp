@@ -0,0 +1,234 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/model/cell_blocks.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  /// Runs a cell-wise function through a CellBlockEvaluator and compares it against a serial call
+  template<typename DenseMatrixPolicy>
+  void CompareBlockEvaluation(std::size_t number_of_cells, std::size_t number_of_threads)
+  {
+    // output[i][j] += input[i][j] * input[i][(j + 1) % n] for every cell i
+    auto function = [](const DenseMatrixPolicy& input, DenseMatrixPolicy& output)
+    {
+      for (std::size_t i = 0; i < input.NumRows(); ++i)
+        for (std::size_t j = 0; j < input.NumColumns(); ++j)
+          output[i][j] += input[i][j] * input[i][(j + 1) % input.NumColumns()];
+    };
+
+    DenseMatrixPolicy input(number_of_cells, 3, 0.0);
+    DenseMatrixPolicy serial(number_of_cells, 3, 0.0);
+    DenseMatrixPolicy parallel(number_of_cells, 3, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+        input[i][j] = 0.1 * (i + 1) + 0.7 * j;
+        serial[i][j] = parallel[i][j] = 1.0 / (i + j + 1);
+      }
+
+    auto pool = std::make_shared<ThreadPool>(number_of_threads);
+    std::vector<typename CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy>::Function> functions(
+        number_of_threads, function);
+    CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy> evaluator(pool, functions);
+
+    function(input, serial);
+    evaluator(input, parallel);
+    function(input, serial);
+    evaluator(input, parallel);
+
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < 3; ++j)
+        EXPECT_EQ(parallel[i][j], serial[i][j]) << "cell " << i << " column " << j;
+  }
+}  // namespace
+
+TEST(CellBlocks, PartitionCoversEveryCellOnce)
+{
+  for (std::size_t cells : { 1, 5, 16, 37 })
+    for (std::size_t blocks : { 1, 2, 3, 8, 64 })
+      for (std::size_t group : { 1, 4 })
+      {
+        auto partition = PartitionCells(cells, blocks, group);
+        EXPECT_LE(partition.size(), blocks);
+        std::size_t next = 0;
+        for (const auto& block : partition)
+        {
+          EXPECT_EQ(block.first_cell_, next);
+          EXPECT_EQ(block.first_cell_ % group, 0);
+          EXPECT_GT(block.number_of_cells_, 0);
+          next += block.number_of_cells_;
+        }
+        EXPECT_EQ(next, cells);
+      }
+}
+
+TEST(CellBlocks, PartitionOfNothingIsEmpty)
+{
+  EXPECT_TRUE(PartitionCells(0, 4).empty());
+  EXPECT_TRUE(PartitionCells(4, 0).empty());
+}
+
+TEST(CellBlocks, PartitionAlignsToGroups)
+{
+  auto partition = PartitionCells(10, 2, 4);
+  ASSERT_EQ(partition.size(), 2);
+  EXPECT_EQ(partition[0].first_cell_, 0);
+  EXPECT_EQ(partition[0].number_of_cells_, 8);
+  EXPECT_EQ(partition[1].first_cell_, 8);
+  EXPECT_EQ(partition[1].number_of_cells_, 2);
+}
+
+TEST(CellBlocks, CellGroupSize)
+{
+  EXPECT_EQ(CellGroupSize<micm::Matrix<double>>(), 1);
+  EXPECT_EQ((CellGroupSize<micm::VectorMatrix<double, 4>>()), 4);
+}
+
+TEST(CellBlocks, MicmMatricesHaveCellGroupLayout)
+{
+  EXPECT_TRUE(HasCellGroupLayout<micm::Matrix<double>>());
+  EXPECT_TRUE((HasCellGroupLayout<micm::VectorMatrix<double, 1>>()));
+  EXPECT_TRUE((HasCellGroupLayout<micm::VectorMatrix<double, 3>>()));
+  EXPECT_TRUE((HasCellGroupLayout<micm::VectorMatrix<double, 4>>()));
+  EXPECT_NO_THROW(RequireCellGroupLayout<micm::VectorMatrix<double>>("CellBlocks test"));
+
+  // CellValueIndex() names the flat position of each value written through operator[]
+  using VectorMatrix = micm::VectorMatrix<double, 4>;
+  VectorMatrix matrix(6, 2, 0.0);
+  for (std::size_t cell = 0; cell < 6; ++cell)
+    for (std::size_t column = 0; column < 2; ++column)
+      matrix[cell][column] = 10.0 * cell + column;
+  for (std::size_t cell = 0; cell < 6; ++cell)
+    for (std::size_t column = 0; column < 2; ++column)
+      EXPECT_EQ(matrix.AsVector()[CellValueIndex<VectorMatrix>(cell, column, 2)], 10.0 * cell + column);
+}
+
+TEST(CellBlocks, EvaluatorMatchesSerialEvaluation)
+{
+  for (std::size_t threads : { 1, 2, 3, 4 })
+    for (std::size_t cells : { 1, 7, 33 })
+      CompareBlockEvaluation<micm::Matrix<double>>(cells, threads);
+}
+
+TEST(CellBlocks, EvaluatorMatchesSerialEvaluationVectorMatrix)
+{
+  for (std::size_t threads : { 1, 2, 3, 4 })
+    for (std::size_t cells : { 1, 7, 33 })
+      CompareBlockEvaluation<micm::VectorMatrix<double, 4>>(cells, threads);
+}
+
+TEST(CellBlocks, EvaluatorCopiesOnlyWrittenOutputValues)
+{
+  using DenseMatrixPolicy = micm::VectorMatrix<double, 4>;
+  constexpr std::size_t number_of_cells = 13;
+  // Writes columns 0 and 2 only; column 1 belongs to someone else and must keep its value
+  auto function = [](const DenseMatrixPolicy& input, DenseMatrixPolicy& output)
+  {
+    for (std::size_t i = 0; i < input.NumRows(); ++i)
+    {
+      output[i][0] += input[i][0];
+      output[i][2] += 2.0 * input[i][0];
+    }
+  };
+
+  DenseMatrixPolicy input(number_of_cells, 1, 0.0);
+  DenseMatrixPolicy output(number_of_cells, 3, 0.0);
+  for (std::size_t i = 0; i < number_of_cells; ++i)
+  {
+    input[i][0] = 1.0 + i;
+    output[i][0] = output[i][1] = output[i][2] = 0.5 * i;
+  }
+
+  auto pool = std::make_shared<ThreadPool>(3);
+  std::vector<typename CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy>::Function> functions(3, function);
+  CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy> evaluator(pool, functions, { 0, 2 });
+  evaluator(input, output);
+
+  for (std::size_t i = 0; i < number_of_cells; ++i)
+  {
+    EXPECT_EQ(output[i][0], 0.5 * i + (1.0 + i)) << "cell " << i;
+    EXPECT_EQ(output[i][1], 0.5 * i) << "cell " << i;
+    EXPECT_EQ(output[i][2], 0.5 * i + 2.0 * (1.0 + i)) << "cell " << i;
+  }
+}
+
+TEST(CellBlocks, EvaluatorCopiesOnlyReadInputColumns)
+{
+  using DenseMatrixPolicy = micm::VectorMatrix<double, 4>;
+  constexpr std::size_t number_of_cells = 13;
+  // Reads input column 2; column 1 is not listed, so the function sees the zero-filled block column
+  auto function = [](const DenseMatrixPolicy& input, DenseMatrixPolicy& output)
+  {
+    for (std::size_t i = 0; i < input.NumRows(); ++i)
+      output[i][0] = input[i][2] + input[i][1];
+  };
+
+  DenseMatrixPolicy input(number_of_cells, 3, 0.0);
+  DenseMatrixPolicy output(number_of_cells, 1, 0.0);
+  for (std::size_t i = 0; i < number_of_cells; ++i)
+  {
+    input[i][1] = 100.0;
+    input[i][2] = 1.0 + i;
+  }
+
+  auto pool = std::make_shared<ThreadPool>(3);
+  std::vector<typename CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy>::Function> functions(3, function);
+  CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy> evaluator(pool, functions, {}, { std::vector<std::size_t>{ 2 } });
+  evaluator(input, output);
+
+  for (std::size_t i = 0; i < number_of_cells; ++i)
+    EXPECT_EQ(output[i][0], 1.0 + i) << "cell " << i;
+}
+
+TEST(CellBlocks, EvaluatorConcurrentCallsUseTheirOwnArguments)
+{
+  using DenseMatrixPolicy = micm::Matrix<double>;
+  constexpr std::size_t number_of_cells = 10;
+  auto function = [](const DenseMatrixPolicy& input, DenseMatrixPolicy& output)
+  {
+    for (std::size_t i = 0; i < input.NumRows(); ++i)
+      output[i][0] += input[i][0];
+  };
+
+  auto pool = std::make_shared<ThreadPool>(2);
+  std::vector<typename CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy>::Function> functions(2, function);
+  CellBlockEvaluator<DenseMatrixPolicy, DenseMatrixPolicy> evaluator(pool, functions);
+
+  // Each caller adds its own input to its own output many times
+  constexpr std::size_t number_of_callers = 4;
+  constexpr std::size_t number_of_calls = 50;
+  std::vector<DenseMatrixPolicy> inputs;
+  std::vector<DenseMatrixPolicy> outputs;
+  for (std::size_t caller = 0; caller < number_of_callers; ++caller)
+  {
+    inputs.emplace_back(number_of_cells, 1, 1.0 + caller);
+    outputs.emplace_back(number_of_cells, 1, 0.0);
+  }
+  std::vector<std::thread> callers;
+  for (std::size_t caller = 0; caller < number_of_callers; ++caller)
+    callers.emplace_back(
+        [&, caller]
+        {
+          for (std::size_t call = 0; call < number_of_calls; ++call)
+            evaluator(inputs[caller], outputs[caller]);
+        });
+  for (auto& caller : callers)
+    caller.join();
+
+  for (std::size_t caller = 0; caller < number_of_callers; ++caller)
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      EXPECT_EQ(outputs[caller][i][0], number_of_calls * (1.0 + caller)) << "caller " << caller << " cell " << i;
+}
@@ -8,7 +8,10 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <limits>
 #include <numbers>
+#include <type_traits>
+#include <vector>
 
 using namespace miam;
 
@@ -352,3 +355,118 @@ TEST(CondensationRate, CAMPZaveri2008FormulaExact)
   double k_computed = provider.ComputeValue(r_test, N_test, T_test);
   EXPECT_NEAR(k_computed, k_expected, k_expected * 1.0e-12);
 }
+
+TEST(CondensationRate, KernelMatchesProvider)
+{
+  auto provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
+  auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+
+  for (double r_test : { 0.0, 1.0e-9, 1.0e-7, 1.0e-6, 1.0e-4 })
+    for (double T_test : { 220.0, 298.15, 320.0 })
+    {
+      EXPECT_DOUBLE_EQ(kernel.ComputeValue(r_test, N, T_test), provider.ComputeValue(r_test, N, T_test));
+
+      double k_kernel, dr_kernel, dN_kernel;
+      double k_provider, dr_provider, dN_provider;
+      kernel.ComputeValueAndDerivatives(r_test, N, T_test, k_kernel, dr_kernel, dN_kernel);
+      provider.ComputeValueAndDerivatives(r_test, N, T_test, k_provider, dr_provider, dN_provider);
+      EXPECT_DOUBLE_EQ(k_kernel, k_provider);
+      EXPECT_DOUBLE_EQ(dr_kernel, dr_provider);
+      EXPECT_DOUBLE_EQ(dN_kernel, dN_provider);
+    }
+}
+
+TEST(CondensationRate, MeanFreePathMatchesHandCalculation)
+{
+  auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+  for (double T_test : { 220.0, 298.15, 320.0 })
+  {
+    double expected = mean_free_path(D_g, mean_molecular_speed(T_test, gas_molecular_weight));
+    EXPECT_NEAR(kernel.MeanFreePath(T_test), expected, expected * 1.0e-12);
+  }
+  EXPECT_EQ(kernel.MeanFreePath(0.0), 0.0);
+  EXPECT_EQ(kernel.MeanFreePath(-5.0), 0.0);
+}
+
+TEST(CondensationRate, FromMeanFreePathMatchesTemperatureForm)
+{
+  auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+
+  for (double r_test : { 0.0, 1.0e-9, 1.0e-7, 1.0e-6, 1.0e-4 })
+    for (double T_test : { 0.0, 220.0, 298.15, 320.0 })
+    {
+      const double lambda = kernel.MeanFreePath(T_test);
+      EXPECT_EQ(kernel.ComputeValueFromMeanFreePath(r_test, N, lambda), kernel.ComputeValue(r_test, N, T_test));
+
+      double k, dr, dN;
+      double k_lambda, dr_lambda, dN_lambda;
+      kernel.ComputeValueAndDerivatives(r_test, N, T_test, k, dr, dN);
+      kernel.ComputeValueAndDerivativesFromMeanFreePath(r_test, N, lambda, k_lambda, dr_lambda, dN_lambda);
+      EXPECT_EQ(k_lambda, k);
+      EXPECT_EQ(dr_lambda, dr);
+      EXPECT_EQ(dN_lambda, dN);
+    }
+}
+
+TEST(CondensationRate, KernelIsConstexprConstructible)
+{
+  constexpr FuchsSutuginKernel kernel{ D_g, alpha, gas_molecular_weight };
+  static_assert(kernel.f_numerator_ == 0.75 * alpha);
+  static_assert(std::is_trivially_copyable_v<FuchsSutuginKernel>);
+  auto runtime_kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+  EXPECT_DOUBLE_EQ(kernel.ComputeValue(r_eff, N, T), runtime_kernel.ComputeValue(r_eff, N, T));
+}
+
+TEST(CondensationRate, KernelFactoryRejectsInvalidParameters)
+{
+  EXPECT_ANY_THROW(MakeFuchsSutuginKernel(0.0, alpha, gas_molecular_weight));
+  EXPECT_ANY_THROW(MakeFuchsSutuginKernel(D_g, 0.0, gas_molecular_weight));
+  EXPECT_ANY_THROW(MakeFuchsSutuginKernel(D_g, alpha, -1.0));
+}
+
+TEST(CondensationRate, FromMeanFreePathMasksInvalidCells)
+{
+  auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+  const double lambda = mean_free_path(D_g, mean_molecular_speed(T, gas_molecular_weight));
+
+  // Valid cells follow the hand calculation
+  const double Kn = lambda / r_eff;
+  const double expected = 4.0 * std::numbers::pi * r_eff * N * D_g * fuchs_sutugin(Kn, alpha);
+  EXPECT_NEAR(kernel.ComputeValueFromMeanFreePath(r_eff, N, lambda), expected, expected * 1.0e-14);
+
+  // Cells with a non-positive input are evaluated with unit inputs and masked to exactly zero
+  std::vector<double> r_in{ 0.0, -1.0e-6, r_eff, r_eff, r_eff };
+  std::vector<double> N_in{ N, N, 0.0, -1.0, N };
+  std::vector<double> lambda_in{ lambda, lambda, lambda, lambda, 0.0 };
+  for (std::size_t i = 0; i < r_in.size(); ++i)
+  {
+    EXPECT_EQ(kernel.ComputeValueFromMeanFreePath(r_in[i], N_in[i], lambda_in[i]), 0.0) << "cell " << i;
+    double k, dr, dN;
+    kernel.ComputeValueAndDerivativesFromMeanFreePath(r_in[i], N_in[i], lambda_in[i], k, dr, dN);
+    EXPECT_EQ(k, 0.0) << "cell " << i;
+    EXPECT_EQ(dr, 0.0) << "cell " << i;
+    EXPECT_EQ(dN, 0.0) << "cell " << i;
+  }
+}
+
+TEST(CondensationRate, FromMeanFreePathPropagatesNaN)
+{
+  auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+  const double lambda = mean_free_path(D_g, mean_molecular_speed(T, gas_molecular_weight));
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  // A NaN input is not treated as an invalid cell: the rate and its partials are NaN, not zero
+  std::vector<double> r_in{ nan, r_eff, r_eff };
+  std::vector<double> N_in{ N, nan, N };
+  std::vector<double> lambda_in{ lambda, lambda, nan };
+  for (std::size_t i = 0; i < r_in.size(); ++i)
+  {
+    EXPECT_TRUE(std::isnan(kernel.ComputeValueFromMeanFreePath(r_in[i], N_in[i], lambda_in[i]))) << "cell " << i;
+    double k, dr, dN;
+    kernel.ComputeValueAndDerivativesFromMeanFreePath(r_in[i], N_in[i], lambda_in[i], k, dr, dN);
+    EXPECT_TRUE(std::isnan(k)) << "cell " << i;
+    EXPECT_TRUE(std::isnan(dr)) << "cell " << i;
+    EXPECT_TRUE(std::isnan(dN)) << "cell " << i;
+  }
+  EXPECT_TRUE(std::isnan(kernel.ComputeValue(r_eff, N, nan)));
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/util/constant_jacobian.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_vector_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+using namespace miam;
+
+namespace
+{
+  /// @brief Adds constant elements to a Jacobian that also has state-dependent elements
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void TestConstantJacobian(std::size_t number_of_cells)
+  {
+    // Row 1 is a linear constraint row; (0, 0) and (2, 1) are written by other functions
+    auto builder = SparseMatrixPolicy::Create(3).SetNumberOfBlocks(number_of_cells).InitialValue(0.5);
+    for (const auto& [row, col] :
+         { std::pair{ 0, 0 }, std::pair{ 1, 0 }, std::pair{ 1, 1 }, std::pair{ 1, 2 }, std::pair{ 2, 1 } })
+      builder = builder.WithElement(row, col);
+    SparseMatrixPolicy jacobian(builder);
+
+    ConstantJacobian elements;
+    EXPECT_TRUE(elements.Empty());
+    elements.Add(1, 2, -3.0);
+    elements.Add(1, 0, -1.0);
+    elements.Add(1, 1, 2.0);
+    elements.Add(1, 0, -1.5);  // duplicates are summed
+    elements.Add(2, 1, 0.25);
+    EXPECT_FALSE(elements.Empty());
+    EXPECT_EQ(elements.Elements().size(), 5);
+
+    std::map<std::pair<std::size_t, std::size_t>, double> expected{
+      { { 0, 0 }, 0.5 }, { { 1, 0 }, 0.5 - 2.5 }, { { 1, 1 }, 0.5 + 2.0 }, { { 1, 2 }, 0.5 - 3.0 }, { { 2, 1 }, 0.75 }
+    };
+
+    DenseMatrixPolicy state(number_of_cells, 3, 1.0);
+    auto function = elements.Function<DenseMatrixPolicy, SparseMatrixPolicy>(jacobian);
+    function(state, state, jacobian);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+      for (const auto& [element, value] : expected)
+        EXPECT_DOUBLE_EQ(jacobian[cell][element.first][element.second], value)
+            << "cell " << cell << " element (" << element.first << ", " << element.second << ")";
+
+    // The contributions accumulate on each call
+    function(state, state, jacobian);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    {
+      EXPECT_DOUBLE_EQ(jacobian[cell][0][0], 0.5);
+      EXPECT_DOUBLE_EQ(jacobian[cell][1][2], 0.5 - 6.0);
+      EXPECT_DOUBLE_EQ(jacobian[cell][2][1], 1.0);
+    }
+  }
+}  // namespace
+
+TEST(ConstantJacobian, StandardOrdering)
+{
+  TestConstantJacobian<micm::Matrix<double>, micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>>(1);
+  TestConstantJacobian<micm::Matrix<double>, micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>>(5);
+}
+
+TEST(ConstantJacobian, VectorOrdering)
+{
+  // Six cells fill one group of four and part of a second
+  using VectorJacobian = micm::SparseMatrix<double, micm::SparseMatrixVectorOrderingCompressedSparseRow<4>>;
+  TestConstantJacobian<micm::VectorMatrix<double, 4>, VectorJacobian>(4);
+  TestConstantJacobian<micm::VectorMatrix<double, 4>, VectorJacobian>(6);
+}
+
+TEST(ConstantJacobian, AppendCombinesElements)
+{
+  ConstantJacobian first;
+  first.Add(0, 0, 1.0);
+  ConstantJacobian second;
+  second.Add(0, 0, 2.0);
+  second.Add(1, 0, 3.0);
+  first.Append(second);
+  ASSERT_EQ(first.Elements().size(), 3);
+  EXPECT_EQ(first.Elements()[2].dependent_, 1);
+  EXPECT_DOUBLE_EQ(first.Elements()[2].value_, 3.0);
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/constraints/linear_constraint_system.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  /// @brief Two fixed rows and one diagnosed row over five state variables and two state parameters
+  LinearConstraintSystem MakeSystem()
+  {
+    LinearConstraintSystem system;
+    system.AddRow(0, { { 0, 1.0 }, { 1, 1.0 }, { 2, 2.0 } }, 10.0);  // mass balance at variable 0
+    system.AddDiagnosedRow(3, { { 3, 1.0 }, { 4, -1.0 } }, 1);      // charge balance at variable 3
+    system.AddRow(4, { { 4, -0.5 } }, 0.0);                         // single-term row at variable 4
+    return system;
+  }
+
+  template<typename DenseMatrixPolicy>
+  void TestLinearConstraintSystem(std::size_t number_of_cells)
+  {
+    auto system = MakeSystem();
+    EXPECT_FALSE(system.Empty());
+    EXPECT_EQ(system.NumberOfRows(), 3);
+    EXPECT_EQ(system.NumberOfCoefficients(), 6);
+    EXPECT_TRUE(system.HasDiagnosedRows());
+
+    DenseMatrixPolicy variables(number_of_cells, 5, 0.0);
+    DenseMatrixPolicy parameters(number_of_cells, 2, -1.0);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+      for (std::size_t i = 0; i < 5; ++i)
+        variables[cell][i] = 1.0 + static_cast<double>(i) + 0.1 * static_cast<double>(cell);
+
+    // The diagnosed constant is the row sum at the current state; other parameters are untouched
+    system.template DiagnoseConstantsFunction<DenseMatrixPolicy>()(variables, parameters);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    {
+      EXPECT_DOUBLE_EQ(parameters[cell][1], variables[cell][3] - variables[cell][4]);
+      EXPECT_DOUBLE_EQ(parameters[cell][0], -1.0);
+    }
+
+    // The residual reads the diagnosed constant, so the diagnosed row is zero at the diagnosed state
+    DenseMatrixPolicy residual(number_of_cells, 5, 7.0);
+    auto residual_fn = system.template ResidualFunction<DenseMatrixPolicy>();
+    residual_fn(variables, parameters, residual);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    {
+      EXPECT_NEAR(
+          residual[cell][0], variables[cell][0] + variables[cell][1] + 2.0 * variables[cell][2] - 10.0, 1.0e-12);
+      EXPECT_DOUBLE_EQ(residual[cell][3], 0.0);
+      EXPECT_DOUBLE_EQ(residual[cell][4], -0.5 * variables[cell][4]);
+      // Rows without a constraint keep their values
+      EXPECT_DOUBLE_EQ(residual[cell][1], 7.0);
+      EXPECT_DOUBLE_EQ(residual[cell][2], 7.0);
+    }
+
+    // Residuals are set, not accumulated
+    variables[0][4] += 1.0;
+    residual_fn(variables, parameters, residual);
+    EXPECT_DOUBLE_EQ(residual[0][3], -1.0);
+    EXPECT_DOUBLE_EQ(residual[0][4], -0.5 * variables[0][4]);
+  }
+}  // namespace
+
+TEST(LinearConstraintSystem, StandardMatrix)
+{
+  TestLinearConstraintSystem<micm::Matrix<double>>(1);
+  TestLinearConstraintSystem<micm::Matrix<double>>(3);
+}
+
+TEST(LinearConstraintSystem, VectorMatrix)
+{
+  TestLinearConstraintSystem<micm::VectorMatrix<double, 4>>(3);
+  TestLinearConstraintSystem<micm::VectorMatrix<double, 4>>(6);
+}
+
+TEST(LinearConstraintSystem, FixedRowsIgnoreStateParameters)
+{
+  LinearConstraintSystem system;
+  EXPECT_TRUE(system.Empty());
+  system.AddRow(1, { { 0, 3.0 } }, 1.0);
+  EXPECT_FALSE(system.HasDiagnosedRows());
+
+  micm::Matrix<double> variables(2, 2, 2.0);
+  micm::Matrix<double> no_parameters{};
+  micm::Matrix<double> residual(2, 2, 0.0);
+  system.DiagnoseConstantsFunction<micm::Matrix<double>>()(variables, no_parameters);
+  system.ResidualFunction<micm::Matrix<double>>()(variables, no_parameters, residual);
+  for (std::size_t cell = 0; cell < 2; ++cell)
+  {
+    EXPECT_DOUBLE_EQ(residual[cell][0], 0.0);
+    EXPECT_DOUBLE_EQ(residual[cell][1], 5.0);
+  }
+}
+
+TEST(LinearConstraintSystem, RowRangeSetsOnlyItsRows)
+{
+  auto system = MakeSystem();
+  micm::VectorMatrix<double, 4> variables(5, 5, 1.0);
+  micm::VectorMatrix<double, 4> parameters(5, 2, 0.5);
+  micm::VectorMatrix<double, 4> residual(5, 5, 7.0);
+  system.ResidualFunction<micm::VectorMatrix<double, 4>>(1, 3)(variables, parameters, residual);
+  for (std::size_t cell = 0; cell < 5; ++cell)
+  {
+    EXPECT_DOUBLE_EQ(residual[cell][0], 7.0);
+    EXPECT_DOUBLE_EQ(residual[cell][3], -0.5);
+    EXPECT_DOUBLE_EQ(residual[cell][4], -0.5);
+  }
+}
@@ -1,8 +1,12 @@
 // Copyright (C) 2026 University Corporation for Atmospheric Research
 // SPDX-License-Identifier: Apache-2.0
 
+#include <miam/constraints/linear_constraint_builder.hpp>
 #include <miam/model/model.hpp>
+#include <miam/processes/dissolved_reaction.hpp>
 #include <miam/processes/dissolved_reversible_reaction.hpp>
+#include <miam/processes/henry_law_phase_transfer.hpp>
+#include <miam/representations/sectional_distribution.hpp>
 #include <miam/representations/single_moment_mode.hpp>
 #include <miam/representations/two_moment_mode.hpp>
 #include <miam/representations/uniform_section.hpp>
@@ -10,11 +14,251 @@
 #include <micm/system/conditions.hpp>
 #include <micm/system/phase.hpp>
 #include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+#include <micm/util/sparse_matrix_vector_ordering.hpp>
+#include <micm/util/vector_matrix.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
 using namespace miam;
 
+namespace
+{
+  /// Builds a model with irreversible, rate-capped and reversible reactions across two modes
+  Model MakeMixedReactionModel()
+  {
+    auto h2o = micm::Species{ "H2O" };
+    auto co2 = micm::Species{ "CO2" };
+    auto h2co3 = micm::Species{ "H2CO3" };
+    auto hp = micm::Species{ "H+" };
+    auto hco3m = micm::Species{ "HCO3-" };
+
+    auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { co2 }, { h2co3 }, { hp }, { hco3m } } };
+
+    auto mode1 = SingleMomentMode{ "MODE1", { aqueous_phase } };
+    auto mode2 = TwoMomentMode{ "MODE2", { aqueous_phase } };
+
+    auto k1 = [](const micm::Conditions& conditions) { return 2.0e-3; };
+    auto k2 = [](const micm::Conditions& conditions) { return 5.0e1; };
+    auto k3 = [](const micm::Conditions& conditions) { return 3.0e-2; };
+
+    // CO2 + H2O -> H2CO3 (fused)
+    DissolvedReaction hydration{ { { "MODE1", k1 }, { "MODE2", k1 } }, { co2, h2o }, { h2co3 }, h2o, aqueous_phase };
+    // H2CO3 -> CO2 + H2O with rate capping (not fusable)
+    DissolvedReaction dehydration{
+      { { "MODE1", k3 }, { "MODE2", k3 } }, { h2co3 }, { co2, h2o }, h2o, aqueous_phase, 1.0e-20, 10.0
+    };
+    // H2CO3 <-> H+ + HCO3- (fused)
+    DissolvedReversibleReaction dissociation{ { { "MODE1", k1 }, { "MODE2", k1 } },
+                                              { { "MODE1", k2 }, { "MODE2", k2 } },
+                                              { h2co3 },
+                                              { hp, hco3m },
+                                              h2o,
+                                              aqueous_phase };
+
+    Model model;
+    model.name_ = "TEST_MODEL";
+    model.representations_.push_back(mode1);
+    model.representations_.push_back(mode2);
+    model.AddProcesses(hydration, dehydration, dissociation);
+    return model;
+  }
+
+  /// Builds a model where two phase-transfer processes share a gas species and a reaction links their solutes
+  Model MakePhaseTransferModel()
+  {
+    auto h2o = micm::Species{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    auto a_g = micm::Species{ "A_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+    auto a_aq = micm::Species{ "A_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } };
+    auto b_aq = micm::Species{ "B_aq", { { "molecular weight [kg mol-1]", 0.062 }, { "density [kg m-3]", 1500.0 } } };
+    auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a_aq }, { b_aq } } };
+
+    auto hlc = [](const micm::Conditions& conditions) { return 3.4e-2; };
+    auto k = [](const micm::Conditions& conditions) { return 4.0e-3; };
+
+    Model model;
+    model.name_ = "TRANSFER_MODEL";
+    model.representations_.push_back(SingleMomentMode{ "MODE1", { aqueous_phase } });
+    model.representations_.push_back(SectionalDistribution{ "CLOUD", { aqueous_phase }, 2, 1.0e-6, 1.0e-4 });
+    model.AddProcesses(
+        HenryLawPhaseTransfer{ hlc, a_g, a_aq, h2o, aqueous_phase, 1.5e-5, 0.05, 0.044, 0.018, 1000.0 },
+        DissolvedReaction{ { { "MODE1", k }, { "CLOUD.BIN_0", k }, { "CLOUD.BIN_1", k } },
+                           { a_aq },
+                           { b_aq },
+                           h2o,
+                           aqueous_phase },
+        HenryLawPhaseTransfer{ hlc, a_g, b_aq, h2o, aqueous_phase, 1.2e-5, 0.02, 0.044, 0.018, 1000.0 });
+    return model;
+  }
+
+  /// Fills parameters and variables with distinct, positive values
+  template<typename DenseMatrixPolicy>
+  void FillState(DenseMatrixPolicy& parameters, DenseMatrixPolicy& variables)
+  {
+    for (std::size_t i_cell = 0; i_cell < variables.NumRows(); ++i_cell)
+    {
+      for (std::size_t i = 0; i < parameters.NumColumns(); ++i)
+        parameters[i_cell][i] = 1.0e-2 * (1.0 + 0.1 * i + 0.3 * i_cell);
+      for (std::size_t i = 0; i < variables.NumColumns(); ++i)
+        variables[i_cell][i] = 0.5 + 0.25 * i + 0.1 * i_cell;
+    }
+  }
+
+  /// Compares the compiled forcing path against the per-process path for a matrix policy
+  template<typename DenseMatrixPolicy>
+  void CompareCompiledForcing(std::size_t number_of_cells)
+  {
+    Model model = MakeMixedReactionModel();
+
+    std::unordered_map<std::string, std::size_t> variable_indices;
+    std::unordered_map<std::string, std::size_t> parameter_indices;
+    std::size_t idx = 0;
+    for (const auto& name : model.StateVariableNames())
+      variable_indices[name] = idx++;
+    idx = 0;
+    for (const auto& name : model.StateParameterNames())
+      parameter_indices[name] = idx++;
+
+    DenseMatrixPolicy parameters(number_of_cells, parameter_indices.size(), 0.0);
+    DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 0.0);
+    FillState(parameters, variables);
+
+    DenseMatrixPolicy reference(number_of_cells, variable_indices.size(), 0.0);
+    DenseMatrixPolicy compiled(number_of_cells, variable_indices.size(), 0.0);
+
+    auto reference_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+    model.options_.compiled_forcing_ = true;
+    auto compiled_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+
+    reference_fn(parameters, variables, reference);
+    compiled_fn(parameters, variables, compiled);
+
+    for (std::size_t i_cell = 0; i_cell < number_of_cells; ++i_cell)
+    {
+      for (std::size_t i = 0; i < variable_indices.size(); ++i)
+      {
+        EXPECT_NEAR(compiled[i_cell][i], reference[i_cell][i], 1.0e-12 * std::abs(reference[i_cell][i]) + 1.0e-300)
+            << "cell " << i_cell << " variable " << i;
+      }
+    }
+  }
+
+  /// Compares thread-parallel Model functions against the serial functions; results must be bitwise equal
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void CompareCellParallel(std::size_t number_of_cells, std::size_t number_of_threads)
+  {
+    Model model = MakeMixedReactionModel();
+
+    std::unordered_map<std::string, std::size_t> variable_indices;
+    std::unordered_map<std::string, std::size_t> parameter_indices;
+    std::size_t idx = 0;
+    for (const auto& name : model.StateVariableNames())
+      variable_indices[name] = idx++;
+    idx = 0;
+    for (const auto& name : model.StateParameterNames())
+      parameter_indices[name] = idx++;
+
+    std::vector<micm::Conditions> conditions(number_of_cells);
+    for (std::size_t i_cell = 0; i_cell < number_of_cells; ++i_cell)
+      conditions[i_cell].temperature_ = 270.0 + i_cell;
+    DenseMatrixPolicy serial_parameters(number_of_cells, parameter_indices.size(), 0.0);
+    DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 0.0);
+    FillState(serial_parameters, variables);
+    DenseMatrixPolicy parallel_parameters = serial_parameters;
+
+    auto builder =
+        SparseMatrixPolicy::Create(variable_indices.size()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+    for (const auto& element : model.NonZeroJacobianElements(variable_indices))
+      builder = builder.WithElement(element.first, element.second);
+    SparseMatrixPolicy serial_jacobian(builder);
+    SparseMatrixPolicy parallel_jacobian(builder);
+    DenseMatrixPolicy serial_forcing(number_of_cells, variable_indices.size(), 0.0);
+    DenseMatrixPolicy parallel_forcing(number_of_cells, variable_indices.size(), 0.0);
+
+    auto serial_update = model.UpdateStateParametersFunction<DenseMatrixPolicy>(parameter_indices);
+    auto serial_forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+    auto serial_jacobian_fn = model.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        parameter_indices, variable_indices, serial_jacobian);
+    model.options_.thread_pool_ = std::make_shared<ThreadPool>(number_of_threads);
+    auto parallel_update = model.UpdateStateParametersFunction<DenseMatrixPolicy>(parameter_indices);
+    auto parallel_forcing_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+    auto parallel_jacobian_fn = model.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        parameter_indices, variable_indices, parallel_jacobian);
+
+    // Evaluate twice to exercise the reuse of the block workspaces
+    for (int call = 0; call < 2; ++call)
+    {
+      serial_update(conditions, serial_parameters);
+      parallel_update(conditions, parallel_parameters);
+      serial_forcing_fn(serial_parameters, variables, serial_forcing);
+      parallel_forcing_fn(parallel_parameters, variables, parallel_forcing);
+      serial_jacobian_fn(serial_parameters, variables, serial_jacobian);
+      parallel_jacobian_fn(parallel_parameters, variables, parallel_jacobian);
+    }
+
+    EXPECT_EQ(parallel_parameters.AsVector(), serial_parameters.AsVector());
+    EXPECT_EQ(parallel_forcing.AsVector(), serial_forcing.AsVector());
+    EXPECT_EQ(parallel_jacobian.AsVector(), serial_jacobian.AsVector());
+  }
+
+  /// Compares the process-parallel forcing against the serial forcing and returns it
+  /// Gas-phase columns add each process's contribution as one sum, so they match to rounding rather than bitwise.
+  /// A copy of the parallel function, called concurrently with the original, must give the same result.
+  template<typename DenseMatrixPolicy>
+  std::vector<double> CompareProcessParallel(Model model, std::size_t number_of_cells, std::size_t number_of_threads)
+  {
+    std::unordered_map<std::string, std::size_t> variable_indices;
+    std::unordered_map<std::string, std::size_t> parameter_indices;
+    std::size_t idx = 0;
+    variable_indices["A_g"] = idx++;
+    for (const auto& name : model.StateVariableNames())
+      variable_indices[name] = idx++;
+    idx = 0;
+    for (const auto& name : model.StateParameterNames())
+      parameter_indices[name] = idx++;
+
+    DenseMatrixPolicy parameters(number_of_cells, parameter_indices.size(), 0.0);
+    DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 0.0);
+    FillState(parameters, variables);
+    DenseMatrixPolicy serial(number_of_cells, variable_indices.size(), 0.0);
+    DenseMatrixPolicy parallel(number_of_cells, variable_indices.size(), 0.0);
+
+    auto serial_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+    model.options_.thread_pool_ = std::make_shared<ThreadPool>(number_of_threads);
+    model.options_.process_parallel_forcing_ = true;
+    auto parallel_fn = model.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+    auto copy_fn = parallel_fn;
+    DenseMatrixPolicy copy(number_of_cells, variable_indices.size(), 0.0);
+
+    for (int call = 0; call < 2; ++call)
+    {
+      serial_fn(parameters, variables, serial);
+      std::thread other([&] { copy_fn(parameters, variables, copy); });
+      parallel_fn(parameters, variables, parallel);
+      other.join();
+    }
+    double scale = 0.0;
+    for (const double value : serial.AsVector())
+      scale = std::max(scale, std::abs(value));
+    for (std::size_t k = 0; k < serial.AsVector().size(); ++k)
+      EXPECT_NEAR(parallel.AsVector()[k], serial.AsVector()[k], 1.0e-13 * scale) << "value " << k;
+    EXPECT_EQ(copy.AsVector(), parallel.AsVector());
+    return parallel.AsVector();
+  }
+}  // namespace
+
 TEST(Model, SpeciesUsedWithNoProcesses)
 {
   auto h2o = micm::Species{ "H2O" };
@@ -406,6 +650,43 @@ TEST(Model, NonZeroJacobianElementsWithMultipleProcesses)
   EXPECT_TRUE(jacobian_elements.find({ 4, 3 }) != jacobian_elements.end());  // d[H2CO3]/d[CO2]
 }
 
+TEST(Model, JacobianSparsityPatternMatchesNonZeroJacobianElements)
+{
+  auto h2o = micm::Species{ "H2O" };
+  auto hp = micm::Species{ "H+" };
+  auto ohm = micm::Species{ "OH-" };
+  auto co2 = micm::Species{ "CO2" };
+  auto h2co3 = micm::Species{ "H2CO3" };
+
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { hp }, { ohm }, { co2 }, { h2co3 } } };
+
+  Model model;
+  model.name_ = "TEST_MODEL";
+  model.representations_.push_back(TwoMomentMode{ "AITKEN", { aqueous_phase } });
+  model.representations_.push_back(TwoMomentMode{ "ACCUMULATION", { aqueous_phase } });
+  model.processes_.push_back(DissolvedReversibleReaction{ { { "AITKEN", 1.0e-14 }, { "ACCUMULATION", 1.0e-14 } },
+                                                          { { "AITKEN", 1.0e11 }, { "ACCUMULATION", 1.0e11 } },
+                                                          { h2o },
+                                                          { hp, ohm },
+                                                          h2o,
+                                                          aqueous_phase });
+  model.processes_.push_back(DissolvedReaction{
+      { { "AITKEN", 1.0e-3 }, { "ACCUMULATION", 1.0e-3 } }, { co2, h2o }, { h2co3 }, h2o, aqueous_phase });
+
+  std::unordered_map<std::string, std::size_t> state_indices;
+  std::size_t index = 0;
+  for (const auto& prefix : { "AITKEN", "ACCUMULATION" })
+    for (const auto& species : { "H2O", "H+", "OH-", "CO2", "H2CO3" })
+      state_indices[std::string(prefix) + ".AQUEOUS." + species] = index++;
+
+  auto pattern = model.JacobianSparsityPattern(state_indices);
+  auto jacobian_elements = model.NonZeroJacobianElements(state_indices);
+
+  EXPECT_TRUE(pattern.IsFinalized());
+  ASSERT_EQ(pattern.Size(), jacobian_elements.size());
+  EXPECT_TRUE(std::equal(pattern.begin(), pattern.end(), jacobian_elements.begin()));
+}
+
 TEST(Model, NonZeroJacobianElementsWithMultipleRepresentations)
 {
   auto h2o = micm::Species{ "H2O" };
@@ -453,6 +734,49 @@ TEST(Model, NonZeroJacobianElementsWithMultipleRepresentations)
   EXPECT_TRUE(jacobian_elements.find({ 4, 5 }) != jacobian_elements.end());  // LARGE_DROP
 }
 
+TEST(Model, NonZeroJacobianElementsWithSectionalDistribution)
+{
+  auto h2o = micm::Species{ "H2O" };
+  auto hp = micm::Species{ "H+" };
+  auto ohm = micm::Species{ "OH-" };
+
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { hp }, { ohm } } };
+
+  auto sections = SectionalDistribution{ "DROPS", { aqueous_phase }, 3, 1.0e-6, 1.0e-4 };
+
+  std::map<std::string, RateConstant> forward_rates;
+  std::map<std::string, RateConstant> reverse_rates;
+  for (std::size_t bin = 0; bin < sections.NumberOfBins(); ++bin)
+  {
+    forward_rates.emplace(sections.BinPrefix(bin), 1.0e-14);
+    reverse_rates.emplace(sections.BinPrefix(bin), 1.0e11);
+  }
+
+  Model model;
+  model.name_ = "TEST_MODEL";
+  model.representations_.push_back(sections);
+  model.processes_.push_back(
+      DissolvedReversibleReaction{ forward_rates, reverse_rates, { h2o }, { hp, ohm }, h2o, aqueous_phase });
+
+  EXPECT_EQ(model.StateVariableNames().size(), 9);
+  EXPECT_EQ(model.StateParameterNames().size(), 6 + 2);  // 2 radii per bin + shared forward and reverse rates
+
+  std::unordered_map<std::string, std::size_t> state_indices;
+  for (const auto& name : sections.StateVariableNames())
+    state_indices[name] = state_indices.size();
+
+  auto jacobian_elements = model.NonZeroJacobianElements(state_indices);
+
+  // 9 elements per bin, no coupling between bins
+  EXPECT_EQ(jacobian_elements.size(), 27);
+  for (std::size_t bin = 0; bin < sections.NumberOfBins(); ++bin)
+  {
+    std::size_t h2o_idx = state_indices.at(sections.Species(bin, aqueous_phase, h2o));
+    std::size_t hp_idx = state_indices.at(sections.Species(bin, aqueous_phase, hp));
+    EXPECT_TRUE(jacobian_elements.find({ hp_idx, h2o_idx }) != jacobian_elements.end());
+  }
+}
+
 TEST(Model, NonZeroJacobianElementsMixedTypes)
 {
   auto h2o = micm::Species{ "H2O" };
@@ -499,3 +823,366 @@ TEST(Model, NonZeroJacobianElementsMixedTypes)
   EXPECT_TRUE(jacobian_elements.find({ 3, 4 }) != jacobian_elements.end());  // MODE2
   EXPECT_TRUE(jacobian_elements.find({ 5, 3 }) != jacobian_elements.end());  // MODE2
 }
+
+TEST(Model, CompiledForcingMatchesPerProcessForcing)
+{
+  CompareCompiledForcing<micm::Matrix<double>>(3);
+}
+
+TEST(Model, CompiledForcingMatchesPerProcessForcingVectorMatrix)
+{
+  CompareCompiledForcing<micm::VectorMatrix<double, 4>>(7);
+  CompareCompiledForcing<micm::VectorMatrix<double, 3>>(5);
+}
+
+TEST(Model, CompiledForcingDefaultsOff)
+{
+  Model model;
+  EXPECT_FALSE(model.options_.compiled_forcing_);
+}
+
+TEST(Model, CellParallelMatchesSerial)
+{
+  using SparseMatrixPolicy = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+  for (std::size_t threads : { 2, 3, 8 })
+    for (std::size_t cells : { 1, 5, 16 })
+      CompareCellParallel<micm::Matrix<double>, SparseMatrixPolicy>(cells, threads);
+}
+
+TEST(Model, CellParallelMatchesSerialVectorMatrix)
+{
+  using SparseMatrixPolicy = micm::SparseMatrix<double, micm::SparseMatrixVectorOrderingCompressedSparseRow<4>>;
+  for (std::size_t threads : { 2, 3, 8 })
+    for (std::size_t cells : { 1, 5, 16 })
+      CompareCellParallel<micm::VectorMatrix<double, 4>, SparseMatrixPolicy>(cells, threads);
+}
+
+TEST(Model, CellParallelDefaultsOff)
+{
+  Model model;
+  EXPECT_FALSE(model.options_.thread_pool_);
+}
+
+TEST(Model, ProcessParallelForcingMatchesSerial)
+{
+  for (std::size_t threads : { 2, 4 })
+  {
+    CompareProcessParallel<micm::Matrix<double>>(MakeMixedReactionModel(), 3, threads);
+    CompareProcessParallel<micm::Matrix<double>>(MakePhaseTransferModel(), 3, threads);
+  }
+}
+
+TEST(Model, ProcessParallelForcingMatchesSerialVectorMatrix)
+{
+  for (std::size_t threads : { 2, 4 })
+  {
+    CompareProcessParallel<micm::VectorMatrix<double, 4>>(MakeMixedReactionModel(), 7, threads);
+    CompareProcessParallel<micm::VectorMatrix<double, 4>>(MakePhaseTransferModel(), 7, threads);
+  }
+}
+
+TEST(Model, ProcessParallelForcingDoesNotDependOnThreadCount)
+{
+  using DenseMatrixPolicy = micm::VectorMatrix<double, 4>;
+  const auto two_threads = CompareProcessParallel<DenseMatrixPolicy>(MakePhaseTransferModel(), 7, 2);
+  for (std::size_t threads : { 3, 4 })
+    EXPECT_EQ(CompareProcessParallel<DenseMatrixPolicy>(MakePhaseTransferModel(), 7, threads), two_threads)
+        << threads << " threads";
+}
+
+TEST(Model, ProcessParallelForcingDefaultsOff)
+{
+  Model model;
+  EXPECT_FALSE(model.options_.process_parallel_forcing_);
+}
+
+TEST(Model, SpecializeRemovesProcessesAndConstraintsOfRemovedPhases)
+{
+  auto h2o = micm::Species{ "H2O" };
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto org = micm::Species{ "ORG" };
+  auto c = micm::Species{ "C" };
+  auto d = micm::Species{ "D" };
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a }, { b } } };
+  auto organic_phase = micm::Phase{ "ORGANIC", { { org }, { c }, { d } } };
+  auto k = [](const micm::Conditions& conditions) { return 1.0e-3; };
+
+  Model model;
+  model.name_ = "FULL";
+  model.representations_.push_back(SingleMomentMode{ "CLOUD", { aqueous_phase } });
+  model.representations_.push_back(UniformSection{ "RAIN", { aqueous_phase } });
+  model.representations_.push_back(SingleMomentMode{ "AEROSOL", { organic_phase } });
+  model.AddProcesses(
+      DissolvedReaction{ { { "CLOUD", k }, { "RAIN", k } }, { a }, { b }, h2o, aqueous_phase },
+      DissolvedReaction{ { { "AEROSOL", k } }, { c }, { d }, org, organic_phase });
+  model.AddConstraints(LinearConstraintBuilder()
+                           .SetAlgebraicSpecies(aqueous_phase, b)
+                           .AddTerm(aqueous_phase, a, 1.0)
+                           .AddTerm(aqueous_phase, b, 1.0)
+                           .SetConstant(1.0)
+                           .Build());
+  model.options_.active_cell_thresholds_["CLOUD"] = ActivityThreshold{ "CLOUD.AQUEOUS.H2O", 1.0e-10 };
+  EXPECT_EQ(model.RepresentationPrefixes(), (std::set<std::string>{ "AEROSOL", "CLOUD", "RAIN" }));
+
+  // Without cloud and rain the aqueous reaction and the aqueous constraint are removed
+  auto clear = model.Specialize({ "AEROSOL" });
+  EXPECT_EQ(clear.representations_.size(), 1);
+  EXPECT_EQ(clear.processes_.size(), 1);
+  EXPECT_EQ(clear.constraints_.size(), 0);
+  EXPECT_TRUE(clear.options_.active_cell_thresholds_.empty());
+  for (const auto& name : clear.StateVariableNames())
+    EXPECT_TRUE(name.starts_with("AEROSOL.")) << name;
+  EXPECT_EQ(
+      std::get<DissolvedReaction>(clear.processes_[0]).uuid_, std::get<DissolvedReaction>(model.processes_[1]).uuid_);
+
+  // Without cloud the aqueous reaction and constraint keep acting on rain
+  auto rain = model.Specialize({ "AEROSOL", "RAIN" });
+  EXPECT_EQ(rain.processes_.size(), 2);
+  EXPECT_EQ(rain.constraints_.size(), 1);
+  for (const auto& name : rain.SpeciesUsed())
+    EXPECT_FALSE(name.starts_with("CLOUD.")) << name;
+  EXPECT_TRUE(rain.SpeciesUsed().contains("RAIN.AQUEOUS.A"));
+  EXPECT_EQ(rain.ConstraintAlgebraicVariableNames(), (std::set<std::string>{ "RAIN.AQUEOUS.B" }));
+
+  // Keeping every representation keeps the Model
+  auto full = model.Specialize(model.RepresentationPrefixes());
+  EXPECT_EQ(full.processes_.size(), 2);
+  EXPECT_EQ(full.constraints_.size(), 1);
+  EXPECT_EQ(full.options_.active_cell_thresholds_.size(), 1);
+}
+
+TEST(Model, FrozenAerosolPropertiesDropPropertyPartials)
+{
+  using DenseMatrixPolicy = micm::Matrix<double>;
+  using SparseMatrixPolicy = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+  constexpr std::size_t number_of_cells = 3;
+  Model live = MakePhaseTransferModel();
+  Model frozen = live;
+  frozen.options_.frozen_aerosol_properties_ = true;
+
+  EXPECT_TRUE(live.FrozenPropertyParameterNames().empty());
+  auto frozen_names = frozen.FrozenPropertyParameterNames();
+  EXPECT_EQ(frozen_names.size(), 9);  // 3 properties of MODE1, CLOUD.BIN_0 and CLOUD.BIN_1
+  EXPECT_TRUE(frozen_names.contains("MODE1.EFFECTIVE_RADIUS"));
+  EXPECT_TRUE(frozen_names.contains("CLOUD.BIN_1.PHASE_VOLUME_FRACTION"));
+  // They are listed with the process parameters, so micm gives them state parameter columns
+  auto parameter_names = live.StateParameterNames();
+  parameter_names.insert(frozen_names.begin(), frozen_names.end());
+  EXPECT_EQ(frozen.StateParameterNames(), parameter_names);
+  EXPECT_EQ(std::get<1>(frozen.StateSize()), std::get<1>(live.StateSize()) + frozen_names.size());
+  EXPECT_TRUE(frozen.InitializeConstraintParameterNames().empty());
+
+  std::unordered_map<std::string, std::size_t> variable_indices{ { "A_g", 0 } };
+  for (const auto& name : frozen.StateVariableNames())
+    variable_indices[name] = variable_indices.size();
+  std::unordered_map<std::string, std::size_t> parameter_indices;
+  for (const auto& name : frozen.StateParameterNames())
+    parameter_indices[name] = parameter_indices.size();
+  DenseMatrixPolicy parameters(number_of_cells, parameter_indices.size(), 0.0);
+  DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 0.0);
+  FillState(parameters, variables);
+  std::vector<micm::Conditions> conditions(number_of_cells);
+  for (auto& condition : conditions)
+    condition.temperature_ = 285.0;
+
+  // The update is a no-op unless the properties are frozen
+  auto unchanged = parameters;
+  live.UpdateFrozenPropertiesFunction<DenseMatrixPolicy>(parameter_indices, variable_indices)(variables, parameters);
+  EXPECT_EQ(parameters.AsVector(), unchanged.AsVector());
+
+  // The properties are computed by the function micm calls at the start of each Solve, and
+  // left alone by the parameter update
+  frozen.UpdateStateParametersFunction<DenseMatrixPolicy>(parameter_indices)(conditions, parameters);
+  frozen.InitializeConstraintParametersFunction<DenseMatrixPolicy>(parameter_indices, variable_indices)(
+      variables, parameters);
+  EXPECT_GT(parameters[0][parameter_indices.at("MODE1.EFFECTIVE_RADIUS")], 0.0);
+  auto initialized = parameters;
+  frozen.UpdateStateParametersFunction<DenseMatrixPolicy>(parameter_indices)(conditions, parameters);
+  EXPECT_EQ(
+      parameters[0][parameter_indices.at("MODE1.EFFECTIVE_RADIUS")],
+      initialized[0][parameter_indices.at("MODE1.EFFECTIVE_RADIUS")]);
+
+  // With properties frozen at the current state, the forcing is unchanged
+  DenseMatrixPolicy live_forcing(number_of_cells, variable_indices.size(), 0.0);
+  DenseMatrixPolicy frozen_forcing(number_of_cells, variable_indices.size(), 0.0);
+  live.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices)(parameters, variables, live_forcing);
+  auto frozen_forcing_fn = frozen.ForcingFunction<DenseMatrixPolicy>(parameter_indices, variable_indices);
+  frozen_forcing_fn(parameters, variables, frozen_forcing);
+  EXPECT_EQ(frozen_forcing.AsVector(), live_forcing.AsVector());
+
+  // Only the direct gas, solute and solvent elements remain in the sparsity pattern
+  auto live_elements = live.NonZeroJacobianElements(variable_indices);
+  auto frozen_elements = frozen.NonZeroJacobianElements(variable_indices);
+  EXPECT_LT(frozen_elements.size(), live_elements.size());
+  EXPECT_TRUE(std::includes(live_elements.begin(), live_elements.end(), frozen_elements.begin(), frozen_elements.end()));
+
+  // The Jacobian is exact for the frozen-property forcing (-J, compared by central differences)
+  auto builder = SparseMatrixPolicy::Create(variable_indices.size()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+  for (const auto& element : frozen_elements)
+    builder = builder.WithElement(element.first, element.second);
+  SparseMatrixPolicy jacobian(builder);
+  frozen.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(parameter_indices, variable_indices, jacobian)(
+      parameters, variables, jacobian);
+  for (std::size_t j = 0; j < variable_indices.size(); ++j)
+  {
+    auto plus = variables;
+    auto minus = variables;
+    DenseMatrixPolicy forcing_plus(number_of_cells, variable_indices.size(), 0.0);
+    DenseMatrixPolicy forcing_minus(number_of_cells, variable_indices.size(), 0.0);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    {
+      plus[cell][j] *= 1.0 + 1.0e-6;
+      minus[cell][j] *= 1.0 - 1.0e-6;
+    }
+    frozen_forcing_fn(parameters, plus, forcing_plus);
+    frozen_forcing_fn(parameters, minus, forcing_minus);
+    for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    {
+      for (std::size_t i = 0; i < variable_indices.size(); ++i)
+      {
+        double derivative = (forcing_plus[cell][i] - forcing_minus[cell][i]) / (plus[cell][j] - minus[cell][j]);
+        double expected = frozen_elements.contains({ i, j }) ? -jacobian[cell][i][j] : 0.0;
+        EXPECT_NEAR(derivative, expected, 1.0e-6 * std::abs(expected) + 1.0e-12) << cell << " " << i << " " << j;
+      }
+    }
+  }
+}
+
+TEST(Model, LinearConstraintJacobianIsAssembledOnce)
+{
+  using DenseMatrixPolicy = micm::Matrix<double>;
+  using SparseMatrixPolicy = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+  constexpr std::size_t number_of_cells = 3;
+  auto h2o = micm::Species{ "H2O" };
+  auto a_g = micm::Species{ "A_g" };
+  auto a = micm::Species{ "A" };
+  auto hp = micm::Species{ "H+" };
+  auto am = micm::Species{ "A-" };
+  auto gas_phase = micm::Phase{ "GAS", { { a_g } } };
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a }, { hp }, { am } } };
+
+  Model model;
+  model.representations_.push_back(SingleMomentMode{ "MODE1", { aqueous_phase } });
+  model.representations_.push_back(SingleMomentMode{ "MODE2", { aqueous_phase } });
+  // Mass conservation over the gas and both modes, and a charge balance per mode
+  model.AddConstraints(
+      LinearConstraintBuilder()
+          .SetAlgebraicSpecies(gas_phase, a_g)
+          .AddTerm(gas_phase, a_g, 1.0)
+          .AddTerm(aqueous_phase, a, 1.0)
+          .AddTerm(aqueous_phase, am, 1.0)
+          .SetConstant(1.0)
+          .Build(),
+      LinearConstraintBuilder()
+          .SetAlgebraicSpecies(aqueous_phase, hp)
+          .AddTerm(aqueous_phase, hp, 1.0)
+          .AddTerm(aqueous_phase, am, -1.0)
+          .SetConstant(0.0)
+          .Build());
+
+  std::unordered_map<std::string, std::size_t> variable_indices{ { "A_g", 0 } };
+  for (const auto& name : model.StateVariableNames())
+    variable_indices[name] = variable_indices.size();
+  std::unordered_map<std::string, std::size_t> parameter_indices;
+  auto builder = SparseMatrixPolicy::Create(variable_indices.size()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+  for (const auto& [row, col] : model.NonZeroConstraintJacobianElements(variable_indices))
+    builder = builder.WithElement(row, col);
+  SparseMatrixPolicy combined(builder);
+  SparseMatrixPolicy separate(builder);
+  DenseMatrixPolicy parameters(number_of_cells, 1, 0.0);
+  DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 1.0);
+
+  model.ConstraintJacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+      parameter_indices, variable_indices, combined)(variables, parameters, combined);
+  std::map<std::string, std::set<std::string>> phase_prefixes{ { "AQUEOUS", { "MODE1", "MODE2" } } };
+  for (const auto& constraint : model.constraints_)
+    std::visit(
+        [&](const auto& c)
+        {
+          c.template ConstraintJacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+              phase_prefixes, parameter_indices, variable_indices, separate)(variables, parameters, separate);
+        },
+        constraint);
+  EXPECT_EQ(combined.AsVector(), separate.AsVector());
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+  {
+    EXPECT_DOUBLE_EQ(combined[cell][0][variable_indices.at("MODE2.AQUEOUS.A")], -1.0);
+    const auto hp_row = variable_indices.at("MODE1.AQUEOUS.H+");
+    EXPECT_DOUBLE_EQ(combined[cell][hp_row][variable_indices.at("MODE1.AQUEOUS.A-")], 1.0);
+  }
+}
+
+TEST(Model, LinearConstraintResidualMatchesPerConstraintResidual)
+{
+  using DenseMatrixPolicy = micm::Matrix<double>;
+  constexpr std::size_t number_of_cells = 3;
+  auto h2o = micm::Species{ "H2O" };
+  auto a_g = micm::Species{ "A_g" };
+  auto a = micm::Species{ "A" };
+  auto hp = micm::Species{ "H+" };
+  auto am = micm::Species{ "A-" };
+  auto gas_phase = micm::Phase{ "GAS", { { a_g } } };
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a }, { hp }, { am } } };
+
+  Model model;
+  model.representations_.push_back(SingleMomentMode{ "MODE1", { aqueous_phase } });
+  model.representations_.push_back(SingleMomentMode{ "MODE2", { aqueous_phase } });
+  // A diagnosed mass conservation over the gas and both modes, and a fixed charge balance per mode
+  model.AddConstraints(
+      LinearConstraintBuilder()
+          .SetAlgebraicSpecies(gas_phase, a_g)
+          .AddTerm(gas_phase, a_g, 1.0)
+          .AddTerm(aqueous_phase, a, 1.0)
+          .AddTerm(aqueous_phase, am, 1.0)
+          .DiagnoseConstantFromState()
+          .Build(),
+      LinearConstraintBuilder()
+          .SetAlgebraicSpecies(aqueous_phase, hp)
+          .AddTerm(aqueous_phase, hp, 1.0)
+          .AddTerm(aqueous_phase, am, -1.0)
+          .SetConstant(0.5)
+          .Build());
+
+  std::unordered_map<std::string, std::size_t> variable_indices{ { "A_g", 0 } };
+  for (const auto& name : model.StateVariableNames())
+    variable_indices[name] = variable_indices.size();
+  std::unordered_map<std::string, std::size_t> parameter_indices;
+  for (const auto& name : model.InitializeConstraintParameterNames())
+    parameter_indices[name] = parameter_indices.size();
+  ASSERT_EQ(parameter_indices.size(), 1);
+  DenseMatrixPolicy parameters(number_of_cells, parameter_indices.size(), 0.0);
+  DenseMatrixPolicy variables(number_of_cells, variable_indices.size(), 0.0);
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+    for (std::size_t i = 0; i < variable_indices.size(); ++i)
+      variables[cell][i] = 1.0 + 0.5 * static_cast<double>(i) + 0.25 * static_cast<double>(cell);
+
+  // The diagnosed constant is shared with the residual, which is zero for the diagnosed row
+  model.InitializeConstraintParametersFunction<DenseMatrixPolicy>(parameter_indices, variable_indices)(
+      variables, parameters);
+  DenseMatrixPolicy combined(number_of_cells, variable_indices.size(), 0.0);
+  model.ConstraintResidualFunction<DenseMatrixPolicy>(parameter_indices, variable_indices)(
+      variables, parameters, combined);
+
+  DenseMatrixPolicy separate(number_of_cells, variable_indices.size(), 0.0);
+  std::map<std::string, std::set<std::string>> phase_prefixes{ { "AQUEOUS", { "MODE1", "MODE2" } } };
+  for (const auto& constraint : model.constraints_)
+    std::visit(
+        [&](const auto& c)
+        {
+          c.template ConstraintResidualFunction<DenseMatrixPolicy>(phase_prefixes, parameter_indices, variable_indices)(
+              variables, parameters, separate);
+        },
+        constraint);
+  for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+  {
+    for (std::size_t i = 0; i < variable_indices.size(); ++i)
+      EXPECT_DOUBLE_EQ(combined[cell][i], separate[cell][i]) << cell << " " << i;
+    EXPECT_NEAR(combined[cell][0], 0.0, 1.0e-12);
+    const auto hp_row = variable_indices.at("MODE2.AQUEOUS.H+");
+    EXPECT_NEAR(
+        combined[cell][hp_row],
+        variables[cell][hp_row] - variables[cell][variable_indices.at("MODE2.AQUEOUS.A-")] - 0.5,
+        1.0e-12);
+  }
+}
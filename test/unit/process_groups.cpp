@@ -0,0 +1,199 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/model/process_groups.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  using Groups = std::vector<std::vector<std::size_t>>;
+
+  /// Returns a forcing function that adds 0.1 * (process + 1) * variable[column] to each written column
+  template<typename DenseMatrixPolicy>
+  typename ProcessGroupEvaluator<DenseMatrixPolicy>::Function
+  MakeProcess(std::size_t process, std::vector<std::size_t> columns)
+  {
+    return [process, columns](const DenseMatrixPolicy&, const DenseMatrixPolicy& variables, DenseMatrixPolicy& forcing)
+    {
+      for (std::size_t i = 0; i < variables.NumRows(); ++i)
+        for (const auto column : columns)
+          forcing[i][column] += (process + 1) * 0.1 * variables[i][column];
+    };
+  }
+
+  /// Compares a ProcessGroupEvaluator against running the processes in order
+  template<typename DenseMatrixPolicy>
+  void CompareGroupEvaluation(std::size_t number_of_threads)
+  {
+    constexpr std::size_t number_of_cells = 5;
+    constexpr std::size_t number_of_columns = 6;
+    // Column 0 is shared (a gas-phase species); processes 0 and 3 both own column 2
+    const std::vector<std::vector<std::size_t>> written_columns{ { 0, 1, 2 }, { 0, 3 }, { 4 }, { 2, 5 } };
+    const std::vector<bool> is_shared_column{ true, false, false, false, false, false };
+
+    std::vector<typename ProcessGroupEvaluator<DenseMatrixPolicy>::Function> functions;
+    for (std::size_t i = 0; i < written_columns.size(); ++i)
+      functions.push_back(MakeProcess<DenseMatrixPolicy>(i, written_columns[i]));
+
+    DenseMatrixPolicy parameters(number_of_cells, 1, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, number_of_columns, 0.0);
+    DenseMatrixPolicy serial(number_of_cells, number_of_columns, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < number_of_columns; ++j)
+      {
+        variables[i][j] = 1.0 + 0.3 * i + 0.7 * j;
+        serial[i][j] = 0.01 * (i + j);
+      }
+    DenseMatrixPolicy parallel = serial;
+
+    ProcessGroupEvaluator<DenseMatrixPolicy> evaluator(
+        std::make_shared<ThreadPool>(number_of_threads), functions, written_columns, is_shared_column, number_of_columns);
+    EXPECT_EQ(evaluator.Groups(), (Groups{ { 0, 1, 2 }, { 3 } }));
+
+    for (int call = 0; call < 2; ++call)
+    {
+      for (const auto& fn : functions)
+        fn(parameters, variables, serial);
+      evaluator(parameters, variables, parallel);
+    }
+    // Each process adds one term per column, and the shared column receives them in process order
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < number_of_columns; ++j)
+        EXPECT_EQ(parallel[i][j], serial[i][j]) << "cell " << i << " column " << j;
+  }
+
+  /// Runs many processes writing one shared column and returns the forcing
+  template<typename DenseMatrixPolicy>
+  DenseMatrixPolicy SharedColumnForcing(std::size_t number_of_threads)
+  {
+    constexpr std::size_t number_of_cells = 9;
+    constexpr std::size_t number_of_processes = 11;
+    std::vector<std::vector<std::size_t>> written_columns;
+    std::vector<typename ProcessGroupEvaluator<DenseMatrixPolicy>::Function> functions;
+    for (std::size_t i = 0; i < number_of_processes; ++i)
+    {
+      written_columns.push_back({ 0, i + 1 });
+      functions.push_back(MakeProcess<DenseMatrixPolicy>(i, written_columns.back()));
+    }
+    std::vector<bool> is_shared_column(number_of_processes + 1, false);
+    is_shared_column[0] = true;
+
+    DenseMatrixPolicy parameters(number_of_cells, 1, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, number_of_processes + 1, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, number_of_processes + 1, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j <= number_of_processes; ++j)
+        variables[i][j] = 1.0 / (1.0 + 0.3 * i + 0.7 * j);
+
+    ProcessGroupEvaluator<DenseMatrixPolicy> evaluator(
+        std::make_shared<ThreadPool>(number_of_threads),
+        functions,
+        written_columns,
+        is_shared_column,
+        number_of_processes + 1);
+    EXPECT_EQ(evaluator.Groups().size(), 1);
+    for (int call = 0; call < 3; ++call)
+      evaluator(parameters, variables, forcing);
+    return forcing;
+  }
+}  // namespace
+
+TEST(ProcessGroups, IndependentProcessesShareOneGroup)
+{
+  EXPECT_EQ(ColorProcessConflicts({ { 0, 1 }, { 2 }, { 3, 4 } }), (Groups{ { 0, 1, 2 } }));
+}
+
+TEST(ProcessGroups, ConflictingProcessesAreSeparated)
+{
+  EXPECT_EQ(ColorProcessConflicts({ { 0, 1 }, { 1, 2 }, { 2, 3 } }), (Groups{ { 0 }, { 1 }, { 2 } }));
+}
+
+TEST(ProcessGroups, GroupsKeepProcessOrderPerColumn)
+{
+  // Process 2 conflicts only with process 1, and must run after it even though group 0 has no conflict
+  auto groups = ColorProcessConflicts({ { 0 }, { 0, 1 }, { 1 }, { 2 } });
+  EXPECT_EQ(groups, (Groups{ { 0, 3 }, { 1 }, { 2 } }));
+}
+
+TEST(ProcessGroups, ProcessesWithoutColumnsRunFirst)
+{
+  EXPECT_EQ(ColorProcessConflicts({ { 0 }, {}, { 0 } }), (Groups{ { 0, 1 }, { 2 } }));
+  EXPECT_TRUE(ColorProcessConflicts({}).empty());
+}
+
+TEST(ProcessGroups, EvaluatorMatchesSerialEvaluation)
+{
+  for (std::size_t threads : { 1, 2, 4 })
+    CompareGroupEvaluation<micm::Matrix<double>>(threads);
+}
+
+TEST(ProcessGroups, EvaluatorMatchesSerialEvaluationVectorMatrix)
+{
+  for (std::size_t threads : { 1, 2, 4 })
+    CompareGroupEvaluation<micm::VectorMatrix<double, 4>>(threads);
+}
+
+TEST(ProcessGroups, SharedColumnsDoNotDependOnThreadCount)
+{
+  using DenseMatrixPolicy = micm::VectorMatrix<double, 4>;
+  auto first = SharedColumnForcing<DenseMatrixPolicy>(1);
+  for (std::size_t threads : { 1, 2, 3, 4, 7 })
+    for (int run = 0; run < 3; ++run)
+      EXPECT_EQ(SharedColumnForcing<DenseMatrixPolicy>(threads).AsVector(), first.AsVector()) << threads << " threads";
+}
+
+TEST(ProcessGroups, ConcurrentCallsDoNotShareCallState)
+{
+  using DenseMatrixPolicy = micm::Matrix<double>;
+  constexpr std::size_t number_of_columns = 4;
+  const std::vector<std::vector<std::size_t>> written_columns{ { 0, 1 }, { 0, 2 }, { 0, 3 } };
+  const std::vector<bool> is_shared_column{ true, false, false, false };
+  std::vector<typename ProcessGroupEvaluator<DenseMatrixPolicy>::Function> functions;
+  for (std::size_t i = 0; i < written_columns.size(); ++i)
+    functions.push_back(MakeProcess<DenseMatrixPolicy>(i, written_columns[i]));
+  ProcessGroupEvaluator<DenseMatrixPolicy> evaluator(
+      std::make_shared<ThreadPool>(3), functions, written_columns, is_shared_column, number_of_columns);
+
+  // Two callers with different inputs and grid sizes use the evaluator at the same time
+  auto run = [&](std::size_t number_of_cells, double scale)
+  {
+    DenseMatrixPolicy parameters(number_of_cells, 1, 0.0);
+    DenseMatrixPolicy variables(number_of_cells, number_of_columns, 0.0);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < number_of_columns; ++j)
+        variables[i][j] = scale * (1.0 + 0.3 * i + 0.7 * j);
+    DenseMatrixPolicy expected(number_of_cells, number_of_columns, 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, number_of_columns, 0.0);
+    for (int call = 0; call < 200; ++call)
+    {
+      for (const auto& fn : functions)
+        fn(parameters, variables, expected);
+      evaluator(parameters, variables, forcing);
+    }
+    // Largest relative difference from the serial evaluation
+    double difference = 0.0;
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+      for (std::size_t j = 0; j < number_of_columns; ++j)
+        difference = std::max(difference, std::abs(forcing[i][j] - expected[i][j]) / std::abs(expected[i][j]));
+    return difference;
+  };
+  double difference_b = 0.0;
+  std::thread other([&] { difference_b = run(7, 2.0); });
+  double difference_a = run(3, 1.0);
+  other.join();
+  EXPECT_LT(difference_a, 1.0e-12);
+  EXPECT_LT(difference_b, 1.0e-12);
+}
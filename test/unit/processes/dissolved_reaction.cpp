@@ -728,6 +728,116 @@ TEST(DissolvedReaction, ForcingFunctionMultiplePhaseInstances)
   EXPECT_EQ(forcing_terms[0][5], 0.0);
 }
 
+TEST(DissolvedReaction, SharedRateConstantUsesOneParameter)
+{
+  using MatrixPolicy = micm::VectorMatrix<double>;
+
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto solvent = micm::Species{ "S" };
+
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { solvent } } };
+
+  RateConstant shared_rate{ [](const micm::Conditions& conditions) { return 1.0e-3 * conditions.temperature_; } };
+  DissolvedReaction reaction{
+    { { "BIN_1", shared_rate }, { "BIN_2", shared_rate }, { "BIN_3", 0.2 }, { "BIN_4", 0.2 } }, { a }, { b }, solvent, phase
+  };
+
+  std::map<std::string, std::set<std::string>> phase_prefixes;
+  phase_prefixes["AQUEOUS"] = { "BIN_1", "BIN_2", "BIN_3", "BIN_4" };
+
+  // One parameter per distinct rate constant, named after the first prefix that uses it
+  std::string k_shared = "BIN_1." + phase.name_ + "." + reaction.uuid_ + ".k";
+  std::string k_constant = "BIN_3." + phase.name_ + "." + reaction.uuid_ + ".k";
+  auto names = reaction.ProcessParameterNames(phase_prefixes);
+  EXPECT_EQ(names, (std::set<std::string>{ k_shared, k_constant }));
+
+  std::unordered_map<std::string, std::size_t> state_parameter_indices;
+  state_parameter_indices[k_shared] = 0;
+  state_parameter_indices[k_constant] = 1;
+
+  std::unordered_map<std::string, std::size_t> state_variable_indices;
+  for (std::size_t i_bin = 0; i_bin < 4; ++i_bin)
+  {
+    std::string prefix = "BIN_" + std::to_string(i_bin + 1) + ".AQUEOUS.";
+    state_variable_indices[prefix + "A"] = 3 * i_bin;
+    state_variable_indices[prefix + "B"] = 3 * i_bin + 1;
+    state_variable_indices[prefix + "S"] = 3 * i_bin + 2;
+  }
+
+  auto update_func = reaction.UpdateStateParametersFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices);
+  auto forcing_func =
+      reaction.ForcingFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices);
+
+  std::vector<micm::Conditions> conditions(2);
+  conditions[0].temperature_ = 280.0;
+  conditions[1].temperature_ = 300.0;
+
+  MatrixPolicy state_parameters(2, 2, 0.0);
+  update_func(conditions, state_parameters);
+
+  MatrixPolicy state_variables(2, 12, 0.0);
+  for (std::size_t i_cell = 0; i_cell < 2; ++i_cell)
+  {
+    EXPECT_DOUBLE_EQ(state_parameters[i_cell][0], 1.0e-3 * conditions[i_cell].temperature_);
+    EXPECT_DOUBLE_EQ(state_parameters[i_cell][1], 0.2);
+    for (std::size_t i_bin = 0; i_bin < 4; ++i_bin)
+    {
+      state_variables[i_cell][3 * i_bin] = 1.0 + static_cast<double>(i_bin);
+      state_variables[i_cell][3 * i_bin + 2] = 50.0;
+    }
+  }
+
+  MatrixPolicy forcing_terms(2, 12, 0.0);
+  forcing_func(state_parameters, state_variables, forcing_terms);
+
+  for (std::size_t i_cell = 0; i_cell < 2; ++i_cell)
+  {
+    for (std::size_t i_bin = 0; i_bin < 4; ++i_bin)
+    {
+      double k = i_bin < 2 ? 1.0e-3 * conditions[i_cell].temperature_ : 0.2;
+      double rate = k * (1.0 + static_cast<double>(i_bin));
+      EXPECT_NEAR(forcing_terms[i_cell][3 * i_bin], -rate, 1e-10);
+      EXPECT_NEAR(forcing_terms[i_cell][3 * i_bin + 1], rate, 1e-10);
+    }
+  }
+}
+
+TEST(DissolvedReaction, BuilderSharesRateConstantAcrossPrefixes)
+{
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto s = micm::Species{ "S" };
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { s } } };
+
+  auto rate = [](const micm::Conditions& conditions) { return 1.0e-3 * conditions.temperature_; };
+  std::set<std::string> bins;
+  for (std::size_t i_bin = 0; i_bin < 20; ++i_bin)
+    bins.insert("BIN_" + std::to_string(i_bin));
+  std::map<std::string, std::set<std::string>> phase_prefixes{ { "AQUEOUS", bins } };
+
+  // Registering the lambda prefix by prefix gives one parameter per prefix
+  DissolvedReactionBuilder per_prefix;
+  per_prefix.SetPhase(phase).SetReactants({ a }).SetProducts({ b }).SetSolvent(s);
+  for (const auto& bin : bins)
+    per_prefix.AddRateConstant(bin, rate);
+  EXPECT_EQ(per_prefix.Build().ProcessParameterNames(phase_prefixes).size(), bins.size());
+
+  // Registering it once for all prefixes shares one parameter
+  auto shared = DissolvedReactionBuilder{}
+                    .SetPhase(phase)
+                    .SetReactants({ a })
+                    .SetProducts({ b })
+                    .SetSolvent(s)
+                    .AddRateConstant(bins, rate)
+                    .Build();
+  EXPECT_EQ(shared.rate_constants_.size(), bins.size());
+  EXPECT_EQ(shared.ProcessParameterNames(phase_prefixes).size(), 1u);
+  micm::Conditions conditions{};
+  conditions.temperature_ = 290.0;
+  EXPECT_DOUBLE_EQ(shared.rate_constants_.at("BIN_7")(conditions), 0.29);
+}
+
 // ============================================================================
 // JacobianFunction Tests
 // ============================================================================
@@ -5,6 +5,7 @@
 #include <miam/processes/constants/henry_law_constant.hpp>
 #include <miam/processes/henry_law_phase_transfer.hpp>
 #include <miam/processes/henry_law_phase_transfer_builder.hpp>
+#include <miam/representations/two_moment_mode.hpp>
 
 #include <micm/system/conditions.hpp>
 #include <micm/system/phase.hpp>
@@ -15,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
+#include <numbers>
 
 using namespace miam;
 using MatrixPolicy = micm::Matrix<double>;
@@ -84,22 +87,31 @@ namespace
   {
     AerosolPropertyProvider<DenseMatrixPolicy> provider;
     provider.dependent_variable_indices = dependent_variable_indices;
-    provider.ComputeValue =
-        [value](const DenseMatrixPolicy& params, const DenseMatrixPolicy& vars, DenseMatrixPolicy& result)
+    provider.BuildFunctions = [value, n_partials = dependent_variable_indices.size()](
+                                  AerosolPropertyProvider<DenseMatrixPolicy>& built, const PropertyColumns& columns)
     {
-      for (std::size_t row = 0; row < result.NumRows(); ++row)
-        result[row][0] = value;
-    };
-    provider.ComputeValueAndDerivatives = [value](
-                                              const DenseMatrixPolicy& params,
-                                              const DenseMatrixPolicy& vars,
-                                              DenseMatrixPolicy& result,
-                                              DenseMatrixPolicy& partials)
-    {
-      for (std::size_t row = 0; row < result.NumRows(); ++row)
-        result[row][0] = value;
-      // partials remain 0 for constant providers
+      built.ComputeValue =
+          [value, columns](const DenseMatrixPolicy& params, const DenseMatrixPolicy& vars, DenseMatrixPolicy& result)
+      {
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+          result[row][columns.value_] = value;
+      };
+      built.ComputeValueAndDerivatives = [value, n_partials, columns](
+                                             const DenseMatrixPolicy& params,
+                                             const DenseMatrixPolicy& vars,
+                                             DenseMatrixPolicy& result,
+                                             DenseMatrixPolicy& partials)
+      {
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+        {
+          result[row][columns.value_] = value;
+          // partials are 0 for constant providers
+          for (std::size_t k = 0; k < n_partials; ++k)
+            partials[row][columns.partials_ + k] = 0.0;
+        }
+      };
     };
+    provider.WriteTo({});
     return provider;
   }
 
@@ -119,6 +131,48 @@ namespace
     providers[prefix][AerosolProperty::PhaseVolumeFraction] = MakeConstantProvider<MatrixPolicy>(phi, phi_deps);
     return providers;
   }
+
+  /// Appends the state parameters of every phase instance of a process to the state parameter indices
+  void AddProcessParameterIndices(
+      const HenryLawPhaseTransfer& process,
+      const std::map<std::string, std::set<std::string>>& phase_prefixes,
+      std::unordered_map<std::string, std::size_t>& state_parameter_indices)
+  {
+    for (const auto& name : process.ProcessParameterNames(phase_prefixes))
+      state_parameter_indices[name] = state_parameter_indices.size();
+  }
+
+  /// Fills the state parameters of a process with its UpdateStateParametersFunction at the given
+  /// temperature of each grid cell
+  void UpdateStateParameters(
+      const HenryLawPhaseTransfer& process,
+      const std::map<std::string, std::set<std::string>>& phase_prefixes,
+      const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+      const std::vector<double>& temperatures,
+      MatrixPolicy& state_parameters)
+  {
+    std::vector<micm::Conditions> conditions(temperatures.size());
+    for (std::size_t i = 0; i < temperatures.size(); ++i)
+      conditions[i].temperature_ = temperatures[i];
+    process.UpdateStateParametersFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices)(
+        conditions, state_parameters);
+  }
+
+  /// Fills the state parameters of a process at the same temperature in every grid cell
+  void UpdateStateParameters(
+      const HenryLawPhaseTransfer& process,
+      const std::map<std::string, std::set<std::string>>& phase_prefixes,
+      const std::unordered_map<std::string, std::size_t>& state_parameter_indices,
+      double temperature,
+      MatrixPolicy& state_parameters)
+  {
+    UpdateStateParameters(
+        process,
+        phase_prefixes,
+        state_parameter_indices,
+        std::vector<double>(state_parameters.NumRows(), temperature),
+        state_parameters);
+  }
 }  // namespace
 
 // ======================== ProcessParameterNames ========================
@@ -132,8 +186,8 @@ TEST(HenryLawPhaseTransfer, ProcessParameterNamesSinglePrefix)
 
   auto names = process.ProcessParameterNames(phase_prefixes);
   EXPECT_EQ(names.size(), 2);
-  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".hlc"));
-  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".temperature"));
+  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".mean_free_path"));
+  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".hlc_rt"));
 }
 
 TEST(HenryLawPhaseTransfer, ProcessParameterNamesMultiplePrefixes)
@@ -146,10 +200,10 @@ TEST(HenryLawPhaseTransfer, ProcessParameterNamesMultiplePrefixes)
 
   auto names = process.ProcessParameterNames(phase_prefixes);
   EXPECT_EQ(names.size(), 4);
-  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".hlc"));
-  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".temperature"));
-  EXPECT_TRUE(names.count("MODE2.AQUEOUS." + process.uuid_ + ".hlc"));
-  EXPECT_TRUE(names.count("MODE2.AQUEOUS." + process.uuid_ + ".temperature"));
+  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".mean_free_path"));
+  EXPECT_TRUE(names.count("MODE1.AQUEOUS." + process.uuid_ + ".hlc_rt"));
+  EXPECT_TRUE(names.count("MODE2.AQUEOUS." + process.uuid_ + ".mean_free_path"));
+  EXPECT_TRUE(names.count("MODE2.AQUEOUS." + process.uuid_ + ".hlc_rt"));
 }
 
 TEST(HenryLawPhaseTransfer, ProcessParameterNamesNoMatchingPhase)
@@ -293,24 +347,28 @@ TEST(HenryLawPhaseTransfer, UpdateStateParametersFunction)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".mean_free_path"] = 0;
+  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc_rt"] = 1;
 
   auto update_func = process.UpdateStateParametersFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices);
 
-  MatrixPolicy state_parameters(1, 2, 0.0);
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   std::vector<micm::Conditions> conditions(1);
   conditions[0].temperature_ = 298.15;
 
   update_func(conditions, state_parameters);
 
-  EXPECT_NEAR(state_parameters[0][0], HLC_ref, 1e-10);
-  EXPECT_NEAR(state_parameters[0][1], 298.15, 1e-10);
+  // λ = 3·D_g / c̄ and HLC·R·T
+  const double mean_speed =
+      std::sqrt(8.0 * micm::constants::GAS_CONSTANT * 298.15 / (std::numbers::pi * gas_molecular_weight));
+  const double mean_free_path = 3.0 * D_g / mean_speed;
+  EXPECT_NEAR(state_parameters[0][0], mean_free_path, mean_free_path * 1e-12);
+  EXPECT_NEAR(
+      state_parameters[0][1],
+      HLC_ref * micm::constants::GAS_CONSTANT * 298.15,
+      HLC_ref * micm::constants::GAS_CONSTANT * 298.15 * 1e-12);
 }
 
 TEST(HenryLawPhaseTransfer, UpdateStateParametersFunctionMultipleCells)
@@ -320,16 +378,13 @@ TEST(HenryLawPhaseTransfer, UpdateStateParametersFunctionMultipleCells)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".mean_free_path"] = 0;
+  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc_rt"] = 1;
 
   auto update_func = process.UpdateStateParametersFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices);
 
-  MatrixPolicy state_parameters(3, 2, 0.0);
+  MatrixPolicy state_parameters(3, state_parameter_indices.size(), 0.0);
 
   std::vector<micm::Conditions> conditions(3);
   conditions[0].temperature_ = 280.0;
@@ -338,10 +393,15 @@ TEST(HenryLawPhaseTransfer, UpdateStateParametersFunctionMultipleCells)
 
   update_func(conditions, state_parameters);
 
-  EXPECT_NEAR(state_parameters[0][0], HLC_ref, 1e-10);
-  EXPECT_NEAR(state_parameters[0][1], 280.0, 1e-10);
-  EXPECT_NEAR(state_parameters[1][1], 298.15, 1e-10);
-  EXPECT_NEAR(state_parameters[2][1], 310.0, 1e-10);
+  // The parameters follow each cell's temperature and match the kernel's own evaluation
+  const auto kernel = MakeFuchsSutuginKernel(D_g, alpha, gas_molecular_weight);
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const double T = conditions[i].temperature_;
+    EXPECT_DOUBLE_EQ(state_parameters[i][0], kernel.MeanFreePath(T));
+    EXPECT_DOUBLE_EQ(state_parameters[i][1], HLC_ref * micm::constants::GAS_CONSTANT * T);
+  }
+  EXPECT_GT(state_parameters[0][0], state_parameters[2][0]);  // faster molecules at higher T
 }
 
 // ======================== CopyWithNewUuid ========================
@@ -367,12 +427,8 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionBasicRates)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -394,9 +450,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionBasicRates)
   double aq_conc = 1.0e-5;        // mol m^-3
   double solvent_conc = 55000.0;  // mol m^-3
 
-  MatrixPolicy state_parameters(1, 2);
-  state_parameters[0][0] = hlc;
-  state_parameters[0][1] = T;
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy state_variables(1, 3);
   state_variables[0][0] = gas_conc;
@@ -405,6 +459,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionBasicRates)
 
   MatrixPolicy forcing_terms(1, 3, 0.0);
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, state_parameters);
   forcing_func(state_parameters, state_variables, forcing_terms);
 
   // Compute expected net rate
@@ -427,12 +482,8 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMultipleCells)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -449,7 +500,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMultipleCells)
       process.ForcingFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices, providers);
 
   std::size_t num_cells = 3;
-  MatrixPolicy state_parameters(num_cells, 2);
+  MatrixPolicy state_parameters(num_cells, state_parameter_indices.size(), 0.0);
   MatrixPolicy state_variables(num_cells, 3);
   MatrixPolicy forcing_terms(num_cells, 3, 0.0);
 
@@ -459,13 +510,12 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMultipleCells)
 
   for (std::size_t i = 0; i < num_cells; ++i)
   {
-    state_parameters[i][0] = hlc;
-    state_parameters[i][1] = T;
     state_variables[i][0] = 1.0e-3 * (i + 1);  // varying gas concentration
     state_variables[i][1] = 1.0e-5;
     state_variables[i][2] = solvent;
   }
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, state_parameters);
   forcing_func(state_parameters, state_variables, forcing_terms);
 
   auto cond_rate_provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -491,12 +541,8 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMassConservation)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -508,9 +554,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMassConservation)
   auto forcing_func =
       process.ForcingFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices, providers);
 
-  MatrixPolicy state_parameters(1, 2);
-  state_parameters[0][0] = HLC_ref;
-  state_parameters[0][1] = 298.15;
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy state_variables(1, 3);
   state_variables[0][0] = 0.5;    // substantial gas
@@ -518,6 +562,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionMassConservation)
   state_variables[0][2] = 55000.0;
 
   MatrixPolicy forcing_terms(1, 3, 0.0);
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, 298.15, state_parameters);
   forcing_func(state_parameters, state_variables, forcing_terms);
 
   // Mass conservation: gas forcing + aq forcing = 0
@@ -533,12 +578,8 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionDirectEntries)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -568,15 +609,14 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionDirectEntries)
   double aq_conc = 1.0e-5;
   double solvent_conc = 55000.0;
 
-  MatrixPolicy state_parameters(1, 2);
-  state_parameters[0][0] = hlc;
-  state_parameters[0][1] = T;
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy state_variables(1, 3);
   state_variables[0][0] = gas_conc;
   state_variables[0][1] = aq_conc;
   state_variables[0][2] = solvent_conc;
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, state_parameters);
   jac_func(state_parameters, state_variables, jacobian);
 
   auto cond_rate_provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -607,12 +647,8 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionSymmetry)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -631,15 +667,14 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionSymmetry)
   auto jac_func = process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(
       phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
 
-  MatrixPolicy state_parameters(1, 2);
-  state_parameters[0][0] = HLC_ref;
-  state_parameters[0][1] = 298.15;
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy state_variables(1, 3);
   state_variables[0][0] = 0.1;
   state_variables[0][1] = 0.01;
   state_variables[0][2] = 55000.0;
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, 298.15, state_parameters);
   jac_func(state_parameters, state_variables, jacobian);
 
   // J[gas,x] = -J[aq,x] for all x
@@ -656,12 +691,8 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionFiniteDifference)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -686,9 +717,7 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionFiniteDifference)
   auto jac_func = process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(
       phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
 
-  MatrixPolicy state_parameters(1, 2);
-  state_parameters[0][0] = HLC_ref;
-  state_parameters[0][1] = 298.15;
+  MatrixPolicy state_parameters(1, state_parameter_indices.size(), 0.0);
 
   double gas_conc = 1.0e-3;
   double aq_conc = 1.0e-5;
@@ -699,6 +728,7 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionFiniteDifference)
   state_variables[0][1] = aq_conc;
   state_variables[0][2] = solvent_conc;
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, 298.15, state_parameters);
   jac_func(state_parameters, state_variables, jacobian);
 
   // Finite difference for each state variable column j
@@ -749,12 +779,8 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionMultipleCells)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  std::string hlc_param = "MODE1.AQUEOUS." + process.uuid_ + ".hlc";
-  std::string temp_param = "MODE1.AQUEOUS." + process.uuid_ + ".temperature";
-
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices[hlc_param] = 0;
-  state_parameter_indices[temp_param] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -779,20 +805,18 @@ TEST(HenryLawPhaseTransfer, JacobianFunctionMultipleCells)
   auto jac_func = process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(
       phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
 
-  MatrixPolicy state_parameters(num_cells, 2);
+  MatrixPolicy state_parameters(num_cells, state_parameter_indices.size(), 0.0);
   MatrixPolicy state_variables(num_cells, 3);
 
   double T = 298.15;
-  double hlc = HLC_ref;
   for (std::size_t i = 0; i < num_cells; ++i)
   {
-    state_parameters[i][0] = hlc;
-    state_parameters[i][1] = T;
     state_variables[i][0] = 1.0e-3 * (i + 1);
     state_variables[i][1] = 1.0e-5;
     state_variables[i][2] = 55000.0;
   }
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, state_parameters);
   jac_func(state_parameters, state_variables, jacobian);
 
   auto cond_rate_provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -900,32 +924,37 @@ namespace
   {
     AerosolPropertyProvider<MatrixPolicy> provider;
     provider.dependent_variable_indices = dep_indices;
-    provider.ComputeValue =
-        [base_value, dep_indices, coeffs](const MatrixPolicy& params, const MatrixPolicy& vars, MatrixPolicy& result)
+    provider.BuildFunctions = [base_value, dep_indices, coeffs](
+                                  AerosolPropertyProvider<MatrixPolicy>& built, const PropertyColumns& columns)
     {
-      for (std::size_t row = 0; row < result.NumRows(); ++row)
+      built.ComputeValue = [base_value, dep_indices, coeffs, columns](
+                               const MatrixPolicy& params, const MatrixPolicy& vars, MatrixPolicy& result)
       {
-        double val = base_value;
-        for (std::size_t k = 0; k < dep_indices.size(); ++k)
-          val += coeffs[k] * vars[row][dep_indices[k]];
-        result[row][0] = val;
-      }
-    };
-    provider.ComputeValueAndDerivatives =
-        [base_value, dep_indices, coeffs](
-            const MatrixPolicy& params, const MatrixPolicy& vars, MatrixPolicy& result, MatrixPolicy& partials)
-    {
-      for (std::size_t row = 0; row < result.NumRows(); ++row)
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+        {
+          double val = base_value;
+          for (std::size_t k = 0; k < dep_indices.size(); ++k)
+            val += coeffs[k] * vars[row][dep_indices[k]];
+          result[row][columns.value_] = val;
+        }
+      };
+      built.ComputeValueAndDerivatives =
+          [base_value, dep_indices, coeffs, columns](
+              const MatrixPolicy& params, const MatrixPolicy& vars, MatrixPolicy& result, MatrixPolicy& partials)
       {
-        double val = base_value;
-        for (std::size_t k = 0; k < dep_indices.size(); ++k)
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
         {
-          val += coeffs[k] * vars[row][dep_indices[k]];
-          partials[row][k] = coeffs[k];
+          double val = base_value;
+          for (std::size_t k = 0; k < dep_indices.size(); ++k)
+          {
+            val += coeffs[k] * vars[row][dep_indices[k]];
+            partials[row][columns.partials_ + k] = coeffs[k];
+          }
+          result[row][columns.value_] = val;
         }
-        result[row][0] = val;
-      }
+      };
     };
+    provider.WriteTo({});
     return provider;
   }
 }  // namespace
@@ -942,10 +971,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultiplePhaseInstances)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -972,11 +998,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultiplePhaseInstances)
   double aq1 = 1.0e-5, solvent1 = 55000.0;
   double aq2 = 2.0e-5, solvent2 = 45000.0;
 
-  MatrixPolicy params(1, 4);
-  params[0][0] = hlc;
-  params[0][1] = T;
-  params[0][2] = hlc;
-  params[0][3] = T;
+  MatrixPolicy params(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy vars(1, 5);
   vars[0][0] = gas;
@@ -986,6 +1008,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultiplePhaseInstances)
   vars[0][4] = solvent2;
 
   MatrixPolicy forcing(1, 5, 0.0);
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, params);
   forcing_func(params, vars, forcing);
 
   auto crp = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -1024,10 +1047,7 @@ TEST(HenryLawPhaseTransfer, JacobianMultiplePhaseInstances)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -1054,11 +1074,7 @@ TEST(HenryLawPhaseTransfer, JacobianMultiplePhaseInstances)
   double aq1 = 1.0e-5, solvent1 = 55000.0;
   double aq2 = 2.0e-5, solvent2 = 45000.0;
 
-  MatrixPolicy params(1, 4);
-  params[0][0] = hlc;
-  params[0][1] = T;
-  params[0][2] = hlc;
-  params[0][3] = T;
+  MatrixPolicy params(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy vars(1, 5);
   vars[0][0] = gas;
@@ -1067,6 +1083,7 @@ TEST(HenryLawPhaseTransfer, JacobianMultiplePhaseInstances)
   vars[0][3] = aq2;
   vars[0][4] = solvent2;
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, params);
   jac_func(params, vars, jacobian);
 
   auto crp = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -1127,10 +1144,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiplePhaseInstances)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -1148,11 +1162,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiplePhaseInstances)
   providers.insert(prov1.begin(), prov1.end());
   providers.insert(prov2.begin(), prov2.end());
 
-  MatrixPolicy params(1, 4);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
-  params[0][2] = HLC_ref;
-  params[0][3] = 298.15;
+  MatrixPolicy params(1, state_parameter_indices.size(), 0.0);
 
   MatrixPolicy vars(1, 5);
   vars[0][0] = 1.0e-3;
@@ -1164,6 +1174,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiplePhaseInstances)
   // Two-mode tests: the large phi2*kc2*gas term in MODE2 doesn't depend on H2O1,
   // so it should cancel in the FD difference (f_plus - f_minus). The resulting
   // FD noise on J[gas, H2O1] (~1e-20) is absorbed by MICM's atol=1e-7.
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, 298.15, params);
   CheckFiniteDifferenceJacobian(
       process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, params, vars);
 }
@@ -1179,8 +1190,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleCellsVaryingConditions)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -1190,23 +1200,22 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleCellsVaryingConditions)
   auto providers = MakeTestProviders("MODE1", 2.0e-6, 5.0e8, 1.0e-4);
 
   std::size_t num_cells = 4;
-  MatrixPolicy params(num_cells, 2);
+  MatrixPolicy params(num_cells, state_parameter_indices.size(), 0.0);
   MatrixPolicy vars(num_cells, 3);
 
-  double temperatures[] = { 270.0, 285.0, 298.15, 310.0 };
+  std::vector<double> temperatures{ 270.0, 285.0, 298.15, 310.0 };
   double gas_concs[] = { 5.0e-4, 1.0e-3, 2.0e-3, 1.0e-2 };
   double aq_concs[] = { 1.0e-6, 1.0e-5, 5.0e-5, 1.0e-4 };
   double solvent_concs[] = { 55000.0, 50000.0, 45000.0, 40000.0 };
 
   for (std::size_t i = 0; i < num_cells; ++i)
   {
-    params[i][0] = HLC_ref;
-    params[i][1] = temperatures[i];
     vars[i][0] = gas_concs[i];
     vars[i][1] = aq_concs[i];
     vars[i][2] = solvent_concs[i];
   }
 
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, temperatures, params);
   CheckFiniteDifferenceJacobian(
       process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, params, vars);
 }
@@ -1223,10 +1232,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultiCellsMultiInstances)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -1247,16 +1253,12 @@ TEST(HenryLawPhaseTransfer, ForcingMultiCellsMultiInstances)
       process.ForcingFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices, providers);
 
   std::size_t num_cells = 3;
-  MatrixPolicy params(num_cells, 4);
+  MatrixPolicy params(num_cells, state_parameter_indices.size(), 0.0);
   MatrixPolicy vars(num_cells, 5);
 
   double T = 298.15, hlc = HLC_ref;
   for (std::size_t c = 0; c < num_cells; ++c)
   {
-    params[c][0] = hlc;
-    params[c][1] = T;
-    params[c][2] = hlc;
-    params[c][3] = T;
     vars[c][0] = 1.0e-3 * (c + 1);
     vars[c][1] = 1.0e-5;
     vars[c][2] = 55000.0;
@@ -1265,6 +1267,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultiCellsMultiInstances)
   }
 
   MatrixPolicy forcing(num_cells, 5, 0.0);
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, T, params);
   forcing_func(params, vars, forcing);
 
   auto crp = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -1299,10 +1302,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiCellsMultiInstances)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> state_parameter_indices;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  state_parameter_indices["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  state_parameter_indices["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, state_parameter_indices);
 
   std::unordered_map<std::string, std::size_t> state_variable_indices;
   state_variable_indices["CO2_g"] = 0;
@@ -1320,15 +1320,11 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiCellsMultiInstances)
   providers.insert(prov2.begin(), prov2.end());
 
   std::size_t num_cells = 3;
-  MatrixPolicy params(num_cells, 4);
+  MatrixPolicy params(num_cells, state_parameter_indices.size(), 0.0);
   MatrixPolicy vars(num_cells, 5);
 
   for (std::size_t c = 0; c < num_cells; ++c)
   {
-    params[c][0] = HLC_ref;
-    params[c][1] = 298.15;
-    params[c][2] = HLC_ref;
-    params[c][3] = 298.15;
     vars[c][0] = 1.0e-3 * (c + 1);
     vars[c][1] = 1.0e-5;
     vars[c][2] = 55000.0;
@@ -1339,6 +1335,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultiCellsMultiInstances)
   // Two-mode tests: the large phi2*kc2*gas term in MODE2 doesn't depend on H2O1,
   // so it should cancel in the FD difference (f_plus - f_minus). The resulting
   // FD noise on J[gas, H2O1] (~1e-20) is absorbed by MICM's atol=1e-7.
+  UpdateStateParameters(process, phase_prefixes, state_parameter_indices, 298.15, params);
   CheckFiniteDifferenceJacobian(
       process, phase_prefixes, state_parameter_indices, state_variable_indices, providers, params, vars);
 }
@@ -1387,10 +1384,8 @@ TEST(HenryLawPhaseTransfer, ForcingMultipleTransferProcesses)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + proc_CO2.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + proc_CO2.uuid_ + ".temperature"] = 1;
-  spi["MODE1.AQUEOUS." + proc_SO2.uuid_ + ".hlc"] = 2;
-  spi["MODE1.AQUEOUS." + proc_SO2.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(proc_CO2, phase_prefixes, spi);
+  AddProcessParameterIndices(proc_SO2, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1406,11 +1401,7 @@ TEST(HenryLawPhaseTransfer, ForcingMultipleTransferProcesses)
   auto ff_SO2 = proc_SO2.ForcingFunction<MatrixPolicy>(phase_prefixes, spi, svi, providers);
 
   double T = 298.15;
-  MatrixPolicy params(1, 4);
-  params[0][0] = HLC_CO2;
-  params[0][1] = T;
-  params[0][2] = HLC_SO2;
-  params[0][3] = T;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   double co2_g = 1.0e-3, so2_g = 5.0e-4;
   double co2_aq = 1.0e-5, so2_aq = 1.0e-4;
@@ -1424,6 +1415,8 @@ TEST(HenryLawPhaseTransfer, ForcingMultipleTransferProcesses)
   vars[0][4] = h2o;
 
   MatrixPolicy forcing(1, 5, 0.0);
+  UpdateStateParameters(proc_CO2, phase_prefixes, spi, T, params);
+  UpdateStateParameters(proc_SO2, phase_prefixes, spi, T, params);
   ff_CO2(params, vars, forcing);
   ff_SO2(params, vars, forcing);
 
@@ -1493,10 +1486,8 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleTransferProcesses)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + proc_CO2.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + proc_CO2.uuid_ + ".temperature"] = 1;
-  spi["MODE1.AQUEOUS." + proc_SO2.uuid_ + ".hlc"] = 2;
-  spi["MODE1.AQUEOUS." + proc_SO2.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(proc_CO2, phase_prefixes, spi);
+  AddProcessParameterIndices(proc_SO2, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1514,11 +1505,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleTransferProcesses)
   auto jf_SO2 = proc_SO2.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(phase_prefixes, spi, svi, jacobian, providers);
 
   double T = 298.15;
-  MatrixPolicy params(1, 4);
-  params[0][0] = HLC_CO2;
-  params[0][1] = T;
-  params[0][2] = HLC_SO2;
-  params[0][3] = T;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   MatrixPolicy vars(1, 5);
   vars[0][0] = 1.0e-3;
@@ -1527,6 +1514,8 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleTransferProcesses)
   vars[0][3] = 1.0e-4;
   vars[0][4] = 55000.0;
 
+  UpdateStateParameters(proc_CO2, phase_prefixes, spi, T, params);
+  UpdateStateParameters(proc_SO2, phase_prefixes, spi, T, params);
   jf_CO2(params, vars, jacobian);
   jf_SO2(params, vars, jacobian);
 
@@ -1583,8 +1572,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDWithLinearProviders)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1605,9 +1593,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDWithLinearProviders)
   providers["MODE1"][AerosolProperty::NumberConcentration] = N_prov;
   providers["MODE1"][AerosolProperty::PhaseVolumeFraction] = phi_prov;
 
-  MatrixPolicy params(1, 2);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   MatrixPolicy vars(1, 5);
   vars[0][0] = 1.0e-3;
@@ -1616,6 +1602,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDWithLinearProviders)
   vars[0][3] = 10.0;
   vars[0][4] = 5.0;
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
 }
 
@@ -1630,8 +1617,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDLinearProvidersMultiCell)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1650,12 +1636,10 @@ TEST(HenryLawPhaseTransfer, JacobianFDLinearProvidersMultiCell)
   providers["MODE1"][AerosolProperty::PhaseVolumeFraction] = phi_prov;
 
   std::size_t nc = 3;
-  MatrixPolicy params(nc, 2);
+  MatrixPolicy params(nc, spi.size(), 0.0);
   MatrixPolicy vars(nc, 5);
   for (std::size_t c = 0; c < nc; ++c)
   {
-    params[c][0] = HLC_ref;
-    params[c][1] = 298.15;
     vars[c][0] = 1.0e-3 * (c + 1);
     vars[c][1] = 1.0e-5 * (c + 1);
     vars[c][2] = 55000.0 - 5000.0 * c;
@@ -1663,6 +1647,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDLinearProvidersMultiCell)
     vars[c][4] = 5.0 + 3.0 * c;
   }
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
 }
 
@@ -1677,8 +1662,7 @@ TEST(HenryLawPhaseTransfer, ForcingAccumulates)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1689,9 +1673,7 @@ TEST(HenryLawPhaseTransfer, ForcingAccumulates)
 
   auto ff = process.ForcingFunction<MatrixPolicy>(phase_prefixes, spi, svi, providers);
 
-  MatrixPolicy params(1, 2);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   MatrixPolicy vars(1, 3);
   vars[0][0] = 1.0e-3;
@@ -1699,6 +1681,7 @@ TEST(HenryLawPhaseTransfer, ForcingAccumulates)
   vars[0][2] = 55000.0;
 
   MatrixPolicy forcing(1, 3, 0.0);
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   ff(params, vars, forcing);
   double f0_gas = forcing[0][0];
   double f0_aq = forcing[0][1];
@@ -1717,8 +1700,7 @@ TEST(HenryLawPhaseTransfer, JacobianAccumulates)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1730,15 +1712,14 @@ TEST(HenryLawPhaseTransfer, JacobianAccumulates)
   auto jacobian = BuildJacobian(process, phase_prefixes, svi, providers, 1);
   auto jf = process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(phase_prefixes, spi, svi, jacobian, providers);
 
-  MatrixPolicy params(1, 2);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   MatrixPolicy vars(1, 3);
   vars[0][0] = 1.0e-3;
   vars[0][1] = 1.0e-5;
   vars[0][2] = 55000.0;
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   jf(params, vars, jacobian);
   double j_gg_once = jacobian[0][0][0];
 
@@ -1757,8 +1738,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleDepsPerProvider)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1780,9 +1760,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleDepsPerProvider)
   providers["MODE1"][AerosolProperty::NumberConcentration] = N_prov;
   providers["MODE1"][AerosolProperty::PhaseVolumeFraction] = phi_prov;
 
-  MatrixPolicy params(1, 2);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
 
   MatrixPolicy vars(1, 6);
   vars[0][0] = 1.0e-3;
@@ -1792,6 +1770,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDMultipleDepsPerProvider)
   vars[0][4] = 0.3;
   vars[0][5] = 0.1;
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
 }
 
@@ -1807,10 +1786,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDKitchenSink)
   phase_prefixes["AQUEOUS"].insert("MODE2");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
-  spi["MODE2.AQUEOUS." + process.uuid_ + ".hlc"] = 2;
-  spi["MODE2.AQUEOUS." + process.uuid_ + ".temperature"] = 3;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -1840,14 +1816,10 @@ TEST(HenryLawPhaseTransfer, JacobianFDKitchenSink)
   providers["MODE2"][AerosolProperty::PhaseVolumeFraction] = phi_prov2;
 
   std::size_t nc = 2;
-  MatrixPolicy params(nc, 4);
+  MatrixPolicy params(nc, spi.size(), 0.0);
   MatrixPolicy vars(nc, 7);
   for (std::size_t c = 0; c < nc; ++c)
   {
-    params[c][0] = HLC_ref;
-    params[c][1] = 298.15;
-    params[c][2] = HLC_ref;
-    params[c][3] = 298.15;
     vars[c][0] = 1.0e-3 * (c + 1);
     vars[c][1] = 1.0e-5 * (c + 1);
     vars[c][2] = 55000.0 - 5000.0 * c;
@@ -1857,6 +1829,105 @@ TEST(HenryLawPhaseTransfer, JacobianFDKitchenSink)
     vars[c][6] = 0.3 + 0.2 * c;
   }
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
+  CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
+}
+
+// ---------------------------------------------------------------------------
+// Scaled partials: a representation's structured partials give the same Jacobian as
+// one dense partials column per dependent variable
+// ---------------------------------------------------------------------------
+
+namespace
+{
+  /// Wraps a provider so that it writes one partials column per dependent variable
+  AerosolPropertyProvider<MatrixPolicy> DenseEquivalent(const AerosolPropertyProvider<MatrixPolicy>& structured)
+  {
+    AerosolPropertyProvider<MatrixPolicy> dense;
+    dense.dependent_variable_indices = structured.dependent_variable_indices;
+    dense.BuildFunctions = [structured](AerosolPropertyProvider<MatrixPolicy>& built, const PropertyColumns& columns)
+    {
+      // The structured provider writes the value in place and its partials into a scratch matrix
+      auto moved = structured;
+      moved.WriteTo(PropertyColumns{ columns.value_, 0 });
+      built.ComputeValue = moved.ComputeValue;
+      built.ComputeValueAndDerivatives = [moved, columns](
+                                             const MatrixPolicy& params,
+                                             const MatrixPolicy& vars,
+                                             MatrixPolicy& result,
+                                             MatrixPolicy& partials)
+      {
+        const std::size_t n_columns = std::max(moved.NumberOfPartialsColumns(), std::size_t(1));
+        MatrixPolicy structured_partials(result.NumRows(), n_columns, 0.0);
+        moved.ComputeValueAndDerivatives(params, vars, result, structured_partials);
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+          for (std::size_t k = 0; k < moved.dependent_variable_indices.size(); ++k)
+            partials[row][columns.partials_ + k] = moved.PartialDerivative(structured_partials, row, k);
+      };
+    };
+    dense.WriteTo({});
+    return dense;
+  }
+}  // namespace
+
+TEST(HenryLawPhaseTransfer, JacobianScaledPartialsFromTwoMomentMode)
+{
+  auto process = MakeTestProcess();
+  auto organic = micm::Phase{
+    "ORGANIC", { { micm::Species{ "POA", { { "molecular weight [kg mol-1]", 0.2 }, { "density [kg m-3]", 1300.0 } } } } }
+  };
+  TwoMomentMode mode{ "MODE1", { MakeAqueousPhase(), organic } };
+
+  std::map<std::string, std::set<std::string>> phase_prefixes;
+  phase_prefixes["AQUEOUS"].insert("MODE1");
+
+  std::unordered_map<std::string, std::size_t> svi{ { "CO2_g", 0 } };
+  for (const auto& name : mode.StateVariableNames())
+    svi[name] = svi.size();
+  std::unordered_map<std::string, std::size_t> spi;
+  for (const auto& name : mode.StateParameterNames())
+    spi[name] = spi.size();
+  AddProcessParameterIndices(process, phase_prefixes, spi);
+
+  std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<MatrixPolicy>>> providers;
+  std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<MatrixPolicy>>> dense_providers;
+  for (auto property :
+       { AerosolProperty::EffectiveRadius, AerosolProperty::NumberConcentration, AerosolProperty::PhaseVolumeFraction })
+  {
+    auto provider = mode.GetPropertyProvider<MatrixPolicy>(property, spi, svi, "AQUEOUS");
+    dense_providers["MODE1"][property] = DenseEquivalent(provider);
+    providers["MODE1"][property] = std::move(provider);
+  }
+  // r_eff and φ have one factor column per group instead of one column per species
+  EXPECT_EQ(providers["MODE1"][AerosolProperty::EffectiveRadius].NumberOfPartialsColumns(), 2);
+  EXPECT_EQ(providers["MODE1"][AerosolProperty::PhaseVolumeFraction].NumberOfPartialsColumns(), 2);
+
+  constexpr std::size_t nc = 2;
+  MatrixPolicy params(nc, spi.size(), 0.0);
+  MatrixPolicy vars(nc, svi.size(), 0.0);
+  for (std::size_t c = 0; c < nc; ++c)
+  {
+    for (const auto& [name, value] : mode.DefaultParameters())
+      params[c][spi.at(name)] = value;
+    vars[c][svi.at("CO2_g")] = 1.0e-3 * (c + 1);
+    vars[c][svi.at("MODE1.AQUEOUS.CO2_aq")] = 1.0e-8 * (c + 1);
+    vars[c][svi.at("MODE1.AQUEOUS.H2O")] = 2.0e-5 + 1.0e-5 * c;
+    vars[c][svi.at("MODE1.ORGANIC.POA")] = 1.0e-6 * (c + 1);
+    vars[c][svi.at(mode.NumberConcentration())] = 1.0e8;
+  }
+  UpdateStateParameters(process, phase_prefixes, spi, { 290.0, 300.0 }, params);
+
+  auto jacobian = BuildJacobian(process, phase_prefixes, svi, providers, nc);
+  auto dense_jacobian = BuildJacobian(process, phase_prefixes, svi, dense_providers, nc);
+  process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(phase_prefixes, spi, svi, jacobian, providers)(
+      params, vars, jacobian);
+  process.JacobianFunction<MatrixPolicy, SparseMatrixPolicy>(phase_prefixes, spi, svi, dense_jacobian, dense_providers)(
+      params, vars, dense_jacobian);
+  ASSERT_EQ(jacobian.AsVector().size(), dense_jacobian.AsVector().size());
+  for (std::size_t i = 0; i < jacobian.AsVector().size(); ++i)
+    EXPECT_NEAR(jacobian.AsVector()[i], dense_jacobian.AsVector()[i], std::abs(dense_jacobian.AsVector()[i]) * 1.0e-12)
+        << "element " << i;
+
   CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
 }
 
@@ -2016,8 +2087,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroGasConcentration)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -2029,15 +2099,14 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroGasConcentration)
   auto ff = process.ForcingFunction<MatrixPolicy>(phase_prefixes, spi, svi, providers);
 
   double T = 298.15;
-  MatrixPolicy params(1, 2, 0.0);
-  params[0][0] = HLC_ref;
-  params[0][1] = T;
+  MatrixPolicy params(1, spi.size(), 0.0);
   MatrixPolicy vars(1, 3, 0.0);
   vars[0][0] = 0.0;      // [CO2_g] = 0
   vars[0][1] = 1.0e-5;   // [CO2_aq]
   vars[0][2] = 55000.0;  // [H2O]
 
   MatrixPolicy forcing(1, 3, 0.0);
+  UpdateStateParameters(process, phase_prefixes, spi, T, params);
   ff(params, vars, forcing);
 
   auto cond_rate_provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -2060,8 +2129,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroAqueousConcentration)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -2073,15 +2141,14 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroAqueousConcentration)
   auto ff = process.ForcingFunction<MatrixPolicy>(phase_prefixes, spi, svi, providers);
 
   double T = 298.15;
-  MatrixPolicy params(1, 2, 0.0);
-  params[0][0] = HLC_ref;
-  params[0][1] = T;
+  MatrixPolicy params(1, spi.size(), 0.0);
   MatrixPolicy vars(1, 3, 0.0);
   vars[0][0] = 1.0e-3;   // [CO2_g]
   vars[0][1] = 0.0;      // [CO2_aq] = 0
   vars[0][2] = 55000.0;  // [H2O]
 
   MatrixPolicy forcing(1, 3, 0.0);
+  UpdateStateParameters(process, phase_prefixes, spi, T, params);
   ff(params, vars, forcing);
 
   auto cond_rate_provider = MakeCondensationRateProvider(D_g, alpha, gas_molecular_weight);
@@ -2102,8 +2169,7 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroNumberConcentration)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -2113,15 +2179,14 @@ TEST(HenryLawPhaseTransfer, ForcingFunctionZeroNumberConcentration)
   auto providers = MakeTestProviders("MODE1", 1.0e-6, 0.0, 0.0);  // N=0, phi=0
   auto ff = process.ForcingFunction<MatrixPolicy>(phase_prefixes, spi, svi, providers);
 
-  MatrixPolicy params(1, 2, 0.0);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
   MatrixPolicy vars(1, 3, 0.0);
   vars[0][0] = 1.0e-3;
   vars[0][1] = 1.0e-5;
   vars[0][2] = 55000.0;
 
   MatrixPolicy forcing(1, 3, 0.0);
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   ff(params, vars, forcing);
 
   // When N=0 and phi=0, k_cond_eff = phi * k_cond = 0
@@ -2138,8 +2203,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDZeroGasConcentration)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -2148,14 +2212,13 @@ TEST(HenryLawPhaseTransfer, JacobianFDZeroGasConcentration)
 
   auto providers = MakeTestProviders("MODE1", 1.0e-6, 1.0e8, 1.0e-6);
 
-  MatrixPolicy params(1, 2, 0.0);
-  params[0][0] = HLC_ref;
-  params[0][1] = 298.15;
+  MatrixPolicy params(1, spi.size(), 0.0);
   MatrixPolicy vars(1, 3, 0.0);
   vars[0][0] = 0.0;  // [CO2_g] = 0
   vars[0][1] = 1.0e-5;
   vars[0][2] = 55000.0;
 
+  UpdateStateParameters(process, phase_prefixes, spi, 298.15, params);
   CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
 }
 
@@ -2165,11 +2228,10 @@ TEST(HenryLawPhaseTransfer, JacobianFDExtremeHLC)
   std::map<std::string, std::set<std::string>> phase_prefixes;
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
-  auto make_spi = [](const HenryLawPhaseTransfer& p)
+  auto make_spi = [&](const HenryLawPhaseTransfer& p)
   {
     std::unordered_map<std::string, std::size_t> spi;
-    spi["MODE1.AQUEOUS." + p.uuid_ + ".hlc"] = 0;
-    spi["MODE1.AQUEOUS." + p.uuid_ + ".temperature"] = 1;
+    AddProcessParameterIndices(p, phase_prefixes, spi);
     return spi;
   };
 
@@ -2180,8 +2242,6 @@ TEST(HenryLawPhaseTransfer, JacobianFDExtremeHLC)
 
   auto providers = MakeTestProviders("MODE1", 1.0e-6, 1.0e8, 1.0e-6);
 
-  MatrixPolicy params(1, 2, 0.0);
-  params[0][1] = 298.15;
   MatrixPolicy vars(1, 3, 0.0);
   vars[0][0] = 1.0e-3;
   vars[0][1] = 1.0e-5;
@@ -2189,13 +2249,17 @@ TEST(HenryLawPhaseTransfer, JacobianFDExtremeHLC)
 
   // Large HLC
   auto process_large = MakeTestProcess(1.0e5);
-  params[0][0] = 1.0e5;
-  CheckFiniteDifferenceJacobian(process_large, phase_prefixes, make_spi(process_large), svi, providers, params, vars);
+  auto spi_large = make_spi(process_large);
+  MatrixPolicy params_large(1, spi_large.size(), 0.0);
+  UpdateStateParameters(process_large, phase_prefixes, spi_large, 298.15, params_large);
+  CheckFiniteDifferenceJacobian(process_large, phase_prefixes, spi_large, svi, providers, params_large, vars);
 
   // Small HLC
   auto process_small = MakeTestProcess(1.0e-10);
-  params[0][0] = 1.0e-10;
-  CheckFiniteDifferenceJacobian(process_small, phase_prefixes, make_spi(process_small), svi, providers, params, vars);
+  auto spi_small = make_spi(process_small);
+  MatrixPolicy params_small(1, spi_small.size(), 0.0);
+  UpdateStateParameters(process_small, phase_prefixes, spi_small, 298.15, params_small);
+  CheckFiniteDifferenceJacobian(process_small, phase_prefixes, spi_small, svi, providers, params_small, vars);
 }
 
 TEST(HenryLawPhaseTransfer, JacobianFDTemperatureExtremes)
@@ -2205,8 +2269,7 @@ TEST(HenryLawPhaseTransfer, JacobianFDTemperatureExtremes)
   phase_prefixes["AQUEOUS"].insert("MODE1");
 
   std::unordered_map<std::string, std::size_t> spi;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".hlc"] = 0;
-  spi["MODE1.AQUEOUS." + process.uuid_ + ".temperature"] = 1;
+  AddProcessParameterIndices(process, phase_prefixes, spi);
 
   std::unordered_map<std::string, std::size_t> svi;
   svi["CO2_g"] = 0;
@@ -2222,9 +2285,8 @@ TEST(HenryLawPhaseTransfer, JacobianFDTemperatureExtremes)
 
   for (double T : { 200.0, 298.15, 350.0 })
   {
-    MatrixPolicy params(1, 2, 0.0);
-    params[0][0] = HLC_ref;
-    params[0][1] = T;
+    MatrixPolicy params(1, spi.size(), 0.0);
+    UpdateStateParameters(process, phase_prefixes, spi, T, params);
     CheckFiniteDifferenceJacobian(process, phase_prefixes, spi, svi, providers, params, vars);
   }
 }
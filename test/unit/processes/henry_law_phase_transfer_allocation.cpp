@@ -0,0 +1,180 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+//
+// Verifies that steady-state HenryLawPhaseTransfer forcing and Jacobian evaluations
+// do not allocate heap memory. Global operator new is replaced in this executable so
+// that allocations made while counting is enabled can be tallied.
+
+#include <miam/processes/henry_law_phase_transfer.hpp>
+
+#include <micm/system/conditions.hpp>
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+  std::atomic<bool> count_allocations{ false };
+  std::atomic<std::size_t> allocation_count{ 0 };
+
+  /// @brief Counts heap allocations made during its lifetime
+  class AllocationCounter
+  {
+   public:
+    AllocationCounter()
+    {
+      allocation_count = 0;
+      count_allocations = true;
+    }
+    ~AllocationCounter()
+    {
+      count_allocations = false;
+    }
+    std::size_t Count() const
+    {
+      return allocation_count.load();
+    }
+  };
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+using namespace miam;
+
+namespace
+{
+  template<typename DenseMatrixPolicy>
+  AerosolPropertyProvider<DenseMatrixPolicy> MakeConstantProvider(double value)
+  {
+    AerosolPropertyProvider<DenseMatrixPolicy> provider;
+    provider.BuildFunctions = [value](AerosolPropertyProvider<DenseMatrixPolicy>& built, const PropertyColumns& columns)
+    {
+      built.ComputeValue =
+          [value, columns](const DenseMatrixPolicy&, const DenseMatrixPolicy&, DenseMatrixPolicy& result)
+      {
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+          result[row][columns.value_] = value;
+      };
+      built.ComputeValueAndDerivatives = [value, columns](
+                                             const DenseMatrixPolicy&,
+                                             const DenseMatrixPolicy&,
+                                             DenseMatrixPolicy& result,
+                                             DenseMatrixPolicy&)
+      {
+        for (std::size_t row = 0; row < result.NumRows(); ++row)
+          result[row][columns.value_] = value;
+      };
+    };
+    provider.WriteTo({});
+    return provider;
+  }
+
+  template<typename DenseMatrixPolicy, typename SparseMatrixPolicy>
+  void TestSteadyStateIsAllocationFree(std::size_t number_of_cells)
+  {
+    auto gas = micm::Species{ "CO2_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+    auto aq = micm::Species{ "CO2_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } };
+    auto h2o = micm::Species{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    micm::Phase aqueous{ "AQUEOUS", { { aq }, { h2o } } };
+    HenryLawPhaseTransfer process(
+        [](const micm::Conditions&) { return 3.4e-2; }, gas, aq, h2o, aqueous, 1.5e-5, 0.05, 0.044, 0.018, 1000.0);
+
+    std::map<std::string, std::set<std::string>> phase_prefixes;
+    phase_prefixes["AQUEOUS"] = { "MODE1", "MODE2" };
+
+    std::unordered_map<std::string, std::size_t> state_parameter_indices;
+    std::unordered_map<std::string, std::size_t> state_variable_indices;
+    std::map<std::string, std::map<AerosolProperty, AerosolPropertyProvider<DenseMatrixPolicy>>> providers;
+    state_variable_indices["CO2_g"] = 0;
+    for (const auto& prefix : phase_prefixes["AQUEOUS"])
+    {
+      state_parameter_indices[prefix + ".AQUEOUS." + process.uuid_ + ".mean_free_path"] = state_parameter_indices.size();
+      state_parameter_indices[prefix + ".AQUEOUS." + process.uuid_ + ".hlc_rt"] = state_parameter_indices.size();
+      state_variable_indices[prefix + ".AQUEOUS.CO2_aq"] = state_variable_indices.size();
+      state_variable_indices[prefix + ".AQUEOUS.H2O"] = state_variable_indices.size();
+      providers[prefix][AerosolProperty::EffectiveRadius] = MakeConstantProvider<DenseMatrixPolicy>(1.0e-6);
+      providers[prefix][AerosolProperty::NumberConcentration] = MakeConstantProvider<DenseMatrixPolicy>(1.0e8);
+      providers[prefix][AerosolProperty::PhaseVolumeFraction] = MakeConstantProvider<DenseMatrixPolicy>(1.0);
+    }
+
+    DenseMatrixPolicy state_parameters(number_of_cells, state_parameter_indices.size(), 0.0);
+    DenseMatrixPolicy state_variables(number_of_cells, state_variable_indices.size(), 0.0);
+    DenseMatrixPolicy forcing(number_of_cells, state_variable_indices.size(), 0.0);
+    std::vector<micm::Conditions> conditions(number_of_cells);
+    for (auto& cond : conditions)
+      cond.temperature_ = 298.15;
+    process.UpdateStateParametersFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices)(
+        conditions, state_parameters);
+    for (std::size_t i_cell = 0; i_cell < number_of_cells; ++i_cell)
+      for (const auto& [name, idx] : state_variable_indices)
+        state_variables[i_cell][idx] = name.ends_with(".H2O") ? 55000.0 : 1.0e-4 * (1.0 + i_cell);
+
+    auto elements = process.NonZeroJacobianElements<DenseMatrixPolicy>(phase_prefixes, state_variable_indices, providers);
+    auto builder = SparseMatrixPolicy::Create(state_variable_indices.size()).SetNumberOfBlocks(number_of_cells);
+    for (const auto& elem : elements)
+      builder.WithElement(elem.first, elem.second);
+    SparseMatrixPolicy jacobian(builder);
+
+    auto forcing_fn =
+        process.ForcingFunction<DenseMatrixPolicy>(phase_prefixes, state_parameter_indices, state_variable_indices, providers);
+    auto jacobian_fn = process.JacobianFunction<DenseMatrixPolicy, SparseMatrixPolicy>(
+        phase_prefixes, state_parameter_indices, state_variable_indices, jacobian, providers);
+
+    // The first calls size the property cache for this number of grid cells
+    forcing_fn(state_parameters, state_variables, forcing);
+    jacobian_fn(state_parameters, state_variables, jacobian);
+
+    std::size_t allocations = 0;
+    {
+      AllocationCounter counter;
+      for (int i = 0; i < 10; ++i)
+      {
+        forcing_fn(state_parameters, state_variables, forcing);
+        jacobian_fn(state_parameters, state_variables, jacobian);
+      }
+      allocations = counter.Count();
+    }
+    EXPECT_EQ(allocations, 0);
+    EXPECT_NE(forcing[0][0], 0.0);
+  }
+}  // namespace
+
+TEST(HenryLawPhaseTransferAllocation, StandardMatrixSteadyStateDoesNotAllocate)
+{
+  TestSteadyStateIsAllocationFree<
+      micm::Matrix<double>,
+      micm::SparseMatrix<double, micm::SparseMatrixStandardOrderingCompressedSparseRow>>(3);
+}
+
+TEST(HenryLawPhaseTransferAllocation, VectorMatrixSteadyStateDoesNotAllocate)
+{
+  TestSteadyStateIsAllocationFree<
+      micm::VectorMatrix<double, 4>,
+      micm::SparseMatrix<double, micm::SparseMatrixVectorOrderingCompressedSparseRow<4>>>(7);
+}
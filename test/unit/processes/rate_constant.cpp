@@ -0,0 +1,263 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/processes/constants/equilibrium_constant.hpp>
+#include <miam/processes/constants/rate_constant.hpp>
+#include <miam/processes/dissolved_reaction.hpp>
+#include <miam/processes/dissolved_reversible_reaction_builder.hpp>
+
+#include <micm/process/rate_constant/arrhenius_rate_constant.hpp>
+#include <micm/process/rate_constant/rate_constant_functions.hpp>
+#include <micm/system/conditions.hpp>
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  std::vector<micm::Conditions> MakeConditions(std::size_t number_of_cells)
+  {
+    std::vector<micm::Conditions> conditions(number_of_cells);
+    for (std::size_t i = 0; i < number_of_cells; ++i)
+    {
+      conditions[i].temperature_ = 240.0 + 10.0 * static_cast<double>(i);
+      conditions[i].pressure_ = 60000.0 + 5000.0 * static_cast<double>(i);
+      conditions[i].air_density_ = 1.5e25 + 1.0e24 * static_cast<double>(i);
+    }
+    return conditions;
+  }
+
+  double ReferenceTroe(const TroeRateConstantParameters& p, double temperature, double air_density)
+  {
+    double k0 = p.k0_A_ * std::exp(p.k0_C_ / temperature) * std::pow(temperature / 300.0, p.k0_B_);
+    double kinf = p.kinf_A_ * std::exp(p.kinf_C_ / temperature) * std::pow(temperature / 300.0, p.kinf_B_);
+    double x = std::log10(k0 * air_density / kinf) / p.N_;
+    return k0 * air_density / (1.0 + k0 * air_density / kinf) * std::pow(p.Fc_, 1.0 / (1.0 + x * x));
+  }
+}  // namespace
+
+TEST(RateConstant, ConstantKind)
+{
+  RateConstant rate{ 0.25 };
+  EXPECT_EQ(rate.GetKind(), RateConstant::Kind::Constant);
+  for (const auto& conditions : MakeConditions(4))
+    EXPECT_EQ(rate(conditions), 0.25);
+}
+
+TEST(RateConstant, VantHoffKindMatchesCalculateVantHoff)
+{
+  VantHoffParameters params{ .A_ = 3.2e-2, .C_ = -2400.0, .T0_ = 298.15 };
+  RateConstant rate{ params };
+  EXPECT_EQ(rate.GetKind(), RateConstant::Kind::VantHoff);
+  for (const auto& conditions : MakeConditions(6))
+    EXPECT_DOUBLE_EQ(rate(conditions), CalculateVantHoff(params, conditions.temperature_));
+}
+
+TEST(RateConstant, ArrheniusKindMatchesMicm)
+{
+  micm::ArrheniusRateConstantParameters params{ .A_ = 1.333e8, .B_ = -1.2, .C_ = -4430.0, .D_ = 300.0, .E_ = 1.0e-6 };
+  RateConstant rate{ params };
+  EXPECT_EQ(rate.GetKind(), RateConstant::Kind::Arrhenius);
+  for (const auto& conditions : MakeConditions(6))
+    EXPECT_DOUBLE_EQ(rate(conditions), micm::CalculateArrhenius(params, conditions.temperature_, conditions.pressure_));
+}
+
+TEST(RateConstant, TroeKindMatchesReferenceFormula)
+{
+  TroeRateConstantParameters params{
+    .k0_A_ = 6.0e-34, .k0_B_ = -2.4, .kinf_A_ = 2.3e-11, .kinf_B_ = 0.2, .Fc_ = 0.6, .N_ = 1.0
+  };
+  RateConstant rate{ params };
+  EXPECT_EQ(rate.GetKind(), RateConstant::Kind::Troe);
+  for (const auto& conditions : MakeConditions(6))
+  {
+    double expected = ReferenceTroe(params, conditions.temperature_, conditions.air_density_);
+    EXPECT_NEAR(rate(conditions), expected, 1.0e-12 * std::abs(expected));
+  }
+}
+
+TEST(RateConstant, FunctionFallback)
+{
+  RateConstant rate{ [](const micm::Conditions& conditions) { return 1.0e-3 * conditions.temperature_; } };
+  EXPECT_EQ(rate.GetKind(), RateConstant::Kind::Function);
+  for (const auto& conditions : MakeConditions(3))
+    EXPECT_DOUBLE_EQ(rate(conditions), 1.0e-3 * conditions.temperature_);
+}
+
+TEST(RateConstant, Equality)
+{
+  RateConstant function_rate{ [](const micm::Conditions&) { return 1.0; } };
+  RateConstant same_body{ [](const micm::Conditions&) { return 1.0; } };
+  RateConstant copy = function_rate;
+  RateConstant vant_hoff{ VantHoffParameters{ .A_ = 2.0, .C_ = 100.0 } };
+  RateConstant arrhenius{ micm::ArrheniusRateConstantParameters{ .A_ = 2.0 } };
+
+  EXPECT_TRUE(RateConstant{ 0.5 } == RateConstant{ 0.5 });
+  EXPECT_FALSE(RateConstant{ 0.5 } == RateConstant{ 0.25 });
+  EXPECT_TRUE(vant_hoff == RateConstant(VantHoffParameters{ .A_ = 2.0, .C_ = 100.0 }));
+  EXPECT_FALSE(vant_hoff == RateConstant(VantHoffParameters{ .A_ = 2.0, .C_ = 200.0 }));
+  EXPECT_FALSE(vant_hoff == arrhenius);
+  EXPECT_TRUE(copy == function_rate);
+  EXPECT_FALSE(same_body == function_rate);
+}
+
+TEST(RateConstant, SharedRateConstantPrefix)
+{
+  RateConstant shared{ [](const micm::Conditions&) { return 1.0; } };
+  std::map<std::string, RateConstant> rates{ { "A", 0.1 }, { "B", shared }, { "C", 0.1 }, { "D", shared } };
+  std::set<std::string> prefixes{ "A", "B", "C", "D", "E" };
+
+  EXPECT_EQ(SharedRateConstantPrefix(rates, prefixes, "A"), "A");
+  EXPECT_EQ(SharedRateConstantPrefix(rates, prefixes, "B"), "B");
+  EXPECT_EQ(SharedRateConstantPrefix(rates, prefixes, "C"), "A");
+  EXPECT_EQ(SharedRateConstantPrefix(rates, prefixes, "D"), "B");
+  EXPECT_EQ(SharedRateConstantPrefix(rates, prefixes, "E"), "E");
+
+  // Only prefixes that are in use can own a shared parameter
+  EXPECT_EQ(SharedRateConstantPrefix(rates, { "C", "D" }, "C"), "C");
+}
+
+TEST(RateConstant, ReversibleBuilderSharesDerivedRateConstants)
+{
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto s = micm::Species{ "S" };
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { s } } };
+
+  auto reaction = DissolvedReversibleReactionBuilder{}
+                      .SetPhase(phase)
+                      .SetReactants({ a })
+                      .SetProducts({ b })
+                      .SetSolvent(s)
+                      .SetEquilibriumConstant(EquilibriumConstant({ .A_ = 4.0 }))
+                      .AddReverseRateConstant("BIN_1", 0.5)
+                      .AddReverseRateConstant("BIN_2", 0.5)
+                      .AddReverseRateConstant("BIN_3", 0.25)
+                      .Build();
+
+  const auto& forward = reaction.forward_rate_constants_;
+  EXPECT_TRUE(forward.at("BIN_1") == forward.at("BIN_2"));
+  EXPECT_FALSE(forward.at("BIN_1") == forward.at("BIN_3"));
+  micm::Conditions conditions{};
+  EXPECT_DOUBLE_EQ(forward.at("BIN_2")(conditions), 2.0);
+  EXPECT_DOUBLE_EQ(forward.at("BIN_3")(conditions), 1.0);
+
+  std::map<std::string, std::set<std::string>> phase_prefixes{ { "AQUEOUS", { "BIN_1", "BIN_2", "BIN_3" } } };
+  EXPECT_EQ(reaction.ProcessParameterNames(phase_prefixes).size(), 4u);
+}
+
+TEST(RateConstant, ReversibleBuilderSharesRateConstantsAcrossPrefixes)
+{
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto s = micm::Species{ "S" };
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { s } } };
+
+  std::set<std::string> bins{ "BIN_1", "BIN_2", "BIN_3" };
+  auto forward = [](const micm::Conditions& conditions) { return 2.0e-3 * conditions.temperature_; };
+  auto reaction = DissolvedReversibleReactionBuilder{}
+                      .SetPhase(phase)
+                      .SetReactants({ a })
+                      .SetProducts({ b })
+                      .SetSolvent(s)
+                      .AddForwardRateConstant(bins, forward)
+                      .AddReverseRateConstant(bins, EquilibriumConstant({ .A_ = 4.0 }))
+                      .Build();
+
+  // One forward and one reverse parameter for all three bins
+  std::map<std::string, std::set<std::string>> phase_prefixes{ { "AQUEOUS", bins } };
+  EXPECT_EQ(reaction.ProcessParameterNames(phase_prefixes).size(), 2u);
+  EXPECT_TRUE(reaction.forward_rate_constants_.at("BIN_1") == reaction.forward_rate_constants_.at("BIN_3"));
+}
+
+TEST(RateConstant, ReversibleBuilderKeepsClosedFormEquilibriumConstants)
+{
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto s = micm::Species{ "S" };
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { s } } };
+
+  EquilibriumConstantParameters params{ .A_ = 2.0e3, .C_ = 1500.0 };
+  auto reaction = DissolvedReversibleReactionBuilder{}
+                      .SetPhase(phase)
+                      .SetReactants({ a })
+                      .SetProducts({ b })
+                      .SetSolvent(s)
+                      .AddForwardRateConstant("CLOUD", EquilibriumConstant(params))
+                      .AddReverseRateConstant("CLOUD", 0.5)
+                      .AddForwardRateConstant("RAIN", EquilibriumConstant(params, VantHoffTableOptions{}))
+                      .AddReverseRateConstant("RAIN", micm::ArrheniusRateConstantParameters{ .A_ = 0.5 })
+                      .Build();
+
+  EXPECT_EQ(reaction.forward_rate_constants_.at("CLOUD").GetKind(), RateConstant::Kind::VantHoff);
+  EXPECT_EQ(reaction.reverse_rate_constants_.at("CLOUD").GetKind(), RateConstant::Kind::Constant);
+  EXPECT_EQ(reaction.forward_rate_constants_.at("RAIN").GetKind(), RateConstant::Kind::Function);
+  EXPECT_EQ(reaction.reverse_rate_constants_.at("RAIN").GetKind(), RateConstant::Kind::Arrhenius);
+
+  for (const auto& conditions : MakeConditions(4))
+    EXPECT_DOUBLE_EQ(
+        reaction.forward_rate_constants_.at("CLOUD")(conditions), EquilibriumConstant(params).Calculate(conditions));
+}
+
+template<class MatrixPolicy>
+void TestColumnEvaluationMatchesScalar()
+{
+  auto a = micm::Species{ "A" };
+  auto b = micm::Species{ "B" };
+  auto solvent = micm::Species{ "S" };
+  auto phase = micm::Phase{ "AQUEOUS", { { a }, { b }, { solvent } } };
+
+  std::map<std::string, RateConstant> rates{
+    { "MODE1", 0.1 },
+    { "MODE2", VantHoffParameters{ .A_ = 0.2, .C_ = -1200.0 } },
+    { "MODE3", micm::ArrheniusRateConstantParameters{ .A_ = 4.0e6, .B_ = 0.5, .C_ = -3000.0 } },
+    { "MODE4", TroeRateConstantParameters{ .k0_A_ = 6.0e-34, .k0_B_ = -2.4, .kinf_A_ = 2.3e-11 } },
+    { "MODE5", [](const micm::Conditions& conditions) { return 1.0e-4 * conditions.pressure_; } },
+  };
+  DissolvedReaction reaction{ rates, { a }, { b }, solvent, phase };
+
+  std::map<std::string, std::set<std::string>> phase_prefixes;
+  std::unordered_map<std::string, std::size_t> state_parameter_indices;
+  for (const auto& [prefix, rate] : rates)
+  {
+    phase_prefixes["AQUEOUS"].insert(prefix);
+    std::size_t index = state_parameter_indices.size();
+    state_parameter_indices[prefix + "." + phase.name_ + "." + reaction.uuid_ + ".k"] = index;
+  }
+
+  auto update_func = reaction.UpdateStateParametersFunction<MatrixPolicy>(phase_prefixes, state_parameter_indices);
+
+  const std::size_t number_of_cells = 7;
+  MatrixPolicy state_parameters(number_of_cells, state_parameter_indices.size(), 0.0);
+  auto conditions = MakeConditions(number_of_cells);
+  update_func(conditions, state_parameters);
+
+  for (const auto& [prefix, rate] : rates)
+  {
+    std::size_t index = state_parameter_indices.at(prefix + "." + phase.name_ + "." + reaction.uuid_ + ".k");
+    for (std::size_t i_cell = 0; i_cell < number_of_cells; ++i_cell)
+      EXPECT_DOUBLE_EQ(state_parameters[i_cell][index], rate(conditions[i_cell])) << prefix << " cell " << i_cell;
+  }
+}
+
+TEST(RateConstant, ColumnEvaluationMatchesScalarStandardMatrix)
+{
+  TestColumnEvaluationMatchesScalar<micm::Matrix<double>>();
+}
+
+TEST(RateConstant, ColumnEvaluationMatchesScalarVectorMatrix)
+{
+  TestColumnEvaluationMatchesScalar<micm::VectorMatrix<double, 4>>();
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/processes/constants/equilibrium_constant.hpp>
+#include <miam/processes/constants/henry_law_constant.hpp>
+#include <miam/processes/constants/vant_hoff.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace miam;
+
+namespace
+{
+  double MaxRelativeErrorOnScan(const VantHoffTable& table, const VantHoffParameters& parameters, double step)
+  {
+    double worst = 0.0;
+    for (double T = table.MinTemperature(); T <= table.MaxTemperature(); T += step)
+    {
+      double exact = CalculateVantHoff(parameters, T);
+      worst = std::max(worst, std::abs(table.Evaluate(T) - exact) / std::abs(exact));
+    }
+    return worst;
+  }
+}  // namespace
+
+TEST(VantHoffTable, ErrorWithinTolerance)
+{
+  for (double C : { -2500.0, 2300.0, 6710.0, 12000.0 })
+    for (double tolerance : { 1.0e-6, 1.0e-10 })
+    {
+      VantHoffParameters parameters{ 1.0e-14, C, 298.15 };
+      VantHoffTable table(parameters, { .relative_tolerance_ = tolerance });
+      EXPECT_LE(table.MaxRelativeError(), tolerance) << "C = " << C;
+      // Scan off the grid: the measured midpoint error bounds the error everywhere
+      EXPECT_LE(MaxRelativeErrorOnScan(table, parameters, 0.0137), 1.1 * tolerance) << "C = " << C;
+    }
+}
+
+TEST(VantHoffTable, DefaultToleranceKeepsTablesSmall)
+{
+  // A typical C over the default range needs a few hundred points, not thousands
+  VantHoffTable table({ 1.0, 5000.0, 298.15 });
+  EXPECT_LE(table.MaxRelativeError(), VantHoffTableOptions{}.relative_tolerance_);
+  EXPECT_LT(table.Size(), 250);
+}
+
+TEST(VantHoffTable, ExactAtTableEnds)
+{
+  VantHoffParameters parameters{ 3.4e-2, -2400.0, 298.15 };
+  VantHoffTable table(parameters);
+  EXPECT_NEAR(table.Evaluate(180.0), CalculateVantHoff(parameters, 180.0), 1.0e-14 * CalculateVantHoff(parameters, 180.0));
+  EXPECT_NEAR(table.Evaluate(330.0), CalculateVantHoff(parameters, 330.0), 1.0e-14 * CalculateVantHoff(parameters, 330.0));
+}
+
+TEST(VantHoffTable, FallsBackOutsideRange)
+{
+  VantHoffParameters parameters{ 1.0, 6710.0, 298.15 };
+  VantHoffTable table(parameters, { .min_temperature_ = 250.0, .max_temperature_ = 300.0 });
+  EXPECT_EQ(table.Evaluate(249.0), CalculateVantHoff(parameters, 249.0));
+  EXPECT_EQ(table.Evaluate(301.0), CalculateVantHoff(parameters, 301.0));
+  EXPECT_EQ(table.Evaluate(400.0), CalculateVantHoff(parameters, 400.0));
+}
+
+TEST(VantHoffTable, TemperatureIndependentConstant)
+{
+  VantHoffTable table({ 5.0, 0.0, 298.15 });
+  EXPECT_EQ(table.Size(), 2);
+  EXPECT_DOUBLE_EQ(table.Evaluate(200.0), 5.0);
+  EXPECT_DOUBLE_EQ(table.Evaluate(310.0), 5.0);
+}
+
+TEST(VantHoffTable, SizeLimitIsRespected)
+{
+  VantHoffParameters parameters{ 1.0, 12000.0, 298.15 };
+  VantHoffTable table(parameters, { .relative_tolerance_ = 1.0e-15, .max_intervals_ = 100 });
+  EXPECT_EQ(table.Size(), 101);
+  // The achieved error is still reported, even though it misses the requested tolerance
+  EXPECT_GT(table.MaxRelativeError(), 1.0e-15);
+  EXPECT_LE(MaxRelativeErrorOnScan(table, parameters, 0.0137), 1.1 * table.MaxRelativeError());
+}
+
+TEST(VantHoffTable, InvalidOptionsThrow)
+{
+  VantHoffParameters parameters{ 1.0, 1000.0, 298.15 };
+  EXPECT_ANY_THROW(VantHoffTable(parameters, { .min_temperature_ = 0.0 }));
+  EXPECT_ANY_THROW(VantHoffTable(parameters, { .min_temperature_ = 300.0, .max_temperature_ = 250.0 }));
+  EXPECT_ANY_THROW(VantHoffTable(parameters, { .relative_tolerance_ = 0.0 }));
+  EXPECT_ANY_THROW(VantHoffTable(parameters, { .max_intervals_ = 0 }));
+}
+
+TEST(VantHoffTable, TabulatedHenryLawConstant)
+{
+  HenryLawConstantParameters parameters{ .HLC_ref_ = 1.23e-2, .C_ = 3120.0, .T0_ = 298.15 };
+  HenryLawConstant exact(parameters);
+  HenryLawConstant tabulated(parameters, VantHoffTableOptions{});
+  EXPECT_EQ(exact.Table(), nullptr);
+  ASSERT_NE(tabulated.Table(), nullptr);
+
+  // Copies share the table
+  HenryLawConstant copy = tabulated;
+  EXPECT_EQ(copy.Table(), tabulated.Table());
+
+  for (double T : { 185.0, 230.5, 273.15, 298.15, 329.0, 350.0 })
+    EXPECT_NEAR(tabulated.Calculate(T), exact.Calculate(T), 1.0e-6 * exact.Calculate(T)) << "T = " << T;
+}
+
+TEST(VantHoffTable, TabulatedEquilibriumConstant)
+{
+  EquilibriumConstantParameters parameters{ .A_ = 1.0e-14, .C_ = 6710.0, .T0_ = 298.15 };
+  EquilibriumConstant exact(parameters);
+  EquilibriumConstant tabulated(parameters, VantHoffTableOptions{ .min_temperature_ = 200.0, .max_temperature_ = 320.0 });
+  ASSERT_NE(tabulated.Table(), nullptr);
+
+  micm::Conditions conditions;
+  for (double T : { 150.0, 200.0, 255.3, 298.15, 320.0 })
+  {
+    conditions.temperature_ = T;
+    EXPECT_NEAR(tabulated.Calculate(conditions), exact.Calculate(conditions), 1.0e-6 * exact.Calculate(conditions))
+        << "T = " << T;
+  }
+}
@@ -0,0 +1,238 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+// Profiling is a compile-time option; this test always builds the instrumented Model functions
+#ifndef MIAM_ENABLE_PROFILING
+  #define MIAM_ENABLE_PROFILING
+#endif
+
+#include <miam/constraints/linear_constraint_builder.hpp>
+#include <miam/model/model.hpp>
+#include <miam/processes/dissolved_reaction.hpp>
+#include <miam/processes/henry_law_phase_transfer.hpp>
+#include <miam/representations/single_moment_mode.hpp>
+#include <miam/util/profiler.hpp>
+
+#include <micm/system/conditions.hpp>
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+#include <micm/util/sparse_matrix.hpp>
+#include <micm/util/sparse_matrix_standard_ordering.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  using DenseMatrix = micm::Matrix<double>;
+  using SparseMatrix = micm::SparseMatrix<double, micm::SparseMatrixStandardOrdering>;
+
+  /// Builds a model with a phase transfer, a reaction and a linear constraint on one mode
+  Model MakeProfiledModel()
+  {
+    auto h2o = micm::Species{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+    auto a_g = micm::Species{ "A_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+    auto a_aq = micm::Species{ "A_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } };
+    auto b_aq = micm::Species{ "B_aq", { { "molecular weight [kg mol-1]", 0.062 }, { "density [kg m-3]", 1500.0 } } };
+    auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a_aq }, { b_aq } } };
+
+    auto hlc = [](const micm::Conditions& conditions) { return 3.4e-2; };
+    auto k = [](const micm::Conditions& conditions) { return 4.0e-3; };
+
+    Model model;
+    model.name_ = "PROFILED";
+    model.representations_.push_back(SingleMomentMode{ "MODE1", { aqueous_phase } });
+    model.AddProcesses(
+        HenryLawPhaseTransfer{ hlc, a_g, a_aq, h2o, aqueous_phase, 1.5e-5, 0.05, 0.044, 0.018, 1000.0 },
+        DissolvedReaction{ { { "MODE1", k } }, { a_aq }, { b_aq }, h2o, aqueous_phase });
+    model.AddConstraints(LinearConstraintBuilder()
+                             .SetAlgebraicSpecies(aqueous_phase, b_aq)
+                             .AddTerm(aqueous_phase, a_aq, 1.0)
+                             .AddTerm(aqueous_phase, b_aq, 1.0)
+                             .SetConstant(1.0)
+                             .Build());
+    return model;
+  }
+
+  struct Indices
+  {
+    std::unordered_map<std::string, std::size_t> variables_;
+    std::unordered_map<std::string, std::size_t> parameters_;
+  };
+
+  Indices MakeIndices(const Model& model)
+  {
+    Indices indices;
+    indices.variables_["A_g"] = 0;
+    for (const auto& name : model.StateVariableNames())
+      indices.variables_[name] = indices.variables_.size();
+    auto parameter_names = model.StateParameterNames();
+    auto constraint_names = model.ConstraintStateParameterNames();
+    parameter_names.insert(constraint_names.begin(), constraint_names.end());
+    for (const auto& name : parameter_names)
+      indices.parameters_[name] = indices.parameters_.size();
+    return indices;
+  }
+
+  const ProfileEntry* Find(const std::vector<ProfileEntry>& profile, const std::string& type, ProfiledFunction function)
+  {
+    auto it = std::find_if(
+        profile.begin(),
+        profile.end(),
+        [&](const ProfileEntry& entry) { return entry.type_ == type && entry.function_ == function; });
+    return it == profile.end() ? nullptr : &*it;
+  }
+}  // namespace
+
+TEST(Profiler, RegisterReturnsOneCounterPerKey)
+{
+  Profiler profiler;
+  auto first = profiler.Register("DissolvedReaction", "uuid-1", ProfiledFunction::Forcing);
+  auto again = profiler.Register("DissolvedReaction", "uuid-1", ProfiledFunction::Forcing);
+  auto other = profiler.Register("DissolvedReaction", "uuid-1", ProfiledFunction::Jacobian);
+  EXPECT_EQ(first, again);
+  EXPECT_NE(first, other);
+
+  first->Add(3, std::chrono::milliseconds(2));
+  again->Add(5, std::chrono::milliseconds(1));
+  auto report = profiler.Report();
+  ASSERT_EQ(report.size(), 2);
+  EXPECT_EQ(report[0].type_, "DissolvedReaction");
+  EXPECT_EQ(report[0].uuid_, "uuid-1");
+  EXPECT_EQ(report[0].function_, ProfiledFunction::Forcing);
+  EXPECT_EQ(report[0].calls_, 2);
+  EXPECT_EQ(report[0].cells_, 8);
+  EXPECT_NEAR(report[0].seconds_, 3.0e-3, 1.0e-12);
+  EXPECT_EQ(report[1].calls_, 0);
+}
+
+TEST(Profiler, ResetKeepsEntries)
+{
+  Profiler profiler;
+  profiler.Register("LinearConstraint", "uuid-2", ProfiledFunction::ConstraintResidual)
+      ->Add(4, std::chrono::microseconds(10));
+  profiler.Reset();
+  auto report = profiler.Report();
+  ASSERT_EQ(report.size(), 1);
+  EXPECT_EQ(report[0].calls_, 0);
+  EXPECT_EQ(report[0].cells_, 0);
+  EXPECT_EQ(report[0].seconds_, 0.0);
+}
+
+TEST(Profiler, ProfileFunctionCountsCallsAndCells)
+{
+  Profiler profiler;
+  int calls = 0;
+  std::function<void(const DenseMatrix&, DenseMatrix&)> function = [&](const DenseMatrix&, DenseMatrix&) { ++calls; };
+  auto profiled = ProfileFunction(function, profiler.Register("Model", "M", ProfiledFunction::Forcing));
+  DenseMatrix input(5, 2, 0.0);
+  DenseMatrix output(5, 2, 0.0);
+  profiled(input, output);
+  profiled(input, output);
+  EXPECT_EQ(calls, 2);
+  auto report = profiler.Report();
+  ASSERT_EQ(report.size(), 1);
+  EXPECT_EQ(report[0].calls_, 2);
+  EXPECT_EQ(report[0].cells_, 10);
+  EXPECT_GE(report[0].seconds_, 0.0);
+}
+
+TEST(Profiler, ModelReportsEveryProcessAndConstraint)
+{
+  constexpr std::size_t number_of_cells = 3;
+  Model model = MakeProfiledModel();
+  auto indices = MakeIndices(model);
+
+  std::vector<micm::Conditions> conditions(number_of_cells);
+  DenseMatrix parameters(number_of_cells, indices.parameters_.size(), 1.0e-2);
+  DenseMatrix variables(number_of_cells, indices.variables_.size(), 0.5);
+  DenseMatrix forcing(number_of_cells, indices.variables_.size(), 0.0);
+  DenseMatrix residual(number_of_cells, indices.variables_.size(), 0.0);
+  auto builder = SparseMatrix::Create(indices.variables_.size()).SetNumberOfBlocks(number_of_cells).InitialValue(0.0);
+  for (const auto& element : model.NonZeroJacobianElements(indices.variables_))
+    builder = builder.WithElement(element.first, element.second);
+  for (const auto& element : model.NonZeroConstraintJacobianElements(indices.variables_))
+    builder = builder.WithElement(element.first, element.second);
+  SparseMatrix jacobian(builder);
+
+  auto update_fn = model.UpdateStateParametersFunction<DenseMatrix>(indices.parameters_);
+  auto forcing_fn = model.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_);
+  auto jacobian_fn =
+      model.JacobianFunction<DenseMatrix, SparseMatrix>(indices.parameters_, indices.variables_, jacobian);
+  auto residual_fn = model.ConstraintResidualFunction<DenseMatrix>(indices.parameters_, indices.variables_);
+  auto constraint_jacobian_fn =
+      model.ConstraintJacobianFunction<DenseMatrix, SparseMatrix>(indices.parameters_, indices.variables_, jacobian);
+
+  for (int call = 0; call < 2; ++call)
+  {
+    update_fn(conditions, parameters);
+    forcing_fn(parameters, variables, forcing);
+    jacobian_fn(parameters, variables, jacobian);
+    residual_fn(variables, parameters, residual);
+    constraint_jacobian_fn(variables, parameters, jacobian);
+  }
+
+  auto profile = model.GetProfile();
+  for (const auto& [type, function] : std::vector<std::pair<std::string, ProfiledFunction>>{
+           { "HenryLawPhaseTransfer", ProfiledFunction::UpdateStateParameters },
+           { "HenryLawPhaseTransfer", ProfiledFunction::Forcing },
+           { "HenryLawPhaseTransfer", ProfiledFunction::Jacobian },
+           { "DissolvedReaction", ProfiledFunction::UpdateStateParameters },
+           { "DissolvedReaction", ProfiledFunction::Forcing },
+           { "DissolvedReaction", ProfiledFunction::Jacobian },
+           { "LinearConstraintSystem", ProfiledFunction::ConstraintResidual },
+           { "LinearConstraintSystem", ProfiledFunction::ConstraintJacobian },
+           { "Model", ProfiledFunction::UpdateStateParameters },
+           { "Model", ProfiledFunction::Forcing },
+           { "Model", ProfiledFunction::Jacobian },
+           { "Model", ProfiledFunction::ConstraintResidual },
+           { "Model", ProfiledFunction::ConstraintJacobian } })
+  {
+    const auto* entry = Find(profile, type, function);
+    ASSERT_NE(entry, nullptr) << type << " " << ToString(function);
+    EXPECT_EQ(entry->calls_, 2) << type << " " << ToString(function);
+    EXPECT_EQ(entry->cells_, 2 * number_of_cells) << type << " " << ToString(function);
+  }
+  EXPECT_EQ(Find(profile, "Model", ProfiledFunction::Forcing)->uuid_, "PROFILED");
+  const auto& processes = model.processes_;
+  EXPECT_EQ(
+      Find(profile, "DissolvedReaction", ProfiledFunction::Forcing)->uuid_, std::get<DissolvedReaction>(processes[1]).uuid_);
+  EXPECT_EQ(Find(profile, "LinearConstraintSystem", ProfiledFunction::ConstraintResidual)->uuid_, "PROFILED");
+  EXPECT_EQ(Find(profile, "LinearConstraintSystem", ProfiledFunction::ConstraintJacobian)->uuid_, "PROFILED");
+  EXPECT_EQ(Find(profile, "LinearConstraint", ProfiledFunction::ConstraintResidual), nullptr);
+
+  model.ResetProfile();
+  for (const auto& entry : model.GetProfile())
+    EXPECT_EQ(entry.calls_, 0);
+}
+
+TEST(Profiler, CellParallelBlocksAccumulateIntoOneEntry)
+{
+  constexpr std::size_t number_of_cells = 4;
+  Model model = MakeProfiledModel();
+  model.options_.thread_pool_ = std::make_shared<ThreadPool>(2);
+  auto indices = MakeIndices(model);
+
+  DenseMatrix parameters(number_of_cells, indices.parameters_.size(), 1.0e-2);
+  DenseMatrix variables(number_of_cells, indices.variables_.size(), 0.5);
+  DenseMatrix forcing(number_of_cells, indices.variables_.size(), 0.0);
+  auto forcing_fn = model.ForcingFunction<DenseMatrix>(indices.parameters_, indices.variables_);
+  forcing_fn(parameters, variables, forcing);
+
+  auto profile = model.GetProfile();
+  const auto* entry = Find(profile, "DissolvedReaction", ProfiledFunction::Forcing);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->calls_, 2);  // one call per cell block
+  EXPECT_EQ(entry->cells_, number_of_cells);
+  auto is_reaction_forcing = [](const ProfileEntry& e)
+  { return e.type_ == "DissolvedReaction" && e.function_ == ProfiledFunction::Forcing; };
+  EXPECT_EQ(std::count_if(profile.begin(), profile.end(), is_reaction_forcing), 1);
+}
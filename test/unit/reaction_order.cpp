@@ -0,0 +1,46 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/math/reaction_order.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+
+using namespace miam;
+
+TEST(ReactionOrder, FixedOrderPowerMatchesStdPow)
+{
+  for (double x : { 1.0e-20, 0.5, 1.0, 55.5, 1.0e3 })
+  {
+    EXPECT_DOUBLE_EQ(ReactionOrderPower<1>(x, 1), std::pow(x, 1.0));
+    EXPECT_DOUBLE_EQ(ReactionOrderPower<2>(x, 2), std::pow(x, 2.0));
+    EXPECT_DOUBLE_EQ(ReactionOrderPower<3>(x, 3), std::pow(x, 3.0));
+    EXPECT_DOUBLE_EQ(ReactionOrderPower<4>(x, 4), std::pow(x, 4.0));
+  }
+}
+
+TEST(ReactionOrder, GenericOrderUsesRuntimeExponent)
+{
+  for (std::size_t order = 1; order <= 6; ++order)
+    EXPECT_DOUBLE_EQ(ReactionOrderPower<kGenericReactionOrder>(1.7, order), std::pow(1.7, static_cast<double>(order)));
+}
+
+TEST(ReactionOrder, NextReactionOrder)
+{
+  EXPECT_EQ(kNextReactionOrder<1>, 2);
+  EXPECT_EQ(kNextReactionOrder<3>, 4);
+  EXPECT_EQ(kNextReactionOrder<kGenericReactionOrder>, kGenericReactionOrder);
+}
+
+TEST(ReactionOrder, DispatchPassesLowOrdersAsConstants)
+{
+  auto dispatched = [](std::size_t order)
+  { return DispatchReactionOrder(order, [](auto o) { return decltype(o)::value; }); };
+  EXPECT_EQ(dispatched(1), 1);
+  EXPECT_EQ(dispatched(2), 2);
+  EXPECT_EQ(dispatched(3), 3);
+  EXPECT_EQ(dispatched(4), kGenericReactionOrder);
+  EXPECT_EQ(dispatched(7), kGenericReactionOrder);
+}
@@ -153,7 +153,7 @@ inline void checkFiniteDifferences(
   std::size_t n_deps = provider.dependent_variable_indices.size();
   Mat result(1, 1, 0.0);
   Mat partials(1, n_deps, 0.0);
-  provider.ComputeValueAndDerivatives(params, vars, result, partials);
+  miam::DensePartialsProvider(provider).ComputeValueAndDerivatives(params, vars, result, partials);
 
   for (std::size_t k = 0; k < n_deps; ++k)
   {
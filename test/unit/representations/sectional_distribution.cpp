@@ -0,0 +1,278 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include "../representation_policy.hpp"
+
+#include <miam/representations/aerosol_property.hpp>
+#include <miam/representations/aerosol_property_cache.hpp>
+#include <miam/representations/sectional_distribution.hpp>
+#include <miam/representations/uniform_section.hpp>
+#include <miam/util/miam_exception.hpp>
+
+#include <micm/util/matrix.hpp>
+#include <micm/util/vector_matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+using namespace miam;
+
+TEST(SectionalDistribution, StateSize)
+{
+  const auto phases = getTestPhases();
+  SectionalDistribution distribution{ test_model_name, phases, 4, 1.0e-8, 1.0e-5 };
+  auto size = distribution.StateSize();
+  // 3 species and 2 radius parameters per bin
+  EXPECT_EQ(std::get<0>(size), 12);
+  EXPECT_EQ(std::get<1>(size), 8);
+  EXPECT_EQ(distribution.StateVariableNames().size(), 12);
+  EXPECT_EQ(distribution.StateParameterNames().size(), 8);
+}
+
+TEST(SectionalDistribution, LogSpacedEdges)
+{
+  const auto phases = getTestPhases();
+  SectionalDistribution distribution{ test_model_name, phases, 3, 1.0e-8, 1.0e-5 };
+  const auto& edges = distribution.BinEdges();
+  ASSERT_EQ(edges.size(), 4);
+  EXPECT_EQ(distribution.NumberOfBins(), 3);
+  EXPECT_DOUBLE_EQ(edges.front(), 1.0e-8);
+  EXPECT_DOUBLE_EQ(edges.back(), 1.0e-5);
+  EXPECT_NEAR(edges[1], 1.0e-7, 1.0e-7 * 1e-12);
+  EXPECT_NEAR(edges[2], 1.0e-6, 1.0e-6 * 1e-12);
+}
+
+TEST(SectionalDistribution, UserGivenEdges)
+{
+  const auto phases = getTestPhases();
+  std::vector<double> edges{ 0.0, 1.0e-7, 5.0e-7, 2.0e-6 };
+  SectionalDistribution distribution{ test_model_name, phases, edges };
+  EXPECT_EQ(distribution.NumberOfBins(), 3);
+
+  auto params = distribution.DefaultParameters();
+  EXPECT_EQ(params.size(), 6);
+  for (std::size_t bin = 0; bin < 3; ++bin)
+  {
+    EXPECT_EQ(params[distribution.MinRadius(bin)], edges[bin]);
+    EXPECT_EQ(params[distribution.MaxRadius(bin)], edges[bin + 1]);
+  }
+}
+
+TEST(SectionalDistribution, InvalidEdgesThrow)
+{
+  const auto phases = getTestPhases();
+  std::vector<double> single_edge{ 1.0e-7 };
+  std::vector<double> decreasing{ 1.0e-6, 1.0e-7 };
+  std::vector<double> negative{ -1.0e-7, 1.0e-7 };
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, single_edge }), MiamException);
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, decreasing }), MiamException);
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, negative }), MiamException);
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, 0, 1.0e-8, 1.0e-5 }), MiamException);
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, 4, 0.0, 1.0e-5 }), MiamException);
+  EXPECT_THROW((SectionalDistribution{ test_model_name, phases, 4, 1.0e-5, 1.0e-8 }), MiamException);
+}
+
+TEST(SectionalDistribution, BinPrefixesSortInBinOrder)
+{
+  const auto phases = getTestPhases();
+  SectionalDistribution distribution{ "DUST", phases, 12, 1.0e-8, 1.0e-5 };
+  EXPECT_EQ(distribution.BinPrefix(0), "DUST.BIN_00");
+  EXPECT_EQ(distribution.BinPrefix(3), "DUST.BIN_03");
+  EXPECT_EQ(distribution.BinPrefix(11), "DUST.BIN_11");
+  for (std::size_t bin = 1; bin < distribution.NumberOfBins(); ++bin)
+    EXPECT_LT(distribution.BinPrefix(bin - 1), distribution.BinPrefix(bin));
+}
+
+TEST(SectionalDistribution, StateVariableNamesCoverEveryBin)
+{
+  const auto phases = getTestPhases();
+  SectionalDistribution distribution{ "DUST", phases, 3, 1.0e-8, 1.0e-5 };
+  auto names = distribution.StateVariableNames();
+  ASSERT_EQ(names.size(), 9);
+  EXPECT_TRUE(names.count("DUST.BIN_0.PHASE1.SPECIES_A"));
+  EXPECT_TRUE(names.count("DUST.BIN_1.PHASE1.SPECIES_A"));
+  EXPECT_TRUE(names.count("DUST.BIN_2.PHASE2.SPECIES_C"));
+  for (std::size_t bin = 0; bin < distribution.NumberOfBins(); ++bin)
+  {
+    UniformSection section{ distribution.BinPrefix(bin), phases };
+    for (const auto& name : section.StateVariableNames())
+      EXPECT_TRUE(names.count(name)) << name;
+  }
+  EXPECT_EQ(distribution.Species(1, phases[0], micm::Species{ "SPECIES_B" }), "DUST.BIN_1.PHASE1.SPECIES_B");
+}
+
+TEST(SectionalDistribution, PhaseInstancesPerBin)
+{
+  const auto phases = getTestPhases();
+  SectionalDistribution distribution{ "DUST", phases, 5, 1.0e-8, 1.0e-5 };
+
+  auto num_instances = distribution.NumPhaseInstances();
+  EXPECT_EQ(num_instances["PHASE1"], 5);
+  EXPECT_EQ(num_instances["PHASE2"], 5);
+
+  auto phase_prefixes = distribution.PhaseStatePrefixes();
+  ASSERT_EQ(phase_prefixes["PHASE1"].size(), 5);
+  ASSERT_EQ(phase_prefixes["PHASE2"].size(), 5);
+  for (std::size_t bin = 0; bin < 5; ++bin)
+    EXPECT_TRUE(phase_prefixes["PHASE1"].count(distribution.BinPrefix(bin)));
+}
+
+namespace
+{
+  using Matrix = micm::Matrix<double>;
+
+  micm::Species MakeSpecies(const std::string& name, double mw, double rho)
+  {
+    return micm::Species{ name, { { "molecular weight [kg mol-1]", mw }, { "density [kg m-3]", rho } } };
+  }
+
+  micm::Phase MakeProviderTestPhase()
+  {
+    return micm::Phase{ "aqueous", { { MakeSpecies("A", 0.018, 1000.0) }, { MakeSpecies("B", 0.044, 2000.0) } } };
+  }
+
+  /// @brief Checks that a cache filled by the bin groups matches one UniformSection provider per bin
+  template<typename MatrixPolicy>
+  void TestCachedBinsMatchUniformSections()
+  {
+    auto aqueous = MakeProviderTestPhase();
+    micm::Phase organic{ "organic", { { MakeSpecies("C", 0.2, 1400.0) } } };
+    SectionalDistribution distribution{ "SECT", { aqueous, organic }, 3, 1.0e-7, 1.0e-5 };
+
+    std::unordered_map<std::string, std::size_t> param_idx;
+    for (const auto& name : distribution.StateParameterNames())
+      param_idx[name] = param_idx.size();
+    std::unordered_map<std::string, std::size_t> var_idx;
+    for (const auto& name : distribution.StateVariableNames())
+      var_idx[name] = var_idx.size();
+
+    // Five cells leave the last cell group of a VectorMatrix<double, 4> partly filled
+    const std::size_t num_cells = 5;
+    MatrixPolicy params{ num_cells, param_idx.size(), 0.0 };
+    MatrixPolicy vars{ num_cells, var_idx.size(), 0.0 };
+    for (std::size_t cell = 0; cell < num_cells; ++cell)
+    {
+      for (const auto& [name, value] : distribution.DefaultParameters())
+        params[cell][param_idx[name]] = value * (1.0 + 0.1 * static_cast<double>(cell));
+      for (std::size_t i = 0; i < var_idx.size(); ++i)
+        vars[cell][i] = 10.0 * static_cast<double>(i + 1) + static_cast<double>(cell);
+    }
+    vars[0][var_idx["SECT.BIN_1.aqueous.A"]] = 0.0;
+    vars[0][var_idx["SECT.BIN_1.aqueous.B"]] = 0.0;
+    vars[0][var_idx["SECT.BIN_1.organic.C"]] = 0.0;
+
+    const std::vector<AerosolProperty> properties{ AerosolProperty::EffectiveRadius,
+                                                   AerosolProperty::NumberConcentration,
+                                                   AerosolProperty::PhaseVolumeFraction };
+    AerosolPropertyCache<MatrixPolicy> cache;
+    for (auto property : properties)
+    {
+      std::vector<std::string> prefixes;
+      std::vector<AerosolPropertyProvider<MatrixPolicy>> providers;
+      for (auto& [prefix, provider] :
+           distribution.GetPropertyProviders<MatrixPolicy>(property, param_idx, var_idx, "aqueous"))
+      {
+        prefixes.push_back(prefix);
+        providers.push_back(provider);
+      }
+      cache.AddFused(
+          prefixes,
+          property,
+          providers,
+          distribution.GetFusedPropertyProvider<MatrixPolicy>(property, param_idx, var_idx, "aqueous"));
+    }
+    ASSERT_EQ(cache.Size(), 9);
+    cache.UpdateWithPartials(params, vars);
+    const auto values = cache.PackedValues();
+    cache.Update(params, vars);
+
+    for (auto property : properties)
+    {
+      const std::size_t first = cache.Index(distribution.BinPrefix(0), property);
+      for (std::size_t bin = 0; bin < 3; ++bin)
+      {
+        // The bins of a property sit in consecutive entries
+        const std::size_t index = cache.Index(distribution.BinPrefix(bin), property);
+        EXPECT_EQ(index, first + bin);
+
+        UniformSection section{ distribution.BinPrefix(bin), { aqueous, organic } };
+        auto expected_provider = section.GetPropertyProvider<MatrixPolicy>(property, param_idx, var_idx, "aqueous");
+        EXPECT_EQ(cache.DependentVariableIndices(index), expected_provider.dependent_variable_indices);
+        const std::size_t n_partials = expected_provider.NumberOfPartialsColumns();
+        MatrixPolicy expected{ num_cells, 1, 0.0 };
+        MatrixPolicy expected_partials{ num_cells, std::max(n_partials, std::size_t(1)), 0.0 };
+        expected_provider.ComputeValueAndDerivatives(params, vars, expected, expected_partials);
+        for (std::size_t cell = 0; cell < num_cells; ++cell)
+        {
+          EXPECT_DOUBLE_EQ(values[cell][index], expected[cell][0]);
+          EXPECT_DOUBLE_EQ(cache.PackedValues()[cell][index], expected[cell][0]);
+          for (std::size_t k = 0; k < n_partials; ++k)
+            EXPECT_DOUBLE_EQ(cache.PackedPartials()[cell][cache.PartialsOffset(index) + k], expected_partials[cell][k]);
+        }
+      }
+    }
+  }
+}  // namespace
+
+TEST(SectionalDistribution, ProvidersMatchUniformSections)
+{
+  auto phase = MakeProviderTestPhase();
+  SectionalDistribution distribution{ "SECT", { phase }, 3, 1.0e-7, 1.0e-5 };
+
+  std::unordered_map<std::string, std::size_t> param_idx;
+  for (const auto& name : distribution.StateParameterNames())
+    param_idx[name] = param_idx.size();
+  std::unordered_map<std::string, std::size_t> var_idx;
+  for (const auto& name : distribution.StateVariableNames())
+    var_idx[name] = var_idx.size();
+
+  Matrix params{ 2, param_idx.size(), 0.0 };
+  Matrix vars{ 2, var_idx.size(), 0.0 };
+  for (std::size_t cell = 0; cell < 2; ++cell)
+  {
+    for (const auto& [name, value] : distribution.DefaultParameters())
+      params[cell][param_idx[name]] = value;
+    for (std::size_t i = 0; i < var_idx.size(); ++i)
+      vars[cell][i] = 10.0 * static_cast<double>(i + 1) + static_cast<double>(cell);
+  }
+
+  for (auto property : { AerosolProperty::EffectiveRadius, AerosolProperty::NumberConcentration })
+  {
+    auto providers = distribution.GetPropertyProviders<Matrix>(property, param_idx, var_idx);
+    ASSERT_EQ(providers.size(), 3);
+    for (std::size_t bin = 0; bin < 3; ++bin)
+    {
+      auto bin_prefix = distribution.BinPrefix(bin);
+      UniformSection section{ bin_prefix, { phase } };
+      auto expected_provider = section.GetPropertyProvider<Matrix>(property, param_idx, var_idx);
+      auto& provider = providers.at(bin_prefix);
+      EXPECT_EQ(provider.dependent_variable_indices, expected_provider.dependent_variable_indices);
+
+      std::size_t n_deps = provider.dependent_variable_indices.size();
+      Matrix result{ 2, 1, 0.0 };
+      Matrix expected{ 2, 1, 0.0 };
+      Matrix partials{ 2, n_deps, 0.0 };
+      Matrix expected_partials{ 2, n_deps, 0.0 };
+      provider.ComputeValueAndDerivatives(params, vars, result, partials);
+      expected_provider.ComputeValueAndDerivatives(params, vars, expected, expected_partials);
+      for (std::size_t cell = 0; cell < 2; ++cell)
+      {
+        EXPECT_GT(result[cell][0], 0.0);
+        EXPECT_DOUBLE_EQ(result[cell][0], expected[cell][0]);
+        for (std::size_t k = 0; k < n_deps; ++k)
+          EXPECT_DOUBLE_EQ(partials[cell][k], expected_partials[cell][k]);
+      }
+    }
+  }
+}
+
+TEST(SectionalDistribution, CachedBinsMatchUniformSectionsStandardMatrix)
+{
+  TestCachedBinsMatchUniformSections<micm::Matrix<double>>();
+}
+
+TEST(SectionalDistribution, CachedBinsMatchUniformSectionsVectorMatrix)
+{
+  TestCachedBinsMatchUniformSections<micm::VectorMatrix<double, 4>>();
+}
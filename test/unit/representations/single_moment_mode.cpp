@@ -298,8 +298,10 @@ TEST(SingleMomentMode, ProviderNumberConcentration)
   EXPECT_NEAR(result[0][0], expected_N, std::abs(expected_N) * 1e-10);
 
   Matrix result2{ 1, 1, 0.0 };
+  // One factor column, 1 / V_s, scaled by each species molar volume; read one column per species
+  EXPECT_EQ(provider.NumberOfPartialsColumns(), 1);
   Matrix partials{ 1, 2, 0.0 };
-  provider.ComputeValueAndDerivatives(params, vars, result2, partials);
+  DensePartialsProvider(provider).ComputeValueAndDerivatives(params, vars, result2, partials);
   EXPECT_NEAR(result2[0][0], expected_N, std::abs(expected_N) * 1e-10);
   EXPECT_NEAR(partials[0][0], mwr_A / V_single, std::abs(mwr_A / V_single) * 1e-10);
   EXPECT_NEAR(partials[0][1], mwr_B / V_single, std::abs(mwr_B / V_single) * 1e-10);
@@ -366,8 +368,10 @@ TEST(SingleMomentMode, ProviderPhaseVolumeFractionMultiPhase)
   EXPECT_NEAR(result[0][0], expected_phi, 1e-10);
 
   Matrix result2{ 1, 1, 0.0 };
+  // One factor column for the target phase and one for the other phase; read one column per species
+  EXPECT_EQ(provider.NumberOfPartialsColumns(), 2);
   Matrix partials{ 1, 2, 0.0 };
-  provider.ComputeValueAndDerivatives(params, vars, result2, partials);
+  DensePartialsProvider(provider).ComputeValueAndDerivatives(params, vars, result2, partials);
   EXPECT_NEAR(result2[0][0], expected_phi, 1e-10);
 
   double dphi_dA = mwr_A * (1.0 - expected_phi) / V_total;
@@ -288,8 +288,10 @@ TEST(TwoMomentMode, ProviderEffectiveRadius)
   EXPECT_NEAR(result[0][0], expected, std::abs(expected) * 1e-10);
 
   Matrix result2{ 1, 1, 0.0 };
+  // ∂r_eff/∂N, then one factor column scaled by each species molar volume; read one column per dependent
+  EXPECT_EQ(provider.NumberOfPartialsColumns(), 2);
   Matrix partials{ 1, 3, 0.0 };
-  provider.ComputeValueAndDerivatives(params, vars, result2, partials);
+  DensePartialsProvider(provider).ComputeValueAndDerivatives(params, vars, result2, partials);
   EXPECT_NEAR(result2[0][0], expected, std::abs(expected) * 1e-10);
 
   double dr_dA = expected * mwr_A / (3.0 * V_total);
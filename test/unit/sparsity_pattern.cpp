@@ -0,0 +1,80 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/util/sparsity_pattern.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace miam;
+
+TEST(SparsityPattern, EmptyPatternIsFinalized)
+{
+  SparsityPattern pattern;
+  EXPECT_TRUE(pattern.IsFinalized());
+  EXPECT_EQ(pattern.Size(), 0);
+  EXPECT_TRUE(pattern.ToSet().empty());
+}
+
+TEST(SparsityPattern, FinalizeSortsAndRemovesDuplicates)
+{
+  SparsityPattern pattern;
+  pattern.Add(3, 1);
+  pattern.Add(0, 2);
+  pattern.Add(3, 1);
+  pattern.Add(0, 0);
+  pattern.Add(1, 5);
+  pattern.Add(0, 2);
+  EXPECT_FALSE(pattern.IsFinalized());
+  EXPECT_EQ(pattern.Size(), 6);
+
+  const auto& elements = pattern.Finalize();
+  std::vector<std::pair<std::size_t, std::size_t>> expected{ { 0, 0 }, { 0, 2 }, { 1, 5 }, { 3, 1 } };
+  EXPECT_TRUE(pattern.IsFinalized());
+  EXPECT_EQ(elements, expected);
+  EXPECT_TRUE(pattern.Contains(1, 5));
+  EXPECT_FALSE(pattern.Contains(5, 1));
+}
+
+TEST(SparsityPattern, AppendMergesPatterns)
+{
+  SparsityPattern a;
+  a.Add(0, 0);
+  a.Add(2, 1);
+  a.Finalize();
+
+  SparsityPattern b;
+  b.Add(2, 1);
+  b.Add(1, 1);
+
+  SparsityPattern empty;
+  a.Append(empty);
+  EXPECT_TRUE(a.IsFinalized());
+
+  a.Append(b);
+  EXPECT_FALSE(a.IsFinalized());
+  a.Finalize();
+  EXPECT_EQ(a.Size(), 3);
+}
+
+TEST(SparsityPattern, ToSetMatchesStdSet)
+{
+  SparsityPattern pattern;
+  std::set<std::pair<std::size_t, std::size_t>> reference;
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    std::size_t row = (i * 37) % 23;
+    std::size_t col = (i * 11) % 17;
+    pattern.Add(row, col);
+    reference.insert({ row, col });
+  }
+  auto set = pattern.ToSet();
+  EXPECT_EQ(set, reference);
+  EXPECT_EQ(pattern.Size(), reference.size());
+  EXPECT_TRUE(std::equal(pattern.begin(), pattern.end(), reference.begin(), reference.end()));
+}
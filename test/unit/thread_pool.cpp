@@ -0,0 +1,66 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/util/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace miam;
+
+TEST(ThreadPool, NumberOfThreadsIncludesCaller)
+{
+  EXPECT_EQ(ThreadPool{ 1 }.NumberOfThreads(), 1);
+  EXPECT_EQ(ThreadPool{ 3 }.NumberOfThreads(), 3);
+  EXPECT_GE(ThreadPool{}.NumberOfThreads(), 1);
+}
+
+TEST(ThreadPool, ParallelForRunsEveryTaskOnce)
+{
+  for (std::size_t threads : { 1, 2, 4 })
+  {
+    ThreadPool pool{ threads };
+    for (std::size_t tasks : { 0, 1, 3, 17 })
+    {
+      std::vector<std::atomic<int>> counts(tasks);
+      pool.ParallelFor(tasks, [&](std::size_t i) { ++counts[i]; });
+      for (std::size_t i = 0; i < tasks; ++i)
+        EXPECT_EQ(counts[i].load(), 1) << "threads " << threads << " tasks " << tasks << " task " << i;
+    }
+  }
+}
+
+TEST(ThreadPool, ParallelForIsReusable)
+{
+  ThreadPool pool{ 4 };
+  std::atomic<std::size_t> sum{ 0 };
+  for (std::size_t call = 0; call < 100; ++call)
+    pool.ParallelFor(8, [&](std::size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 100 * 28);
+}
+
+TEST(ThreadPool, ParallelForRethrowsTaskException)
+{
+  ThreadPool pool{ 3 };
+  std::atomic<int> ran{ 0 };
+  EXPECT_THROW(
+      pool.ParallelFor(
+          6,
+          [&](std::size_t i)
+          {
+            ++ran;
+            if (i == 2)
+              throw std::runtime_error("task failed");
+          }),
+      std::runtime_error);
+  EXPECT_EQ(ran.load(), 6);
+
+  // The pool stays usable after a failed loop
+  ran = 0;
+  pool.ParallelFor(6, [&](std::size_t) { ++ran; });
+  EXPECT_EQ(ran.load(), 6);
+}
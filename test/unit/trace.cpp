@@ -0,0 +1,191 @@
+// Copyright (C) 2026 University Corporation for Atmospheric Research
+// SPDX-License-Identifier: Apache-2.0
+
+#include <miam/model/model.hpp>
+#include <miam/processes/dissolved_reaction.hpp>
+#include <miam/processes/henry_law_phase_transfer.hpp>
+#include <miam/representations/single_moment_mode.hpp>
+#include <miam/util/trace.hpp>
+
+#include <micm/system/phase.hpp>
+#include <micm/system/species.hpp>
+#include <micm/util/matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace miam;
+
+namespace
+{
+  using DenseMatrix = micm::Matrix<double>;
+
+  /// Counts the non-overlapping occurrences of a substring
+  std::size_t Count(const std::string& text, const std::string& pattern)
+  {
+    std::size_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+      ++count;
+    return count;
+  }
+
+  std::string ChromeTrace(const TraceSink& sink)
+  {
+    std::ostringstream os;
+    sink.WriteChromeTrace(os);
+    return os.str();
+  }
+}  // namespace
+
+TEST(TraceSink, RegisterEventReturnsOneIndexPerKind)
+{
+  TraceSink sink(4);
+  auto first = sink.RegisterEvent("DissolvedReaction::Forcing", "Forcing", "uuid-1");
+  auto again = sink.RegisterEvent("DissolvedReaction::Forcing", "Forcing", "uuid-1");
+  auto other = sink.RegisterEvent("DissolvedReaction::Forcing", "Forcing", "uuid-2");
+  EXPECT_EQ(first, again);
+  EXPECT_NE(first, other);
+  EXPECT_EQ(sink.NumberOfEvents(), 0);
+}
+
+TEST(TraceSink, RingBufferKeepsMostRecentSpans)
+{
+  TraceSink sink(3);
+  std::vector<std::size_t> events;
+  for (const auto* name : { "A", "B", "C", "D", "E" })
+    events.push_back(sink.RegisterEvent(name, "test"));
+  const auto start = TraceSink::Clock::now();
+  for (std::size_t i = 0; i < events.size(); ++i)
+    sink.Record(events[i], start + std::chrono::microseconds(10 * i), start + std::chrono::microseconds(10 * i + 5));
+
+  EXPECT_EQ(sink.Capacity(), 3);
+  EXPECT_EQ(sink.NumberOfEvents(), 3);
+  EXPECT_EQ(sink.NumberOfDroppedEvents(), 2);
+  auto json = ChromeTrace(sink);
+  EXPECT_EQ(json.find("\"name\":\"A\""), std::string::npos);
+  EXPECT_EQ(json.find("\"name\":\"B\""), std::string::npos);
+  auto c = json.find("\"name\":\"C\"");
+  auto d = json.find("\"name\":\"D\"");
+  auto e = json.find("\"name\":\"E\"");
+  ASSERT_NE(c, std::string::npos);
+  ASSERT_NE(d, std::string::npos);
+  ASSERT_NE(e, std::string::npos);
+  EXPECT_LT(c, d);  // oldest first
+  EXPECT_LT(d, e);
+
+  sink.Clear();
+  EXPECT_EQ(sink.NumberOfEvents(), 0);
+  EXPECT_EQ(sink.NumberOfDroppedEvents(), 0);
+  EXPECT_EQ(Count(ChromeTrace(sink), "\"ph\":\"X\""), 0);
+}
+
+TEST(TraceSink, WritesChromeTraceEvents)
+{
+  TraceSink sink(8);
+  auto event = sink.RegisterEvent("Model::\"Forcing\"", "Forcing", "uuid-1");
+  auto plain = sink.RegisterEvent("MassActionTerms::Forcing", "Forcing");
+  const auto start = TraceSink::Clock::now();
+  sink.Record(event, start, start + std::chrono::microseconds(250));
+  sink.Record(plain, start, start + std::chrono::microseconds(1));
+
+  auto json = ChromeTrace(sink);
+  EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+  EXPECT_NE(json.find("\"name\":\"Model::\\\"Forcing\\\"\""), std::string::npos);
+  EXPECT_NE(json.find("\"cat\":\"Forcing\",\"ph\":\"X\",\"pid\":1,\"tid\":"), std::string::npos);
+  EXPECT_NE(json.find("\"dur\":250"), std::string::npos);
+  EXPECT_EQ(Count(json, "\"args\":{\"uuid\":\"uuid-1\"}"), 1);
+  EXPECT_EQ(Count(json, "\"ph\":\"X\""), 2);
+  EXPECT_NE(json.find("]}"), std::string::npos);
+}
+
+TEST(TraceSink, SpansFromSeveralThreadsGetTheirOwnThreadIds)
+{
+  TraceSink sink(16);
+  auto event = sink.RegisterEvent("work", "test");
+  auto record = [&]() { TraceSpan span(&sink, event); };
+  std::thread first(record);
+  first.join();
+  std::thread second(record);
+  second.join();
+  EXPECT_EQ(sink.NumberOfEvents(), 2);
+
+  auto json = ChromeTrace(sink);
+  auto tid = [&](std::size_t from)
+  {
+    auto pos = json.find("\"tid\":", from) + 6;
+    return std::make_pair(json.substr(pos, json.find(',', pos) - pos), pos);
+  };
+  auto [first_tid, pos] = tid(0);
+  auto [second_tid, unused] = tid(pos);
+  EXPECT_NE(first_tid, second_tid);
+}
+
+TEST(TraceSink, TraceFunctionRecordsOneSpanPerCall)
+{
+  auto sink = std::make_shared<TraceSink>(4);
+  std::function<void(int&)> function = [](int& value) { ++value; };
+  auto traced = TraceFunction(function, sink, sink->RegisterEvent("increment", "test"));
+  auto untraced = TraceFunction(function, std::shared_ptr<TraceSink>{}, 0);
+  int value = 0;
+  traced(value);
+  traced(value);
+  untraced(value);
+  EXPECT_EQ(value, 3);
+  EXPECT_EQ(sink->NumberOfEvents(), 2);
+}
+
+TEST(TraceSink, ModelFunctionsRecordSpans)
+{
+  constexpr std::size_t number_of_cells = 2;
+  auto h2o = micm::Species{ "H2O", { { "molecular weight [kg mol-1]", 0.018 }, { "density [kg m-3]", 1000.0 } } };
+  auto a_g = micm::Species{ "A_g", { { "molecular weight [kg mol-1]", 0.044 } } };
+  auto a_aq = micm::Species{ "A_aq", { { "molecular weight [kg mol-1]", 0.044 }, { "density [kg m-3]", 1800.0 } } };
+  auto b_aq = micm::Species{ "B_aq", { { "molecular weight [kg mol-1]", 0.062 }, { "density [kg m-3]", 1500.0 } } };
+  auto aqueous_phase = micm::Phase{ "AQUEOUS", { { h2o }, { a_aq }, { b_aq } } };
+  auto hlc = [](const micm::Conditions& conditions) { return 3.4e-2; };
+  auto k = [](const micm::Conditions& conditions) { return 4.0e-3; };
+
+  Model model;
+  model.name_ = "TRACED";
+  model.representations_.push_back(SingleMomentMode{ "MODE1", { aqueous_phase } });
+  model.AddProcesses(
+      HenryLawPhaseTransfer{ hlc, a_g, a_aq, h2o, aqueous_phase, 1.5e-5, 0.05, 0.044, 0.018, 1000.0 },
+      DissolvedReaction{ { { "MODE1", k } }, { a_aq }, { b_aq }, h2o, aqueous_phase });
+  auto sink = std::make_shared<TraceSink>(64);
+  model.options_.trace_sink_ = sink;
+  model.options_.compiled_forcing_ = true;
+
+  std::unordered_map<std::string, std::size_t> variable_indices{ { "A_g", 0 } };
+  for (const auto& name : model.StateVariableNames())
+    variable_indices[name] = variable_indices.size();
+  std::unordered_map<std::string, std::size_t> parameter_indices;
+  for (const auto& name : model.StateParameterNames())
+    parameter_indices[name] = parameter_indices.size();
+
+  DenseMatrix parameters(number_of_cells, parameter_indices.size(), 1.0e-2);
+  DenseMatrix variables(number_of_cells, variable_indices.size(), 0.5);
+  DenseMatrix forcing(number_of_cells, variable_indices.size(), 0.0);
+  auto forcing_fn = model.ForcingFunction<DenseMatrix>(parameter_indices, variable_indices);
+  forcing_fn(parameters, variables, forcing);
+  forcing_fn(parameters, variables, forcing);
+
+  auto json = ChromeTrace(*sink);
+  EXPECT_EQ(Count(json, "\"name\":\"Model::Forcing\""), 2);
+  EXPECT_EQ(Count(json, "\"name\":\"AerosolPropertyCache::Update\""), 2);
+  EXPECT_EQ(Count(json, "\"name\":\"MassActionTerms::Forcing\""), 2);
+  EXPECT_EQ(Count(json, "\"name\":\"HenryLawPhaseTransfer::Forcing\""), 2);
+  EXPECT_EQ(Count(json, "\"args\":{\"uuid\":\"TRACED\"}"), 2);
+
+  // Without a sink the functions carry no spans
+  model.options_.trace_sink_.reset();
+  sink->Clear();
+  model.ForcingFunction<DenseMatrix>(parameter_indices, variable_indices)(parameters, variables, forcing);
+  EXPECT_EQ(sink->NumberOfEvents(), 0);
+}